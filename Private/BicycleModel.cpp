@@ -0,0 +1,290 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "BicycleModel.h"
+
+namespace
+{
+	/** below this forward speed (cm/s) heading changes say nothing about steering */
+	const float MIN_FIT_SPEED = 100.f;
+
+	/** relative ridge weight pulling each parameter towards its prior (keeps unexcited terms, e.g. steering on a straight run, at their prior) */
+	const double RIDGE = 1e-3;
+
+	float GetHeading(const FTransform& transform)
+	{
+		return FMath::DegreesToRadians(transform.GetRotation().Rotator().Yaw);
+	}
+
+	float GetForwardSpeed(const FTransform& transform, const FVector& velocity)
+	{
+		return FVector::DotProduct(velocity, transform.GetRotation().GetForwardVector());
+	}
+}
+
+template <int32 N>
+void FBicycleModel::TNormalEquations<N>::Add(const double (&x)[N], double y)
+{
+	for (int32 i = 0; i < N; i++)
+	{
+		for (int32 j = 0; j < N; j++)
+		{
+			XtX[i][j] += x[i] * x[j];
+		}
+		Xty[i] += x[i] * y;
+	}
+}
+
+template <int32 N>
+void FBicycleModel::TNormalEquations<N>::Solve(const double (&prior)[N], double (&outSolution)[N]) const
+{
+	// (XtX + L) p = Xty + L prior, L diagonal, by Gaussian elimination with partial pivoting
+	double a[N][N + 1];
+	for (int32 i = 0; i < N; i++)
+	{
+		const double ridge = RIDGE * XtX[i][i] + 1e-9;
+		for (int32 j = 0; j < N; j++)
+		{
+			a[i][j] = XtX[i][j] + (i == j ? ridge : 0.0);
+		}
+		a[i][N] = Xty[i] + ridge * prior[i];
+	}
+	for (int32 col = 0; col < N; col++)
+	{
+		int32 pivot = col;
+		for (int32 row = col + 1; row < N; row++)
+		{
+			if (FMath::Abs(a[row][col]) > FMath::Abs(a[pivot][col]))
+			{
+				pivot = row;
+			}
+		}
+		for (int32 j = 0; j <= N; j++)
+		{
+			Swap(a[col][j], a[pivot][j]);
+		}
+		for (int32 row = col + 1; row < N; row++)
+		{
+			const double factor = a[row][col] / a[col][col];
+			for (int32 j = col; j <= N; j++)
+			{
+				a[row][j] -= factor * a[col][j];
+			}
+		}
+	}
+	for (int32 row = N - 1; row >= 0; row--)
+	{
+		double value = a[row][N];
+		for (int32 j = row + 1; j < N; j++)
+		{
+			value -= a[row][j] * outSolution[j];
+		}
+		outSolution[row] = value / a[row][row];
+	}
+}
+
+FBicycleModel::FBicycleModel()
+	: NumRuns(0)
+	, NumValidations(0)
+	, ValidationError(0.f)
+	, ValidationThresholdFraction(0.f)
+	, ValidatedUses(0)
+{
+}
+
+void FBicycleModel::SetSettings(const FBicycleModelSettings& newSettings)
+{
+	Settings = newSettings;
+}
+
+float FBicycleModel::GetSteadyYawRate(float v, float steer) const
+{
+	return v * Parameters.SteerGain * steer / (1.f + Parameters.Understeer * v * v);
+}
+
+void FBicycleModel::AddRun(const TArray<FTransform>& path, const TArray<FVector>& velocities, const TArray<float>& rpms, float tickSeconds, float throttle, float steer)
+{
+	TArray<float> throttles;
+	TArray<float> steers;
+	throttles.Init(throttle, path.Num());
+	steers.Init(steer, path.Num());
+	AddRunWithInputs(path, velocities, rpms, tickSeconds, throttles, steers);
+}
+
+void FBicycleModel::AddTrackedRun(const TArray<FTransform>& path, const TArray<FVector>& velocities, const TArray<float>& rpms, float tickSeconds, const FPathTracker& tracker,
+	float throttle, float throttleBias, float steer)
+{
+	// the tracker chose each tick's inputs from the pose and velocity recorded at the start of that tick
+	const int32 num = FMath::Min(path.Num(), velocities.Num());
+	FPathTracker runTracker = tracker;
+	TArray<float> throttles;
+	TArray<float> steers;
+	throttles.Reserve(num);
+	steers.Reserve(num);
+	for (int32 i = 0; i < num; i++)
+	{
+		FPathTrackerCommand command;
+		command.Throttle = throttle;
+		if (runTracker.IsActive())
+		{
+			command = runTracker.Update(path[i], velocities[i], tickSeconds, throttle);
+		}
+		throttles.Add(command.Throttle + throttleBias);
+		steers.Add(command.Steer + steer);
+	}
+	AddRunWithInputs(path, velocities, rpms, tickSeconds, throttles, steers);
+}
+
+void FBicycleModel::AddRunWithInputs(const TArray<FTransform>& path, const TArray<FVector>& velocities, const TArray<float>& rpms, float tickSeconds, const TArray<float>& throttles, const TArray<float>& steers)
+{
+	const int32 num = FMath::Min3(path.Num(), velocities.Num(), FMath::Min3(rpms.Num(), throttles.Num(), steers.Num()));
+	if (num < 2 || tickSeconds <= 0.f)
+	{
+		return;
+	}
+
+	// finite differences between consecutive ticks, inputs of a tick act until the next one
+	for (int32 i = 0; i + 1 < num; i++)
+	{
+		const float v = GetForwardSpeed(path[i], velocities[i]);
+		const float acceleration = (GetForwardSpeed(path[i + 1], velocities[i + 1]) - v) / tickSeconds;
+		const double longitudinal[3] = { throttles[i], -v * FMath::Abs(v), -v };
+		Longitudinal.Add(longitudinal, acceleration);
+
+		const double engine[2] = { 1.0, FMath::Abs(v) };
+		Engine.Add(engine, rpms[i]);
+
+		if (FMath::Abs(v) >= MIN_FIT_SPEED)
+		{
+			// curvature = gain * steer - understeer * v^2 * curvature
+			const float curvature = FMath::FindDeltaAngleRadians(GetHeading(path[i]), GetHeading(path[i + 1])) / tickSeconds / v;
+			const double lateral[2] = { steers[i], -v * v * curvature };
+			Lateral.Add(lateral, curvature);
+		}
+	}
+	NumRuns++;
+
+	const FBicycleModelParameters prior;
+	const double longitudinalPrior[3] = { prior.Drive, prior.Drag, prior.Rolling };
+	double longitudinal[3];
+	Longitudinal.Solve(longitudinalPrior, longitudinal);
+	Parameters.Drive = float(longitudinal[0]);
+	Parameters.Drag = FMath::Max(float(longitudinal[1]), 0.f);
+	Parameters.Rolling = FMath::Max(float(longitudinal[2]), 0.f);
+
+	const double lateralPrior[2] = { prior.SteerGain, prior.Understeer };
+	double lateral[2];
+	Lateral.Solve(lateralPrior, lateral);
+	Parameters.SteerGain = float(lateral[0]);
+	Parameters.Understeer = FMath::Max(float(lateral[1]), 0.f);
+
+	const double enginePrior[2] = { prior.IdleRPM, prior.RPMPerSpeed };
+	double engine[2];
+	Engine.Solve(enginePrior, engine);
+	Parameters.IdleRPM = float(engine[0]);
+	Parameters.RPMPerSpeed = float(engine[1]);
+
+	// yaw rate lag needs the steady-state yaw rate from the fit above: d(yaw rate)/dt = (steady - yaw rate) / lag
+	for (int32 i = 1; i + 1 < num; i++)
+	{
+		const float v = GetForwardSpeed(path[i], velocities[i]);
+		const float yawRate = FMath::FindDeltaAngleRadians(GetHeading(path[i - 1]), GetHeading(path[i])) / tickSeconds;
+		const float nextYawRate = FMath::FindDeltaAngleRadians(GetHeading(path[i]), GetHeading(path[i + 1])) / tickSeconds;
+		const double response[1] = { GetSteadyYawRate(v, steers[i]) - yawRate };
+		YawResponse.Add(response, (nextYawRate - yawRate) / tickSeconds);
+	}
+	const double responsePrior[1] = { 1.0 / prior.YawLag };
+	double response[1];
+	YawResponse.Solve(responsePrior, response);
+	Parameters.YawLag = response[0] > 0.0 ? FMath::Clamp(float(1.0 / response[0]), tickSeconds, 2.f) : prior.YawLag;
+}
+
+void FBicycleModel::Predict(const FTransform& start, const FVector& linearVelocity, const FVector& angularVelocity, float horizonSeconds, float tickSeconds, float throttle, float throttleBias, float steer,
+	TArray<FTransform>& outPath, TArray<FVector>& outVelocities, TArray<float>& outRPMs, const FPathTracker* tracker) const
+{
+	outPath.Reset();
+	outVelocities.Reset();
+	outRPMs.Reset();
+	if (tickSeconds <= 0.f)
+	{
+		return;
+	}
+
+	const FRotator startRotation = start.GetRotation().Rotator();
+	FVector location = start.GetLocation();
+	float heading = FMath::DegreesToRadians(startRotation.Yaw);
+	float v = GetForwardSpeed(start, linearVelocity);
+	float yawRate = FMath::DegreesToRadians(angularVelocity.Z);
+	const float lagBlend = FMath::Min(tickSeconds / Parameters.YawLag, 1.f);
+	FTransform pose = start;
+	FVector velocity = linearVelocity;
+	FPathTracker predictionTracker;
+	if (tracker)
+	{
+		predictionTracker = *tracker;
+	}
+
+	// semi-implicit Euler, one step per tick, first sample is after the first step (as a rollout records it)
+	const int32 numTicks = FMath::Max(FMath::RoundToInt(horizonSeconds / tickSeconds), 1);
+	outPath.Reserve(numTicks);
+	outVelocities.Reserve(numTicks);
+	outRPMs.Reserve(numTicks);
+	for (int32 tick = 0; tick < numTicks; tick++)
+	{
+		// inputs for this tick, from where the car is at its start (as the car's own tick picks them)
+		FPathTrackerCommand command;
+		command.Throttle = throttle;
+		if (predictionTracker.IsActive())
+		{
+			command = predictionTracker.Update(pose, velocity, tickSeconds, throttle);
+		}
+		const float tickThrottle = command.Throttle + throttleBias;
+		const float tickSteer = command.Steer + steer;
+
+		v += (Parameters.Drive * tickThrottle - Parameters.Drag * v * FMath::Abs(v) - Parameters.Rolling * v) * tickSeconds;
+		yawRate += (GetSteadyYawRate(v, tickSteer) - yawRate) * lagBlend;
+		heading += yawRate * tickSeconds;
+		const FVector forward(FMath::Cos(heading), FMath::Sin(heading), 0.f);
+		location += forward * v * tickSeconds;
+
+		pose = FTransform(FRotator(startRotation.Pitch, FMath::RadiansToDegrees(heading), startRotation.Roll), location);
+		velocity = forward * v;
+		outPath.Add(pose);
+		outVelocities.Add(velocity);
+		outRPMs.Add(FMath::Max(Parameters.IdleRPM + Parameters.RPMPerSpeed * FMath::Abs(v), 0.f));
+	}
+}
+
+float FBicycleModel::RecordValidation(const TArray<FTransform>& predictedPath, const TArray<float>& predictedRPMs, const TArray<FTransform>& rolloutPath, const TArray<float>& rolloutRPMs,
+	const DetectionCore::FThresholds& thresholds)
+{
+	const int32 num = FMath::Min(predictedPath.Num(), rolloutPath.Num());
+	const int32 numRPMs = FMath::Min(predictedRPMs.Num(), rolloutRPMs.Num());
+	float maxError = 0.f;
+	float maxFraction = 0.f;
+	for (int32 i = 0; i < num; i++)
+	{
+		maxError = FMath::Max(maxError, FVector::Dist(predictedPath[i].GetLocation(), rolloutPath[i].GetLocation()));
+		// the heading error that error detection measures
+		const float rotationError = predictedPath[i].GetRotation().AngularDistance(rolloutPath[i].GetRotation());
+		maxFraction = FMath::Max(maxFraction, rotationError / FMath::Max(thresholds.Rotation, KINDA_SMALL_NUMBER));
+	}
+	for (int32 i = 0; i < numRPMs; i++)
+	{
+		maxFraction = FMath::Max(maxFraction, FMath::Abs(predictedRPMs[i] - rolloutRPMs[i]) / FMath::Max(thresholds.RPM, KINDA_SMALL_NUMBER));
+	}
+	ValidationError = NumValidations == 0 ? maxError : FMath::Lerp(ValidationError, maxError, Settings.ErrorSmoothing);
+	ValidationThresholdFraction = NumValidations == 0 ? maxFraction : FMath::Lerp(ValidationThresholdFraction, maxFraction, Settings.ErrorSmoothing);
+	NumValidations++;
+	return maxError;
+}
+
+bool FBicycleModel::ShouldValidate()
+{
+	return ++ValidatedUses % FMath::Max(Settings.ValidateEveryNth, 1) == 0;
+}
+
+bool FBicycleModel::IsValidated() const
+{
+	return IsFitted() && NumValidations >= Settings.MinValidations && ValidationError <= Settings.MaxValidatedError
+		&& ValidationThresholdFraction <= Settings.MaxValidatedThresholdFraction;
+}
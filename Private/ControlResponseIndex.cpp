@@ -0,0 +1,322 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "ControlResponseIndex.h"
+#include "VehicleAdv3.h"
+
+namespace
+{
+	/** smallest response (in spreads) steering across its recorded range has to cause to be worth looking up */
+	const float MIN_STEER_EFFECT = 0.1f;
+}
+
+void FControlResponseIndex::FNearest::Add(float distance, int32 index)
+{
+	if (distance >= Worst())
+	{
+		return;
+	}
+	if (Best.Num() == K)
+	{
+		Best.Pop(false);
+	}
+	int32 at = Best.Num();
+	while (at > 0 && Best[at - 1].Key > distance)
+	{
+		at--;
+	}
+	Best.Insert(TPair<float, int32>(distance, index), at);
+}
+
+FControlResponseIndex::FControlResponseIndex()
+	: bSteerUsable(false)
+	, Neutral(INDEX_NONE)
+	, PositionScale(1.f)
+	, RotationScale(1.f)
+{
+	FMemory::Memzero(ThrottleDirection);
+	FMemory::Memzero(SteerDirection);
+}
+
+void FControlResponseIndex::ToCoordinates(const FTransform& relative, float* outX) const
+{
+	const FVector location = relative.GetLocation();
+	if (!Settings.bFullPose)
+	{
+		outX[0] = location.X;
+		outX[1] = location.Y;
+		outX[2] = FMath::DegreesToRadians(FRotator::NormalizeAxis(relative.Rotator().Yaw));
+		return;
+	}
+
+	// rotation vector (axis * angle, shortest way round), yaw ends up mostly in the last coordinate
+	FQuat rotation = relative.GetRotation();
+	if (rotation.W < 0.f)
+	{
+		rotation = rotation * -1.f;
+	}
+	FVector axis;
+	float angle;
+	rotation.ToAxisAndAngle(axis, angle);
+	const FVector rotationVector = axis * angle;
+	outX[0] = location.X;
+	outX[1] = location.Y;
+	outX[2] = location.Z;
+	outX[3] = rotationVector.X;
+	outX[4] = rotationVector.Y;
+	outX[5] = rotationVector.Z;
+}
+
+void FControlResponseIndex::Build(const FTransform& start, const TArray<FTransform>& ends, const TArray<FVector2D>& adjustments, int32 neutral, const FControlResponseSettings& newSettings)
+{
+	Settings = newSettings;
+	Neutral = ends.IsValidIndex(neutral) ? neutral : INDEX_NONE;
+	const int32 dimensions = GetNumDimensions();
+	const int32 positionDimensions = Settings.bFullPose ? 3 : 2;
+
+	Points.SetNumUninitialized(ends.Num());
+	for (int32 i = 0; i < ends.Num(); i++)
+	{
+		FMemory::Memzero(Points[i]);
+		ToCoordinates(ends[i].GetRelativeTransform(start), Points[i].X);
+	}
+
+	// measure from the no-adjustment response, and in spreads around it
+	FPoint origin;
+	FMemory::Memzero(origin);
+	if (Neutral != INDEX_NONE)
+	{
+		origin = Points[Neutral];
+	}
+	double positionSum = 0.0;
+	double rotationSum = 0.0;
+	for (FPoint& point : Points)
+	{
+		for (int32 d = 0; d < dimensions; d++)
+		{
+			point.X[d] -= origin.X[d];
+			(d < positionDimensions ? positionSum : rotationSum) += double(point.X[d]) * point.X[d];
+		}
+	}
+	const int32 num = FMath::Max(Points.Num(), 1);
+	PositionScale = FMath::Max(float(FMath::Sqrt(positionSum / num)), KINDA_SMALL_NUMBER);
+	RotationScale = FMath::Max(float(FMath::Sqrt(rotationSum / num)), KINDA_SMALL_NUMBER);
+	for (FPoint& point : Points)
+	{
+		for (int32 d = 0; d < dimensions; d++)
+		{
+			point.X[d] *= d < positionDimensions ? 1.f / PositionScale : Settings.RotationWeight / RotationScale;
+		}
+	}
+
+	Adjustments = adjustments;
+	Adjustments.SetNumZeroed(Points.Num());
+	FitResponseDirections();
+
+	Order.SetNumUninitialized(Points.Num());
+	for (int32 i = 0; i < Order.Num(); i++)
+	{
+		Order[i] = i;
+	}
+	SplitAxis.SetNumZeroed(Points.Num());
+	BuildRange(0, Points.Num());
+}
+
+void FControlResponseIndex::FitResponseDirections()
+{
+	// response per unit of throttle and steer adjustment (both measured from the neutral input set), least squares
+	const int32 dimensions = GetNumDimensions();
+	const FVector2D neutralInput = Neutral != INDEX_NONE ? Adjustments[Neutral] : FVector2D::ZeroVector;
+	double utu[2][2] = { { 0.0, 0.0 }, { 0.0, 0.0 } };
+	double utx[2][MAX_DIMENSIONS] = { { 0.0 } };
+	for (int32 i = 0; i < Points.Num(); i++)
+	{
+		const FVector2D u = Adjustments[i] - neutralInput;
+		utu[0][0] += u.X * u.X;
+		utu[0][1] += u.X * u.Y;
+		utu[1][1] += u.Y * u.Y;
+		for (int32 d = 0; d < dimensions; d++)
+		{
+			utx[0][d] += u.X * Points[i].X[d];
+			utx[1][d] += u.Y * Points[i].X[d];
+		}
+	}
+	FMemory::Memzero(ThrottleDirection);
+	FMemory::Memzero(SteerDirection);
+	bSteerUsable = false;
+	const double determinant = utu[0][0] * utu[1][1] - utu[0][1] * utu[0][1];
+	if (Points.Num() == 0 || determinant <= SMALL_NUMBER * FMath::Max(utu[0][0] * utu[1][1], 1e-12))
+	{
+		UE_LOG(ErrorCorrection, Warning, TEXT("Control responses: throttle and steer adjustments don't vary independently, no directed lookup"));
+		return;
+	}
+	float throttleLength = 0.f;
+	float steerLength = 0.f;
+	for (int32 d = 0; d < dimensions; d++)
+	{
+		ThrottleDirection.X[d] = float((utu[1][1] * utx[0][d] - utu[0][1] * utx[1][d]) / determinant);
+		SteerDirection.X[d] = float((utu[0][0] * utx[1][d] - utu[0][1] * utx[0][d]) / determinant);
+		throttleLength += FMath::Square(ThrottleDirection.X[d]);
+		steerLength += FMath::Square(SteerDirection.X[d]);
+	}
+	throttleLength = FMath::Sqrt(throttleLength);
+	steerLength = FMath::Sqrt(steerLength);
+
+	// steering across its recorded range has to move the response noticeably
+	const float steerEffect = steerLength * FMath::Sqrt(float(utu[1][1] / Points.Num()));
+
+	// sanity check: steer-positive inputs have to end up right of steer-negative ones, right of the throttle response
+	// (ground plane, whatever frame the mapping was recorded in)
+	const FVector2D forward(ThrottleDirection.X[0], ThrottleDirection.X[1]);
+	const FVector2D right(-forward.Y, forward.X);
+	double sideSum[2] = { 0.0, 0.0 };
+	int32 sideCount[2] = { 0, 0 };
+	for (int32 i = 0; i < Points.Num(); i++)
+	{
+		const float steer = Adjustments[i].Y - neutralInput.Y;
+		if (steer != 0.f)
+		{
+			const int32 side = steer > 0.f ? 1 : 0;
+			sideSum[side] += FVector2D::DotProduct(FVector2D(Points[i].X[0], Points[i].X[1]), right);
+			sideCount[side]++;
+		}
+	}
+	const bool bSteersRight = sideCount[0] > 0 && sideCount[1] > 0 && !forward.IsNearlyZero()
+		&& sideSum[1] / sideCount[1] > sideSum[0] / sideCount[0];
+	bSteerUsable = steerEffect >= MIN_STEER_EFFECT && bSteersRight;
+	UE_LOG(ErrorCorrection, Log, TEXT("Control responses: steering moves the response %f spreads, steer-positive inputs %s, steering lookup %s"),
+		steerEffect, bSteersRight ? TEXT("end up right") : TEXT("don't end up right"), bSteerUsable ? TEXT("on") : TEXT("off"));
+
+	for (int32 d = 0; d < dimensions; d++)
+	{
+		ThrottleDirection.X[d] = throttleLength > KINDA_SMALL_NUMBER ? ThrottleDirection.X[d] / throttleLength : 0.f;
+		SteerDirection.X[d] = steerLength > KINDA_SMALL_NUMBER ? SteerDirection.X[d] / steerLength : 0.f;
+	}
+}
+
+void FControlResponseIndex::BuildRange(int32 lo, int32 hi)
+{
+	if (hi - lo <= 1)
+	{
+		return;
+	}
+
+	// split on the widest axis, at the median
+	float widest = -1.f;
+	int32 axis = 0;
+	for (int32 d = 0; d < GetNumDimensions(); d++)
+	{
+		float minValue = MAX_flt;
+		float maxValue = -MAX_flt;
+		for (int32 i = lo; i < hi; i++)
+		{
+			const float value = Points[Order[i]].X[d];
+			minValue = FMath::Min(minValue, value);
+			maxValue = FMath::Max(maxValue, value);
+		}
+		if (maxValue - minValue > widest)
+		{
+			widest = maxValue - minValue;
+			axis = d;
+		}
+	}
+	const TArray<FPoint>& points = Points;
+	Sort(Order.GetData() + lo, hi - lo, [&points, axis](int32 a, int32 b) { return points[a].X[axis] < points[b].X[axis]; });
+
+	const int32 mid = (lo + hi) / 2;
+	SplitAxis[mid] = uint8(axis);
+	BuildRange(lo, mid);
+	BuildRange(mid + 1, hi);
+}
+
+float FControlResponseIndex::DistSquared(const float* a, const float* b) const
+{
+	float distance = 0.f;
+	for (int32 d = 0; d < GetNumDimensions(); d++)
+	{
+		distance += FMath::Square(a[d] - b[d]);
+	}
+	return distance;
+}
+
+void FControlResponseIndex::SearchRange(int32 lo, int32 hi, const float* point, FNearest& nearest) const
+{
+	if (lo >= hi)
+	{
+		return;
+	}
+	const int32 mid = (lo + hi) / 2;
+	const int32 index = Order[mid];
+	nearest.Add(DistSquared(point, Points[index].X), index);
+	if (hi - lo == 1)
+	{
+		return;
+	}
+
+	// near half first, far half only if the splitting plane is closer than the worst match so far
+	const float offset = point[SplitAxis[mid]] - Points[index].X[SplitAxis[mid]];
+	if (offset < 0.f)
+	{
+		SearchRange(lo, mid, point, nearest);
+		if (FMath::Square(offset) < nearest.Worst())
+		{
+			SearchRange(mid + 1, hi, point, nearest);
+		}
+	}
+	else
+	{
+		SearchRange(mid + 1, hi, point, nearest);
+		if (FMath::Square(offset) < nearest.Worst())
+		{
+			SearchRange(lo, mid, point, nearest);
+		}
+	}
+}
+
+void FControlResponseIndex::FindNearest(const float* point, int32 k, TArray<int32>& outIndices) const
+{
+	outIndices.Reset();
+	FNearest nearest;
+	nearest.K = FMath::Max(k, 1);
+	SearchRange(0, Points.Num(), point, nearest);
+	for (const TPair<float, int32>& match : nearest.Best)
+	{
+		outIndices.Add(match.Value);
+	}
+}
+
+void FControlResponseIndex::FindCorrection(float forward, float lateral, TArray<int32>& outIndices) const
+{
+	outIndices.Reset();
+	if (!bSteerUsable)
+	{
+		lateral = 0.f;
+	}
+	if (forward == 0.f && lateral == 0.f)
+	{
+		return;
+	}
+
+	// along the fitted responses: more throttle to go faster, more steer to end up further right
+	float point[MAX_DIMENSIONS] = { 0.f };
+	for (int32 d = 0; d < GetNumDimensions(); d++)
+	{
+		point[d] = (forward * ThrottleDirection.X[d] + lateral * SteerDirection.X[d]) * Settings.CorrectionSize;
+	}
+	if (lateral == 0.f)
+	{
+		FindNearest(point, Settings.NumNearest, outIndices);
+		return;
+	}
+
+	// only inputs steering the requested way (a near match can still come from the other side of the neutral steer)
+	TArray<int32> nearest;
+	FindNearest(point, Settings.NumNearest * 2, nearest);
+	const float neutralSteer = Neutral != INDEX_NONE ? Adjustments[Neutral].Y : 0.f;
+	for (int32 index : nearest)
+	{
+		if ((Adjustments[index].Y - neutralSteer) * lateral > 0.f && outIndices.Num() < Settings.NumNearest)
+		{
+			outIndices.Add(index);
+		}
+	}
+}
@@ -2,78 +2,37 @@
 
 #include "CopyVehicleData.h"
 
-UCopyVehicleData::UCopyVehicleData()
+void FCopyVehicleData::Capture(const AWheeledVehicle* vehicle)
 {
-	/*this->linearVelocity = new FVector;
-	this->angularVelocity = new FVector;
-	this->startPosition = FTransform::Identity;
-	this->gear = -1;
-	this->rpm = 0.f;*/
+	this->vehicleState.Capture(vehicle);
 }
 
-UCopyVehicleData* UCopyVehicleData::MAKE(FVector linear, FVector angular)
+const FVehicleStateSnapshot& FCopyVehicleData::GetVehicleState() const
 {
-	TSharedPtr<UCopyVehicleData> newvdata(NewObject<UCopyVehicleData>());
-	//UCopyVehicleData* newDatum = NewObject<UCopyVehicleData>();
-	newvdata->linearVelocity = linear;
-	newvdata->angularVelocity = angular;
-	newvdata->startPosition = FTransform::Identity;
-	newvdata->gear = -1;
-	newvdata->rpm = 0.f;
-	return newvdata.Get();
+	return this->vehicleState;
 }
 
-//NTODO: ptrs??  JK make this an initialize version.  Also get rid of those pointers (linear and angular pass by value)
-UCopyVehicleData* UCopyVehicleData::MAKE(FVector linear, FVector angular, FTransform & start, int32 currentGear, float rpm)
+FVector FCopyVehicleData::GetLinearVelocity() const
 {
-	TSharedPtr<UCopyVehicleData> newvdata(NewObject<UCopyVehicleData>()); // uses implicit constructor syntax e.g. int two(2);
-	//UCopyVehicleData* newDatum = NewObject<UCopyVehicleData>();
-	newvdata->linearVelocity = linear;
-	newvdata->angularVelocity = angular;
-	newvdata->startPosition = start;
-	newvdata->gear = currentGear;
-	newvdata->rpm = rpm;
-
-	return newvdata.Get();
-}
-
-UCopyVehicleData::~UCopyVehicleData()
-{
-
-}
-
-void UCopyVehicleData::Initialize(FVector linear, FVector angular, FTransform start, int32 currentGear, float rpm)
-{
-	this->linearVelocity = linear;
-	this->angularVelocity = angular;
-	this->startPosition = start;
-	this->gear = currentGear;
-	this->rpm = rpm;
-}
-
-//NTODO:ptrs?
-FVector UCopyVehicleData::GetLinearVelocity()
-{
-	return this->linearVelocity;
+	return this->vehicleState.GetLinearVelocity();
 }
 
-//NTODO:ptrs?
-FVector UCopyVehicleData::GetAngularVelocity()
+FVector FCopyVehicleData::GetAngularVelocity() const
 {
-	return this->angularVelocity;
+	return this->vehicleState.GetAngularVelocity();
 }
 
-FTransform UCopyVehicleData::GetStartPosition()
+FTransform FCopyVehicleData::GetStartPosition() const
 {
-	return this->startPosition;
+	return this->vehicleState.GetTransform();
 }
 
-int32 UCopyVehicleData::GetGear()
+int32 FCopyVehicleData::GetGear() const
 {
-	return this->gear;
+	return this->vehicleState.GetGear();
 }
 
-float UCopyVehicleData::GetRpm()
+float FCopyVehicleData::GetRpm() const
 {
-	return this->rpm;
+	return this->vehicleState.GetRPM();
 }
@@ -0,0 +1,213 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "GoalDistanceField.h"
+#include "Goal.h"
+#include "Engine/World.h"
+#include "Engine/LevelBounds.h"
+#include "Kismet/GameplayStatics.h"
+
+const float FGoalDistanceField::UNDRIVABLE = -MAX_flt;
+
+namespace
+{
+	/** one field per world (PIE sessions, the prediction world...), stale worlds are dropped on the next Get */
+	TMap<TWeakObjectPtr<UWorld>, TSharedPtr<FGoalDistanceField>> WorldFields;
+
+	/** rasterization cell size (cm), grown on big levels so the grid stays under MAX_CELLS */
+	const float CELL_SIZE = 100.f;
+	const int32 MAX_CELLS = 1024 * 1024;
+	const float MAX_GRADE = 0.6f;
+
+	/** traces start/end this far above/below the level bounds (cm) */
+	const float TRACE_MARGIN = 100.f;
+}
+
+const FGoalDistanceField& FGoalDistanceField::Get(UWorld* world)
+{
+	check(IsInGameThread());
+	if (TSharedPtr<FGoalDistanceField>* found = WorldFields.Find(world))
+	{
+		return **found;
+	}
+
+	for (auto it = WorldFields.CreateIterator(); it; ++it)
+	{
+		if (!it.Key().IsValid())
+		{
+			it.RemoveCurrent();
+		}
+	}
+
+	TArray<AActor*> foundActors;
+	UGameplayStatics::GetAllActorsOfClass(world, AGoal::StaticClass(), foundActors);
+	TArray<FVector> goals;
+	for (AActor* goal : foundActors)
+	{
+		goals.Add(goal->GetActorLocation());
+	}
+
+	FBox bounds = world->PersistentLevel ? ALevelBounds::CalculateLevelBounds(world->PersistentLevel) : FBox(ForceInit);
+	for (const FVector& goal : goals)
+	{
+		bounds += goal;
+	}
+
+	TSharedPtr<FGoalDistanceField> field = MakeShareable(new FGoalDistanceField());
+	if (bounds.IsValid)
+	{
+		const FVector2D size(bounds.Max.X - bounds.Min.X, bounds.Max.Y - bounds.Min.Y);
+		const float cellSize = FMath::Max(CELL_SIZE, FMath::Sqrt(size.X * size.Y / MAX_CELLS));
+		const int32 gridX = FMath::FloorToInt(size.X / cellSize) + 1;
+		const int32 gridY = FMath::FloorToInt(size.Y / cellSize) + 1;
+
+		// surface under each cell centre: static geometry only, so vehicles parked on the course don't block it
+		TArray<float> heights;
+		heights.SetNumUninitialized(gridX * gridY);
+		const FCollisionObjectQueryParams objectParams(ECC_WorldStatic);
+		const FCollisionQueryParams queryParams(FName(TEXT("GoalDistanceField")), false);
+		const float minNormalZ = 1.f / FMath::Sqrt(1.f + MAX_GRADE * MAX_GRADE);
+		for (int32 x = 0; x < gridX; x++)
+		{
+			for (int32 y = 0; y < gridY; y++)
+			{
+				const FVector2D centre(bounds.Min.X + (x + 0.5f) * cellSize, bounds.Min.Y + (y + 0.5f) * cellSize);
+				FHitResult hit;
+				const bool bHit = world->LineTraceSingleByObjectType(hit, FVector(centre, bounds.Max.Z + TRACE_MARGIN), FVector(centre, bounds.Min.Z - TRACE_MARGIN), objectParams, queryParams);
+				heights[x * gridY + y] = bHit && hit.ImpactNormal.Z >= minNormalZ ? hit.ImpactPoint.Z : UNDRIVABLE;
+			}
+		}
+		field->Build(FVector2D(bounds.Min.X, bounds.Min.Y), cellSize, gridX, gridY, heights, goals, MAX_GRADE);
+	}
+	else
+	{
+		field->Goals = goals;
+	}
+	WorldFields.Add(world, field);
+	return *field;
+}
+
+void FGoalDistanceField::Build(const FVector2D& origin, float cellSize, int32 gridX, int32 gridY, const TArray<float>& heights, const TArray<FVector>& goals, float maxGrade)
+{
+	check(heights.Num() == gridX * gridY);
+	GridOrigin = origin;
+	CellSize = FMath::Max(cellSize, 1.f);
+	GridX = gridX;
+	GridY = gridY;
+	Heights = heights;
+	Goals = goals;
+	Distances.Reset();
+	Distances.Init(MAX_flt, GridX * GridY);
+	ReachableCells = 0;
+
+	typedef TPair<float, int32> FOpenCell;
+	auto closestFirst = [](const FOpenCell& a, const FOpenCell& b) { return a.Key < b.Key; };
+	TArray<FOpenCell> open;
+
+	// every goal seeds the cell it's in, even if the goal mesh itself made it look undrivable
+	for (const FVector& goal : Goals)
+	{
+		const int32 x = FMath::FloorToInt((goal.X - GridOrigin.X) / CellSize);
+		const int32 y = FMath::FloorToInt((goal.Y - GridOrigin.Y) / CellSize);
+		if (x < 0 || x >= GridX || y < 0 || y >= GridY)
+		{
+			continue;
+		}
+		const int32 cell = x * GridY + y;
+		if (Heights[cell] == UNDRIVABLE)
+		{
+			Heights[cell] = goal.Z;
+		}
+		const float distance = FVector2D::Distance(FVector2D(goal), GridOrigin + FVector2D(x + 0.5f, y + 0.5f) * CellSize);
+		if (distance < Distances[cell])
+		{
+			Distances[cell] = distance;
+			open.HeapPush(FOpenCell(distance, cell), closestFirst);
+		}
+	}
+
+	// searching out from the goals: neighbour -> cell is driveable if the climb to cell isn't too steep
+	static const int32 DX[8] = { -1, -1, -1, 0, 0, 1, 1, 1 };
+	static const int32 DY[8] = { -1, 0, 1, -1, 1, -1, 0, 1 };
+	static const float STEP[8] = { UE_SQRT_2, 1.f, UE_SQRT_2, 1.f, 1.f, UE_SQRT_2, 1.f, UE_SQRT_2 };
+	while (open.Num() > 0)
+	{
+		FOpenCell current;
+		open.HeapPop(current, closestFirst, false);
+		const int32 cell = current.Value;
+		if (current.Key > Distances[cell])
+		{
+			continue;
+		}
+		ReachableCells++;
+
+		const int32 x = cell / GridY;
+		const int32 y = cell % GridY;
+		for (int32 i = 0; i < 8; i++)
+		{
+			const int32 nx = x + DX[i];
+			const int32 ny = y + DY[i];
+			if (nx < 0 || nx >= GridX || ny < 0 || ny >= GridY)
+			{
+				continue;
+			}
+			const int32 neighbour = nx * GridY + ny;
+			if (Heights[neighbour] == UNDRIVABLE)
+			{
+				continue;
+			}
+			const float run = STEP[i] * CellSize;
+			const float rise = Heights[cell] - Heights[neighbour];
+			if (rise > maxGrade * run)
+			{
+				continue;
+			}
+			const float distance = current.Key + FMath::Sqrt(run * run + rise * rise);
+			if (distance < Distances[neighbour])
+			{
+				Distances[neighbour] = distance;
+				open.HeapPush(FOpenCell(distance, neighbour), closestFirst);
+			}
+		}
+	}
+}
+
+float FGoalDistanceField::GetDistance(const FVector& location) const
+{
+	if (ReachableCells == 0)
+	{
+		return GetStraightLineDistance(location);
+	}
+
+	// blend the four cell centres around location, leaving out ones that can't reach a goal
+	const float fx = (location.X - GridOrigin.X) / CellSize - 0.5f;
+	const float fy = (location.Y - GridOrigin.Y) / CellSize - 0.5f;
+	const int32 x0 = FMath::FloorToInt(fx);
+	const int32 y0 = FMath::FloorToInt(fy);
+	const float tx = fx - x0;
+	const float ty = fy - y0;
+	float distance = 0.f;
+	float weight = 0.f;
+	for (int32 corner = 0; corner < 4; corner++)
+	{
+		const int32 x = x0 + (corner >> 1);
+		const int32 y = y0 + (corner & 1);
+		if (x < 0 || x >= GridX || y < 0 || y >= GridY || Distances[x * GridY + y] == MAX_flt)
+		{
+			continue;
+		}
+		const float w = ((corner >> 1) ? tx : 1.f - tx) * ((corner & 1) ? ty : 1.f - ty);
+		distance += w * Distances[x * GridY + y];
+		weight += w;
+	}
+	return weight > KINDA_SMALL_NUMBER ? distance / weight : GetStraightLineDistance(location);
+}
+
+float FGoalDistanceField::GetStraightLineDistance(const FVector& location) const
+{
+	float closest = MAX_flt;
+	for (const FVector& goal : Goals)
+	{
+		closest = FMath::Min(closest, FVector::DistXY(location, goal));
+	}
+	return closest;
+}
@@ -3,70 +3,86 @@
 #include "InputControlMapping.h"
 #include "VehicleAdv3.h"
 
-
-
-
-UInputControlMapping::UInputControlMapping()
+namespace
 {
-	
+	/* recorded by datagen runs: end rotation (pitch, yaw, roll), end position and the inputs that led there */
+	const float endROT[2090][3] = {{ -9401.712891,18006.900391,3.000702 }, { -9667.696289,17850.888672,3.000694 }, { -9675.059570,17848.451172,3.000683 }, { -9667.775391,17853.201172,3.000690 }, { -9669.627930,17852.519531,3.000786 }, { -9670.861328,17852.373047,3.000687 }, { -9672.311523,17850.535156,3.000690 }, { -9668.980469,17848.492188,3.000694 }, { -9670.876953,17851.648438,3.000683 }, { -9671.152344,17853.203125,3.000694 }, { -9672.582031,17849.156250,3.000694 }, { -9670.750000,17851.058594,3.000694 }, { -9667.563477,17852.093750,3.000679 }, { -9668.519531,17851.833984,3.000694 }, { -9671.132813,17850.285156,3.000690 }, { -9667.104492,17854.152344,3.000698 }, { -9674.438477,17848.708984,3.000698 }, { -9663.291992,17847.781250,3.000683 }, { -9668.606445,17851.417969,3.000694 }, { -9674.541992,17846.767578,3.000690 }, { -9667.433594,17853.312500,3.000694 }, { -9234.503906,18104.064453,3.003120 }, { -8487.283203,18538.466797,2.989254 }, { -7934.210938,18858.267578,9.970776 }, { -7464.692383,19128.363281,9.989273 }, { -7390.048828,19171.597656,9.976646 }, { -7321.262207,19211.337891,9.988411 }, { -6850.381836,19480.693359,9.988445 }, { -6292.965820,19804.519531,9.988064 }, { -4654.504395,20738.400391,2.917042 }, { -3164.167725,21576.673828,-3.956005 }, { -3171.682373,21572.796875,-3.300354 }, { -3184.973877,21566.705078,-2.473076 }, { -3174.550781,21579.974609,-3.168606 }, { -3172.294678,21572.431641,-3.422894 }, { -3150.582275,21587.093750,-4.813896 }, { -3191.651367,21561.414063,-2.223654 }, { -3167.716553,21578.062500,-3.748714 }, { -3176.654785,21568.160156,-3.060617 }, { -3159.377686,21581.136719,-4.242653 }, { -3181.542725,21564.994141,-2.867847 }, { -3182.554932,21561.375000,-2.576141 }, { -3164.589355,21579.212891,-3.993454 }, { -3183.172607,21567.927734,-2.463062 }, { -3158.949707,21572.599609,-4.241829 }, { -3180.101807,21569.310547,-2.728544 }, { -3164.997559,21575.429688,-4.097456 }, { -3162.351074,21578.917969,-3.958569 }, { -3180.346436,21567.109375,-2.735979 }, { -3174.838379,21568.380859,-3.096825 }, { -6583.027344,19638.623047,9.988319 }, { -6587.518555,19635.062500,9.987923 }, { -6586.527832,19635.888672,9.988358 }, { -6587.645508,19635.111328,9.988369 }, { -6585.298340,19636.476563,9.988327 }, { -6584.679199,19638.832031,9.988392 }, { -6585.373535,19635.183594,9.988319 }, { -6585.712402,19637.421875,9.988300 }, { -6581.256348,19640.175781,9.988308 }, { -6585.045898,19636.347656,9.967537 }, { -6586.583984,19635.453125,9.988354 }, { -6585.936523,19635.529297,9.987793 }, { -6586.596191,19635.000000,9.987675 }, { -6587.338379,19636.150391,9.988369 }, { -6583.987305,19635.419922,9.988281 }, { -6584.613770,19637.707031,9.987850 }, { -6586.457031,19634.810547,9.988113 }, { -6584.672363,19634.298828,9.988308 }, { -6585.799805,19632.824219,9.988838 }, { -6586.250488,19635.759766,9.988323 }, { -6586.486328,19636.318359,9.988438 }, { -6583.980957,19636.777344,9.986973 }, { -6587.907227,19636.029297,9.988079 }, { -6585.269043,19636.589844,9.988480 }, { -6584.880371,19634.162109,9.988113 }, { -6586.129395,19634.416016,9.987930 }, { -6584.866699,19634.738281,9.988365 }, { -6584.778320,19635.947266,9.988312 }, { -6583.116699,19635.476563,9.987656 }, { -6582.862793,19638.416016,9.987938 }, { -6586.535156,19634.060547,9.988350 }, { -6585.518555,19635.511719,9.988270 }, { -6587.662109,19635.039063,9.988457 }, { -6581.316895,19637.294922,9.986320 }, { -6588.282715,19634.345703,9.988338 }, { -6581.406250,19636.742188,9.987820 }, { -6586.421875,19636.179688,9.987701 }, { -6584.886230,19637.535156,9.987278 }, { -6584.967285,19633.359375,9.987930 }, { -6590.152832,19633.890625,9.987366 }, { -9673.308594,17850.105469,3.000656 }, { -9674.524414,17849.255859,3.000683 }, { -9671.777344,17850.015625,3.000694 }, { -9670.655273,17850.394531,3.000710 }, { -9668.942383,17851.308594,3.000690 }, { -9668.562500,17852.927734,3.000702 }, { -9673.222656,17849.261719,3.000690 }, { -9668.924805,17853.091797,3.000702 }, { -9676.382813,17847.945313,3.000687 }, { -9667.280273,17851.537109,3.000774 }, { -9671.358398,17849.625000,3.000698 }, { -9670.543945,17848.814453,3.000690 }, { -9673.078125,17849.464844,3.000683 }, { -9670.963867,17851.910156,3.000690 }, { -9668.668945,17852.662109,3.000683 }, { -9670.669922,17849.015625,3.000698 }, { -9669.120117,17851.541016,3.000694 }, { -9670.816406,17850.091797,3.000694 }, { -9672.951172,17846.279297,3.000698 }, { -9668.879883,17850.919922,3.000694 }, { -9670.983398,17849.093750,3.000694 }, { -9671.218750,17850.179688,3.000694 }, { -9667.536133,17850.771484,3.000702 }, { -9668.441406,17850.246094,3.000698 }, { -9666.788086,17854.099609,3.000694 }, { -9669.441406,17850.185547,3.000698 }, { -9670.406250,17848.494141,3.000694 }, { -9666.136719,17851.699219,3.000694 }, { -9671.084961,17848.984375,3.000713 }, { -9671.605469,17849.412109,3.000698 }, { -9673.269531,17848.066406,3.000687 }, { -9668.182617,17852.035156,3.000698 }, { -9669.426758,17851.826172,3.000694 }, { -9672.613281,17848.812500,3.000710 }, { -9668.568359,17851.634766,3.000721 }, { -9670.989258,17850.185547,3.000702 }, { -9671.695313,17849.044922,3.000694 }, { -9672.260742,17850.109375,3.000698 }, { -9670.528320,17850.242188,3.000729 }, { -9669.719727,17851.855469,3.000713 }, { -9673.435547,17848.578125,3.000710 }, { -9671.396484,17849.689453,3.000717 }, { -9672.250977,17849.347656,3.000690 }, { -9667.900391,17852.070313,3.000702 }, { -9673.903320,17846.923828,3.000690 }, { -9671.749023,17849.757813,3.000725 }, { -9667.636719,17854.828125,3.000687 }, { -9665.488281,17848.876953,3.000690 }, { -9672.993164,17852.261719,3.000694 }, { -9668.670898,17848.732422,3.000698 }, { -9677.189453,17846.404297,3.000713 }, { -9668.314453,17850.480469,3.000683 }, { -9670.355469,17849.031250,3.000706 }, { -9675.175781,17850.675781,3.000706 }, { -9670.567383,17849.724609,3.000683 }, { -9670.324219,17854.742188,3.000671 }, { -9675.813477,17847.021484,3.000698 }, { -9668.348633,17852.558594,3.000694 }, { -9669.952148,17850.320313,3.000694 }, { -9668.648438,17854.458984,3.000679 }, { -9672.718750,17850.966797,3.000725 }, { -9672.666992,17848.173828,3.000668 }, { -9672.594727,17850.578125,3.000687 }, { -9665.191406,17853.568359,3.000675 }, { -9673.065430,17849.433594,3.000694 }, { -9667.455078,17852.863281,3.000732 }, { -9674.308594,17847.410156,3.000694 }, { -9669.440430,17852.011719,3.000698 }, { -9669.862305,17850.923828,3.000683 }, { -9669.183594,17851.876953,3.000729 }, { -9677.001953,17848.355469,3.000683 }, { -9669.744141,17853.667969,3.000683 }, { -9669.384766,17849.791016,3.000710 }, { -9671.016602,17849.605469,3.000702 }, { -9671.142578,17850.306641,3.000698 }, { -9673.809570,17849.421875,3.000690 }, { -9669.300781,17853.087891,3.000687 }, { -9673.756836,17856.222656,3.000694 }, { -9667.710938,17847.279297,3.000694 }, { -9672.244141,17852.179688,3.000698 }, { -9669.456055,17850.542969,3.000698 }, { -9675.548828,17847.996094,3.000679 }, { -9668.964844,17851.923828,3.000679 }, { -9674.765625,17845.917969,3.000671 }, { -9670.161133,17852.181641,3.000683 }, { -9671.425781,17851.582031,3.000679 }, { -9667.402344,17850.308594,3.000687 }, { -9671.084961,17849.802734,3.000668 }, { -9670.106445,17854.816406,3.000690 }, { -9670.137695,17848.560547,3.000679 }, { -9672.785156,17850.929688,3.000683 }, { -9666.235352,17854.472656,3.000683 }, { -9675.152344,17848.876953,3.000698 }, { -9667.827148,17852.187500,3.000687 }, { -9670.638672,17852.898438,3.000679 }, { -9671.577148,17850.041016,3.000698 }, { -9669.970703,17850.015625,3.000694 }, { -9672.168945,17848.167969,3.000710 }, { -9665.262695,17852.814453,3.000710 }, { -9674.393555,17850.431641,3.000702 }, { -9670.398438,17853.001953,3.000706 }, { -9673.539063,17847.134766,3.000717 }, { -9669.569336,17851.113281,3.000687 }, { -9675.465820,17846.728516,3.000698 }, { -9669.484375,17851.820313,3.000698 }, { -9675.420898,17853.005859,3.000694 }, { -9672.426758,17849.603516,3.000713 }, { -9670.425781,17848.798828,3.000710 }, { -9667.887695,17849.435547,3.000702 }, { -9668.610352,17849.988281,3.000725 }, { -9670.608398,17850.839844,3.000698 }, { -9669.047852,17853.263672,3.000698 }, { -9676.932617,17846.572266,3.000702 }, { -9666.541992,17851.714844,3.000698 }, { -9670.632813,17851.173828,3.000721 }, { -9667.283203,17852.623047,3.000687 }, { -9670.377930,17850.876953,3.000698 }, { -9669.722656,17853.851563,3.000706 }, { -9673.804688,17848.003906,3.000687 }, { -9664.853516,17850.082031,3.000683 }, { -9672.533203,17849.238281,3.000740 }, { -9671.910156,17849.894531,3.000694 }, { -9669.564453,17851.578125,3.000706 }, { -9665.942383,17855.115234,3.000690 }, { -9675.313477,17848.068359,3.000694 }, { -9668.342773,17852.917969,3.000732 }, { -9672.301758,17846.324219,3.000683 }, { -9673.383789,17850.177734,3.000664 }, { -9671.535156,17849.566406,3.000690 }, { -9671.346680,17849.158203,3.000690 }, { -9666.469727,17853.349609,3.000713 }, { -9669.470703,17847.767578,3.000694 }, { -9672.996094,17854.841797,3.000694 }, { -9669.368164,17852.148438,3.000710 }, { -9665.288086,17854.027344,3.000713 }, { -9673.071289,17850.330078,3.000698 }, { -9675.062500,17846.839844,3.000698 }, { -9669.152344,17848.873047,3.000698 }, { -9668.611328,17849.978516,3.000690 }, { -9668.268555,17848.001953,3.000706 }, { -9670.612305,17851.968750,3.000702 }, { -9674.225586,17848.474609,3.000675 }, { -9672.853516,17849.074219,3.000706 }, { -9667.310547,17850.814453,3.000698 }, { -9672.600586,17848.607422,3.000690 }, { -9665.831055,17849.154297,3.000698 }, { -9665.787109,17856.160156,3.000683 }, { -9671.133789,17852.218750,3.000698 }, { -9677.777344,17846.880859,3.000713 }, { -9669.442383,17851.464844,3.000694 }, { -9670.165039,17847.851563,3.000702 }, { -9674.963867,17851.753906,3.000702 }, { -9669.854492,17847.591797,3.000706 }, { -9671.301758,17853.185547,3.000668 }, { -9667.763672,17851.216797,3.000694 }, { -9673.283203,17850.400391,3.000683 }, { -9667.238281,17853.673828,3.000713 }, { -9677.327148,17849.140625,3.000725 }, { -9668.852539,17852.351563,3.000706 }, { -9678.616211,17845.792969,3.000706 }, { -9666.142578,17855.945313,3.000710 }, { -9672.680664,17849.193359,3.000729 }, { -9670.308594,17848.888672,3.000725 }, { -9671.167969,17847.535156,3.000710 }, { -9676.551758,17846.429688,3.000713 }, { -9675.558594,17849.705078,3.000710 }, { -9667.676758,17852.892578,3.000671 }, { -9677.049805,17845.523438,3.000683 }, { -9668.977539,17852.109375,3.000668 }, { -9674.706055,17853.384766,3.000664 }, { -9673.627930,17849.992188,3.000690 }, { -9676.518555,17848.707031,3.000679 }, { -9668.126953,17854.708984,3.000694 }, { -9673.543945,17848.888672,3.000694 }, { -9675.372070,17847.683594,3.000679 }, { -9673.805664,17847.503906,3.000668 }, { -9665.710938,17856.562500,3.000675 }, { -9673.101563,17846.191406,3.000656 }, { -9667.353516,17853.537109,3.000664 }, { -9669.073242,17850.898438,3.000694 }, { -9673.869141,17849.136719,3.000725 }, { -9668.619141,17849.935547,3.000687 }, { -9672.765625,17849.330078,3.000687 }, { -9671.117188,17851.474609,3.000702 }, { -9668.353516,17849.208984,3.000668 }, { -9668.994141,17855.035156,3.000710 }, { -9672.231445,17848.886719,3.000702 }, { -9664.211914,17850.107422,3.000706 }, { -9675.043945,17848.359375,3.000713 }, { -9667.729492,17852.037109,3.000694 }, { -9669.524414,17849.251953,3.000698 }, { -9668.397461,17852.250000,3.000690 }, { -9672.500000,17848.240234,3.000702 }, { -9670.222656,17852.609375,3.000713 }, { -9670.428711,17851.326172,3.000706 }, { -9676.416992,17848.919922,3.000702 }, { -9668.207031,17851.771484,3.000694 }, { -9674.912109,17847.931641,3.000698 }, { -9667.125977,17854.296875,3.000717 }, { -9674.073242,17849.566406,3.000690 }, { -9667.970703,17849.251953,3.000694 }, { -9677.463867,17847.478516,3.000671 }, { -9668.732422,17848.740234,3.000706 }, { -9675.983398,17847.306641,3.000702 }, { -9673.144531,17848.853516,3.000732 }, { -9670.007813,17851.253906,3.000694 }, { -9662.784180,17848.757813,3.000713 }, { -9676.463867,17847.142578,3.000698 }, { -9665.583984,17850.689453,3.000690 }, { -9675.275391,17849.927734,3.000679 }, { -9671.129883,17852.535156,3.000675 }, { -9668.955078,17849.972656,3.000710 }, { -9667.586914,17854.869141,3.000675 }, { -9675.626953,17847.232422,3.000683 }, { -9673.349609,17848.953125,3.000671 }, { -9665.908203,17853.556641,3.000679 }, { -9677.893555,17845.232422,3.000668 }, { -9673.253906,17851.351563,3.000710 }, { -9662.574219,17849.361328,3.000660 }, { -9674.076172,17850.095703,3.000702 }, { -9670.375000,17849.513672,3.000706 }, { -9672.282227,17848.162109,3.000710 }, { -9671.554688,17851.201172,3.000683 }, { -9670.833008,17850.724609,3.000706 }, { -9672.023438,17847.925781,3.000687 }, { -9674.070313,17850.669922,3.000698 }, { -9668.462891,17850.847656,3.000679 }, { -9669.963867,17849.441406,3.000698 }, { -9673.991211,17847.701172,3.000694 }, { -9675.902344,17847.283203,3.000717 }, { -9669.906250,17851.957031,3.000702 }, { -9670.362305,17850.714844,3.000698 }, { -9671.337891,17851.798828,3.000702 }, { -9671.858398,17854.634766,3.000706 }, { -9674.706055,17846.013672,3.000690 }, { -9669.266602,17850.572266,3.000721 }, { -9673.988281,17848.628906,3.000698 }, { -9672.201172,17849.517578,3.000698 }, { -9668.372070,17851.875000,3.000702 }, { -9673.307617,17843.476563,3.000710 }, { -9669.966797,17850.619141,3.000694 }, { -9670.042969,17852.943359,3.000648 }, { -9671.891602,17849.207031,3.000694 }, { -9672.903320,17850.369141,3.000683 }, { -9671.362305,17851.072266,3.000698 }, { -9670.007813,17852.429688,3.000698 }, { -9674.969727,17848.218750,3.000706 }, { -9669.875000,17848.498047,3.000687 }, { -9672.174805,17849.542969,3.000690 }, { -9668.628906,17847.638672,3.000702 }, { -9671.113281,17848.853516,3.000675 }, { -9675.664063,17847.806641,3.000702 }, { -9667.293945,17851.228516,3.000702 }, { -9672.550781,17855.646484,3.000694 }, { -9669.472656,17850.671875,3.000698 }, { -9666.735352,17851.701172,3.000710 }, { -9671.165039,17848.470703,3.000694 }, { -9669.685547,17851.785156,3.000706 }, { -9673.768555,17849.818359,3.000690 }, { -9670.097656,17851.177734,3.000706 }, { -9669.942383,17849.732422,3.000671 }, { -9670.945313,17850.759766,3.000683 }, { -9671.722656,17848.892578,3.000706 }, { -9668.287109,17852.396484,3.000683 }, { -9673.106445,17851.375000,3.000690 }, { -9668.728516,17851.214844,3.000687 }, { -9673.574219,17850.443359,3.000694 }, { -9672.564453,17845.525391,3.000687 }, { -9663.741211,17853.716797,3.000656 }, { -9673.282227,17849.113281,3.000771 }, { -9669.844727,17849.031250,3.000725 }, { -9662.203125,17846.064453,3.000652 }, { -9676.445313,17846.886719,3.000698 }, { -9663.807617,17851.130859,3.000690 }, { -9678.557617,17845.919922,3.000683 }, { -9672.163086,17849.863281,3.000679 }, { -9668.521484,17851.677734,3.000675 }, { -9671.239258,17849.541016,3.000702 }, { -9666.798828,17851.703125,3.000690 }, { -9673.886719,17852.080078,3.000668 }, { -9671.549805,17850.384766,3.000702 }, { -9673.741211,17848.933594,3.000698 }, { -9670.213867,17851.996094,3.000683 }, { -9668.179688,17851.683594,3.000710 }, { -9677.155273,17846.535156,3.000694 }, { -9668.525391,17851.638672,3.000683 }, { -9673.194336,17848.369141,3.000702 }, { -9670.656250,17849.468750,3.000694 }, { -9668.727539,17850.074219,3.000698 }, { -9671.443359,17851.060547,3.000713 }, { -9670.721680,17848.974609,3.000694 }, { -9667.378906,17854.619141,3.000671 }, { -9671.515625,17848.669922,3.000713 }, { -9668.856445,17852.941406,3.000683 }, { -9672.633789,17851.271484,3.000690 }, { -9667.206055,17851.716797,3.000702 }, { -9672.777344,17848.669922,3.000694 }, { -9673.155273,17848.597656,3.000675 }, { -9674.205078,17848.218750,3.000687 }, { -9667.232422,17851.667969,3.000721 }, { -9667.018555,17850.242188,3.000710 }, { -9676.346680,17847.107422,3.000706 }, { -9666.392578,17851.447266,3.000679 }, { -9672.215820,17847.626953,3.000694 }, { -9670.711914,17850.830078,3.000702 }, { -9669.652344,17850.296875,3.000713 }, { -9667.347656,17849.660156,3.000690 }, { -9673.271484,17848.291016,3.000713 }, { -9673.267578,17850.412109,3.000675 }, { -9668.241211,17851.517578,3.000702 }, { -9677.639648,17847.978516,3.000706 }, { -9668.629883,17851.373047,3.000671 }, { -9670.539063,17850.406250,3.000706 }, { -9665.676758,17853.494141,3.000690 }, { -9676.392578,17848.734375,3.000706 }, { -9668.633789,17854.017578,3.000690 }, { -9673.077148,17848.335938,3.000706 }, { -9668.302734,17852.660156,3.000687 }, { -9671.707031,17849.205078,3.000687 }, { -9671.334961,17848.720703,3.000698 }, { -9670.318359,17852.339844,3.000702 }, { -9671.013672,17849.695313,3.000675 }, { -9672.855469,17850.501953,3.000710 }, { -9675.384766,17846.146484,3.000694 }, { -9671.250000,17849.949219,3.000706 }, { -9672.168945,17849.078125,3.000675 }, { -9666.696289,17852.992188,3.000694 }, { -9672.476563,17855.740234,3.000675 }, { -9675.914063,17847.382813,3.000687 }, { -9665.762695,17851.769531,3.000683 }, { -9673.606445,17850.072266,3.000683 }, { -9669.560547,17851.691406,3.000694 }, { -9671.642578,17851.472656,3.000706 }, { -9668.967773,17849.986328,3.000694 }, { -9670.103516,17855.490234,3.000679 }, { -9667.358398,17851.152344,3.000706 }, { -9673.416992,17850.869141,3.000698 }, { -9673.724609,17850.324219,3.000702 }, { -9673.369141,17849.474609,3.000664 }, { -9673.052734,17849.851563,3.000687 }, { -9671.815430,17850.125000,3.000694 }, { -9671.138672,17849.818359,3.000694 }, { -9675.902344,17849.744141,3.000687 }, { -9667.745117,17850.509766,3.000710 }, { -9666.586914,17853.152344,3.000690 }, { -9673.932617,17853.212891,3.000706 }, { -9671.613281,17850.312500,3.000698 }, { -9671.096680,17850.544922,3.000694 }, { -9666.650391,17854.824219,3.000717 }, { -9676.900391,17847.000000,3.000702 }, { -9667.644531,17851.076172,3.000713 }, { -9669.347656,17850.935547,3.000698 }, { -9667.200195,17851.298828,3.000713 }, { -9671.353516,17852.062500,3.000698 }, { -9669.999023,17850.611328,3.000706 }, { -9672.373047,17849.441406,3.000683 }, { -9670.637695,17850.376953,3.000706 }, { -9671.944336,17851.732422,3.000694 }, { -9672.362305,17848.822266,3.000690 }, { -9673.275391,17851.583984,3.000694 }, { -9673.279297,17854.988281,3.000694 }, { -9669.432617,17851.365234,3.000694 }, { -9674.897461,17847.710938,3.000679 }, { -9665.582031,17853.447266,3.000729 }, { -9673.957031,17846.431641,3.000710 }, { -9667.538086,17851.808594,3.000690 }, { -9666.201172,17856.501953,3.000698 }, { -9671.415039,17851.089844,3.000706 }, { -9674.248047,17849.923828,3.000687 }, { -9671.004883,17848.667969,3.000690 }, { -9671.676758,17849.880859,3.000713 }, { -9671.944336,17848.466797,3.000698 }, { -9667.951172,17851.865234,3.000710 }, { -9672.253906,17849.167969,3.000687 }, { -9667.784180,17850.558594,3.000694 }, { -9675.155273,17847.367188,3.000690 }, { -9666.701172,17851.414063,3.000687 }, { -9672.285156,17847.828125,3.000690 }, { -9672.169922,17846.675781,3.000717 }, { -9671.821289,17849.912109,3.000729 }, { -9669.596680,17856.156250,3.000702 }, { -9677.050781,17846.574219,3.000648 }, { -9674.862305,17847.734375,3.000710 }, { -9669.386719,17851.550781,3.000698 }, { -9668.419922,17850.878906,3.000687 }, { -9666.548828,17849.535156,3.000706 }, { -9670.502930,17845.570313,3.000683 }, { -9668.011719,17851.910156,3.000694 }, { -9673.315430,17848.552734,3.000694 }, { -9675.158203,17849.158203,3.000690 }, { -9672.708984,17846.179688,3.000690 }, { -9667.436523,17851.152344,3.000687 }, { -9676.031250,17848.361328,3.000706 }, { -9667.822266,17850.921875,3.000694 }, { -9676.883789,17848.345703,3.000698 }, { -9669.374023,17851.083984,3.000710 }, { -9675.964844,17847.351563,3.000710 }, { -9669.949219,17846.962891,3.000690 }, { -9672.838867,17849.138672,3.000702 }, { -9674.738281,17848.705078,3.000702 }, { -9664.802734,17851.623047,3.000690 }, { -9673.456055,17849.433594,3.000694 }, { -9669.579102,17851.021484,3.000702 }, { -9669.266602,17849.083984,3.000702 }, { -9670.291992,17852.980469,3.000694 }, { -9673.396484,17847.908203,3.000706 }, { -9670.192383,17847.322266,3.000702 }, { -9674.462891,17852.406250,3.000698 }, { -9665.814453,17851.582031,3.000702 }, { -9673.134766,17848.917969,3.000694 }, { -9672.216797,17850.691406,3.000732 }, { -9667.082031,17855.224609,3.000679 }, { -9672.323242,17849.990234,3.000706 }, { -9671.225586,17852.025391,3.000690 }, { -9670.102539,17850.613281,3.000698 }, { -9670.474609,17850.291016,3.000698 }, { -9670.410156,17853.750000,3.000698 }, { -9675.976563,17848.152344,3.000660 }, { -9644.737305,17863.365234,3.000713 }, { -9531.089844,17928.218750,3.000690 }, { -9587.025391,17900.931641,3.000618 }, { -9658.419922,17857.947266,3.000675 }, { -9671.000977,17851.281250,3.000690 }, { -9665.541016,17854.531250,3.000690 }, { -9671.152344,17850.156250,3.000687 }, { -9673.190430,17850.515625,3.000694 }, { -9676.500977,17847.093750,3.000675 }, { -9666.085938,17851.417969,3.000694 }, { -9671.431641,17850.910156,3.000690 }, { -9672.944336,17848.671875,3.000690 }, { -9669.953125,17851.611328,3.000702 }, { -9670.006836,17852.695313,3.000702 }, { -9670.786133,17850.375000,3.000694 }, { -9672.339844,17849.533203,3.000706 }, { -9676.481445,17848.107422,3.000694 }, { -9670.305664,17850.056641,3.000687 }, { -9671.315430,17850.197266,3.000683 }, { -9670.833008,17849.806641,3.000694 }, { -9672.902344,17849.558594,3.000713 }, { -9671.483398,17849.859375,3.000706 }, { -9674.021484,17848.501953,3.000675 }, { -9669.552734,17850.101563,3.000702 }, { -9665.910156,17850.712891,3.000694 }, { -9669.825195,17847.841797,3.000687 }, { -9672.504883,17850.134766,3.000698 }, { -9668.795898,17850.517578,3.000706 }, { -9669.484375,17850.699219,3.000687 }, { -9672.919922,17849.498047,3.000706 }, { -9670.196289,17851.535156,3.000683 }, { -9670.714844,17850.007813,3.000702 }, { -9672.202148,17850.187500,3.000698 }, { -9666.561523,17852.339844,3.000690 }, { -9671.827148,17849.447266,3.000698 }, { -9668.588867,17851.720703,3.000706 }, { -9674.811523,17848.068359,3.000694 }, { -9670.255859,17850.630859,3.000690 }, { -9672.263672,17849.492188,3.000683 }, { -9668.037109,17852.185547,3.000687 }, { -9670.443359,17851.474609,3.000698 }, { -9671.583984,17849.855469,3.000687 }, { -9672.057617,17851.757813,3.000702 }, { -9671.201172,17851.435547,3.000687 }, { -9672.615234,17848.609375,3.000683 }, { -9671.054688,17852.478516,3.000683 }, { -9669.823242,17851.826172,3.000702 }, { -9672.908203,17850.150391,3.000702 }, { -9671.776367,17850.656250,3.000687 }, { -9671.061523,17850.126953,3.000694 }, { -9670.265625,17850.236328,3.000683 }, { -9673.405273,17848.388672,3.000690 }, { -9672.606445,17850.539063,3.000706 }, { -9670.245117,17851.779297,3.000702 }, { -9670.469727,17849.974609,3.000698 }, { -9666.248047,17852.980469,3.000702 }, { -9669.043945,17850.962891,3.000694 }, { -9674.080078,17847.445313,3.000702 }, { -9666.047852,17854.496094,3.000706 }, { -9674.602539,17847.808594,3.000694 }, { -9670.784180,17849.535156,3.000687 }, { -9668.925781,17850.986328,3.000687 }, { -9673.194336,17848.556641,3.000694 }, { -9667.180664,17854.621094,3.000694 }, { -9674.036133,17848.505859,3.000683 }, { -9669.887695,17848.050781,3.000690 }, { -9672.854492,17849.285156,3.000687 }, { -9673.568359,17849.136719,3.000706 }, { -9673.536133,17848.666016,3.000717 }, { -9669.044922,17849.121094,3.000694 }, { -9669.263672,17850.826172,3.000694 }, { -9675.586914,17846.416016,3.000694 }, { -9671.577148,17851.181641,3.000694 }, { -9670.332031,17851.191406,3.000687 }, { -9669.061523,17852.326172,3.000702 }, { -9671.305664,17850.310547,3.000702 }, { -9670.288086,17849.691406,3.000710 }, { -9671.918945,17846.978516,3.000683 }, { -9671.594727,17851.224609,3.000679 }, { -9668.396484,17850.572266,3.000660 }, { -9672.414063,17847.804688,3.000694 }, { -9668.734375,17849.859375,3.000690 }, { -9672.927734,17848.908203,3.000690 }, { -9667.161133,17850.195313,3.000698 }, { -9677.318359,17845.880859,3.000683 }, { -9672.493164,17848.685547,3.000683 }, { -9669.035156,17850.082031,3.000694 }, { -9669.189453,17853.367188,3.000698 }, { -9673.553711,17848.583984,3.000706 }, { -9660.173828,17851.117188,3.000710 }, { -9675.891602,17847.599609,3.000683 }, { -9670.554688,17851.984375,3.000683 }, { -9671.376953,17850.779297,3.000706 }, { -9665.949219,17849.175781,3.000690 }, { -9669.041016,17848.679688,3.000706 }, { -9670.579102,17849.406250,3.000687 }, { -9662.207031,17852.128906,3.000683 }, { -9676.884766,17845.628906,3.000698 }, { -9669.178711,17850.464844,3.000687 }, { -9677.935547,17847.437500,3.000698 }, { -9671.257813,17850.119141,3.000694 }, { -9670.311523,17849.414063,3.000702 }, { -9669.442383,17849.351563,3.000706 }, { -9673.673828,17851.210938,3.000679 }, { -9664.821289,17853.068359,3.000713 }, { -9674.206055,17846.576172,3.000694 }, { -9674.332031,17848.365234,3.000687 }, { -9667.237305,17850.726563,3.000690 }, { -9676.995117,17846.791016,3.000702 }, { -9673.966797,17849.423828,3.000694 }, { -9670.602539,17847.625000,3.000698 }, { -9671.514648,17850.277344,3.000706 }, { -9676.157227,17847.511719,3.000679 }, { -9671.940430,17849.214844,3.000683 }, { -9672.301758,17848.091797,3.000679 }, { -9674.531250,17849.048828,3.000698 }, { -9672.693359,17849.814453,3.000710 }, { -9673.870117,17850.917969,3.000687 }, { -9670.681641,17851.421875,3.000679 }, { -9675.105469,17847.796875,3.000683 }, { -9667.188477,17852.123047,3.000664 }, { -9671.961914,17850.501953,3.000687 }, { -9673.569336,17847.712891,3.000694 }, { -9671.064453,17849.029297,3.000683 }, { -9671.142578,17849.937500,3.000683 }, { -9665.380859,17849.308594,3.000698 }, { -9674.171875,17850.939453,3.000687 }, { -9666.332031,17853.357422,3.000694 }, { -9667.265625,17848.580078,3.000671 }, { -9671.459961,17851.183594,3.000690 }, { -9672.674805,17851.806641,3.000702 }, { -9672.403320,17849.367188,3.000690 }, { -9667.248047,17853.638672,3.000675 }, { -9673.100586,17849.433594,3.000683 }, { -9670.115234,17850.078125,3.000698 }, { -9674.082031,17852.068359,3.000710 }, { -9671.859375,17850.701172,3.000698 }, { -9670.617188,17850.746094,3.000698 }, { -9672.146484,17850.107422,3.000683 }, { -9673.243164,17852.886719,3.000690 }, { -9672.052734,17849.964844,3.000706 }, { -9673.673828,17848.585938,3.000725 }, { -9669.120117,17848.238281,3.000679 }, { -9670.011719,17852.796875,3.000698 }, { -9675.610352,17847.533203,3.000671 }, { -9667.675781,17852.343750,3.000687 }, { -9676.111328,17846.058594,3.000694 }, { -9665.404297,17855.527344,3.000690 }, { -9673.273438,17852.373047,3.000694 }, { -9671.485352,17851.289063,3.000694 }, { -9664.016602,17853.330078,3.000687 }, { -9668.759766,17852.906250,3.000702 }, { -9664.516602,17847.632813,3.000690 }, { -9674.079102,17848.939453,3.000683 }, { -9672.354492,17845.308594,3.000694 }, { -9670.991211,17848.449219,3.000702 }, { -9673.335938,17847.398438,3.000690 }, { -9665.424805,17856.111328,3.000694 }, { -9674.083984,17844.863281,3.000687 }, { -9670.701172,17854.027344,3.000694 }, { -9676.980469,17846.425781,3.000687 }, { -9671.232422,17850.103516,3.000690 }, { -9670.488281,17852.367188,3.000698 }, { -9668.237305,17853.556641,3.000679 }, { -9673.204102,17848.361328,3.000694 }, { -9670.464844,17853.021484,3.000702 }, { -9669.177734,17853.587891,3.000710 }, { -9674.934570,17849.318359,3.000690 }, { -9669.039063,17850.054688,3.000683 }, { -9671.108398,17848.222656,3.000690 }, { -9672.340820,17849.431641,3.000698 }, { -9667.014648,17852.894531,3.000690 }, { -9673.366211,17849.294922,3.000687 }, { -9670.668945,17851.869141,3.000694 }, { -9669.061523,17849.550781,3.000690 }, { -9674.492188,17848.169922,3.000687 }, { -9674.187500,17848.472656,3.000687 }, { -9668.245117,17851.501953,3.000702 }, { -9673.368164,17848.914063,3.000690 }, { -9669.702148,17852.056641,3.000690 }, { -9667.910156,17847.150391,3.000698 }, { -9672.965820,17849.634766,3.000690 }, { -9668.309570,17851.718750,3.000698 }, { -9672.152344,17850.935547,3.000690 }, { -9672.666016,17849.134766,3.000687 }, { -9672.449219,17847.253906,3.000694 }, { -9668.958008,17854.033203,3.000687 }, { -9669.805664,17856.072266,3.000679 }, { -9672.398438,17851.927734,3.000706 }, { -9672.971680,17849.230469,3.000687 }, { -9671.740234,17852.474609,3.000698 }, { -9668.287109,17850.980469,3.000698 }, { -9674.067383,17850.373047,3.000702 }, { -9665.654297,17850.916016,3.000687 }, { -9675.170898,17847.150391,3.000702 }, { -9667.753906,17852.296875,3.000702 }, { -9670.991211,17849.882813,3.000690 }, { -9672.029297,17853.980469,3.000683 }, { -9669.065430,17852.031250,3.000698 }, { -9673.264648,17849.363281,3.000690 }, { -9673.419922,17848.962891,3.000706 }, { -9670.816406,17851.548828,3.000683 }, { -9666.899414,17852.693359,3.000694 }, { -9668.234375,17851.851563,3.000698 }, { -9666.170898,17852.183594,3.000694 }, { -9672.875977,17840.980469,3.000687 }, { -9670.925781,17850.259766,3.000698 }, { -9662.245117,17852.433594,3.000694 }, { -9674.872070,17850.876953,3.000687 }, { -9671.827148,17849.623047,3.000698 }, { -9668.030273,17853.484375,3.000683 }, { -9676.872070,17849.488281,3.000698 }, { -9668.318359,17848.828125,3.000679 }, { -9669.350586,17852.025391,3.000710 }, { -9668.936523,17848.257813,3.000694 }, { -9673.464844,17848.843750,3.000698 }, { -9669.419922,17850.316406,3.000694 }, { -9677.749023,17845.929688,3.000683 }, { -9668.894531,17851.148438,3.000687 }, { -9673.691406,17849.169922,3.000694 }, { -9669.500000,17851.292969,3.000687 }, { -9663.264648,17852.160156,3.000706 }, { -9675.216797,17846.687500,3.000706 }, { -9669.411133,17852.017578,3.000671 }, { -9672.230469,17850.269531,3.000702 }, { -9673.050781,17849.070313,3.000713 }, { -9674.753906,17849.068359,3.000732 }, { -9668.479492,17846.414063,3.000694 }, { -9667.964844,17855.943359,3.000687 }, { -9675.231445,17847.208984,3.000694 }, { -9667.521484,17849.080078,3.000713 }, { -9669.393555,17848.341797,3.000698 }, { -9667.234375,17850.777344,3.000694 }, { -9673.923828,17849.425781,3.000702 }, { -9672.265625,17849.259766,3.000690 }, { -9666.922852,17849.511719,3.000683 }, { -9676.721680,17846.136719,3.000713 }, { -9673.893555,17850.445313,3.000683 }, { -9674.180664,17848.984375,3.000690 }, { -9669.874023,17849.750000,3.000687 }, { -9669.146484,17850.968750,3.000690 }, { -9676.298828,17847.509766,3.000690 }, { -9667.728516,17853.937500,3.000698 }, { -9673.875000,17848.496094,3.000702 }, { -9667.044922,17851.722656,3.000683 }, { -9676.858398,17846.316406,3.000690 }, { -9669.161133,17853.128906,3.000694 }, { -9673.834961,17851.527344,3.000679 }, { -9677.657227,17844.998047,3.000694 }, { -9667.955078,17850.238281,3.000702 }, { -9667.047852,17852.142578,3.000679 }, { -9674.281250,17851.404297,3.000675 }, { -9672.547852,17850.515625,3.000675 }, { -9671.232422,17852.160156,3.000690 }, { -9672.517578,17847.792969,3.000698 }, { -9672.128906,17851.248047,3.000694 }, { -9666.169922,17850.449219,3.000694 }, { -9672.171875,17849.621094,3.000690 }, { -9672.541016,17850.734375,3.000694 }, { -9672.741211,17848.830078,3.000690 }, { -9672.713867,17849.210938,3.000725 }, { -9674.875000,17847.406250,3.000687 }, { -9665.666016,17855.210938,3.000690 }, { -9673.149414,17849.753906,3.000683 }, { -9669.368164,17855.242188,3.000690 }, { -9669.243164,17850.919922,3.000698 }, { -9672.104492,17851.689453,3.000698 }, { -9670.555664,17850.082031,3.000698 }, { -9667.319336,17850.636719,3.000690 }, { -9668.387695,17852.080078,3.000702 }, { -9672.028320,17851.218750,3.000690 }, { -9674.672852,17847.894531,3.000675 }, { -9670.369141,17847.111328,3.000706 }, { -9670.489258,17850.169922,3.000698 }, { -9671.457031,17849.343750,3.000698 }, { -9675.950195,17847.322266,3.000706 }, { -9671.916992,17848.238281,3.000690 }, { -9672.559570,17848.259766,3.000710 }, { -9667.363281,17851.255859,3.000694 }, { -9673.241211,17850.175781,3.000687 }, { -9670.119141,17853.478516,3.000690 }, { -9669.633789,17846.023438,3.000690 }, { -9671.123047,17849.552734,3.000702 }, { -9673.847656,17848.751953,3.000683 }, { -9669.307617,17852.224609,3.000683 }, { -9666.701172,17849.863281,3.000694 }, { -9671.139648,17849.929688,3.000687 }, { -9672.929688,17850.496094,3.000706 }, { -9672.775391,17848.617188,3.000690 }, { -9672.377930,17855.908203,3.000698 }, { -9669.118164,17850.933594,3.000694 }, { -9667.268555,17853.914063,3.000702 }, { -9673.981445,17849.632813,3.000698 }, { -9666.012695,17853.986328,3.000702 }, { -9676.998047,17846.314453,3.000687 }, { -9664.584961,17850.343750,3.000694 }, { -9672.935547,17848.974609,3.000702 }, { -9670.573242,17848.197266,3.000690 }, { -9666.724609,17855.568359,3.000694 }, { -9673.680664,17848.679688,3.000679 }, { -9676.917969,17846.662109,3.000690 }, { -9669.927734,17850.832031,3.000690 }, { -9668.857422,17849.531250,3.000698 }, { -9672.750977,17847.441406,3.000687 }, { -9676.215820,17847.421875,3.000694 }, { -9666.987305,17849.917969,3.000706 }, { -9671.496094,17849.087891,3.000690 }, { -9674.834961,17848.597656,3.000671 }, { -9669.691406,17850.837891,3.000702 }, { -9670.802734,17849.271484,3.000698 }, { -9674.696289,17849.259766,3.000683 }, { -9666.837891,17849.357422,3.000713 }, { -9669.252930,17851.501953,3.000687 }, { -9672.855469,17848.291016,3.000664 }, { -9671.628906,17850.460938,3.000694 }, { -9666.003906,17850.119141,3.000694 }, { -9667.435547,17848.927734,3.000687 }, { -9673.242188,17848.033203,3.000687 }, { -9667.510742,17852.781250,3.000679 }, { -9669.410156,17852.068359,3.000706 }, { -9676.232422,17846.880859,3.000687 }, { -9673.320313,17851.613281,3.000694 }, { -9668.815430,17850.167969,3.000687 }, { -9672.844727,17849.017578,3.000683 }, { -9668.961914,17852.800781,3.000713 }, { -9666.808594,17853.224609,3.000694 }, { -9672.947266,17854.845703,3.000694 }, { -9669.275391,17853.027344,3.000694 }, { -9678.088867,17845.960938,3.000690 }, { -9666.529297,17852.826172,3.000694 }, { -9673.520508,17852.546875,3.000706 }, { -9672.474609,17849.734375,3.000687 }, { -9671.828125,17851.037109,3.000690 }, { -9672.558594,17849.300781,3.000683 }, { -9667.030273,17854.058594,3.000702 }, { -9669.754883,17853.001953,3.000706 }, { -9675.722656,17845.980469,3.000690 }, { -9671.941406,17850.537109,3.000687 }, { -9670.715820,17849.472656,3.000698 }, { -9669.904297,17847.970703,3.000694 }, { -9673.456055,17849.611328,3.000675 }, { -9667.706055,17850.298828,3.000698 }, { -9671.547852,17849.949219,3.000710 }, { -9679.948242,17846.205078,3.000671 }, { -9668.864258,17855.105469,3.000702 }, { -9671.315430,17850.837891,3.000694 }, { -9673.089844,17849.458984,3.000694 }, { -9672.292969,17849.482422,3.000694 }, { -9671.720703,17852.197266,3.000687 }, { -9673.855469,17848.515625,3.000687 }, { -9673.561523,17849.072266,3.000690 }, { -9671.778320,17848.507813,3.000683 }, { -9674.140625,17851.968750,3.000694 }, { -9669.387695,17849.794922,3.000710 }, { -9671.507813,17849.220703,3.000690 }, { -9667.332031,17850.810547,3.000683 }, { -9671.132813,17849.279297,3.000698 }, { -9673.611328,17850.273438,3.000698 }, { -9667.722656,17849.794922,3.000698 }, { -9674.101563,17845.505859,3.000683 }, { -9664.272461,17855.765625,3.000675 }, { -9671.120117,17850.628906,3.000702 }, { -9677.659180,17846.851563,3.000694 }, { -9671.212891,17849.705078,3.000690 }, { -9670.561523,17850.621094,3.000683 }, { -9677.248047,17848.361328,3.000690 }, { -9672.506836,17851.246094,3.000706 }, { -9671.161133,17849.884766,3.000664 }, { -9672.219727,17846.421875,3.000698 }, { -9668.197266,17851.332031,3.000694 }, { -9673.427734,17848.039063,3.000683 }, { -9670.541016,17850.621094,3.000694 }, { -9673.177734,17849.511719,3.000698 }, { -9669.836914,17848.531250,3.000690 }, { -9668.878906,17853.847656,3.000702 }, { -9677.266602,17847.375000,3.000702 }, { -9666.523438,17850.132813,3.000679 }, { -9675.587891,17850.853516,3.000690 }, { -9672.601563,17849.802734,3.000694 }, { -9671.850586,17851.472656,3.000679 }, { -9674.940430,17850.722656,3.000706 }, { -9669.342773,17851.183594,3.000690 }, { -9675.816406,17848.677734,3.000694 }, { -9671.354492,17845.953125,3.000702 }, { -9666.566406,17855.748047,3.000690 }, { -9668.856445,17848.355469,3.000690 }, { -9666.816406,17853.513672,3.000698 }, { -9675.108398,17846.998047,3.000702 }, { -9672.380859,17852.558594,3.000694 }, { -9669.860352,17851.556641,3.000687 }, { -9673.576172,17847.791016,3.000694 }, { -9676.925781,17846.458984,3.000698 }, { -9669.648438,17851.556641,3.000687 }, { -9666.465820,17853.609375,3.000702 }, { -9672.308594,17846.433594,3.000687 }, { -9674.880859,17848.466797,3.000690 }, { -9668.699219,17853.199219,3.000702 }, { -9671.833008,17851.386719,3.000702 }, { -9664.193359,17852.957031,3.000698 }, { -9673.105469,17849.296875,3.000694 }, { -9671.302734,17851.074219,3.000698 }, { -9670.327148,17850.523438,3.000694 }, { -9674.758789,17849.996094,3.000683 }, { -9669.605469,17849.966797,3.000694 }, { -9664.721680,17855.113281,3.000694 }, { -9672.218750,17848.044922,3.000698 }, { -9675.904297,17847.656250,3.000687 }, { -9672.838867,17847.246094,3.000675 }, { -9674.846680,17850.511719,3.000679 }, { -9668.064453,17854.330078,3.000687 }, { -9670.940430,17849.826172,3.000687 }, { -9678.739258,17844.988281,3.000675 }, { -9659.812500,17854.333984,3.000668 }, { -9673.529297,17848.730469,3.000725 }, { -9671.944336,17853.654297,3.000656 }, { -9675.982422,17847.142578,3.000706 }, { -9670.166016,17849.263672,3.000622 }, { -9665.624023,17845.781250,3.000626 }, { -9674.500000,17848.703125,3.000683 }, { -9671.469727,17847.498047,3.000622 }, { -9670.665039,17849.759766,3.000694 }, { -9674.387695,17856.080078,3.000744 }, { -9230.724609,18105.013672,3.003098 }, { -9234.030273,18104.332031,3.003098 }, { -9235.132813,18102.357422,3.003105 }, { -9235.563477,18103.527344,3.003090 }, { -9238.747070,18103.652344,3.003109 }, { -9241.052734,18097.628906,3.003078 }, { -9238.632813,18100.697266,3.003109 }, { -9232.376953,18106.664063,3.003094 }, { -9232.801758,18103.603516,3.003109 }, { -9236.887695,18100.976563,3.003098 }, { -9235.500977,18110.000000,3.003136 }, { -9229.050781,18110.703125,3.003128 }, { -9243.865234,18100.054688,3.003082 }, { -9238.041016,18102.935547,3.003132 }, { -9232.225586,18105.240234,3.003128 }, { -9237.658203,18100.994141,3.003117 }, { -9237.663086,18100.939453,3.003109 }, { -9232.798828,18099.546875,3.003094 }, { -9232.742188,18102.814453,3.003117 }, { -9237.385742,18100.261719,3.003101 }, { -9236.731445,18102.181641,3.003117 }, { -9235.455078,18102.191406,3.003105 }, { -9230.263672,18103.779297,3.003113 }, { -9237.478516,18104.695313,3.003155 }, { -9232.285156,18105.626953,3.003113 }, { -9232.869141,18106.039063,3.003109 }, { -9239.307617,18102.332031,3.003105 }, { -9234.369141,18103.337891,3.003101 }, { -9236.423828,18102.378906,3.003094 }, { -9238.107422,18104.125000,3.003113 }, { -9236.941406,18103.253906,3.003109 }, { -9236.378906,18102.601563,3.003101 }, { -9237.581055,18105.234375,3.003094 }, { -9238.649414,18107.916016,3.003101 }, { -9232.321289,18104.542969,3.003120 }, { -9230.944336,18104.630859,3.003101 }, { -9234.084961,18103.564453,3.003109 }, { -9237.351563,18103.710938,3.003090 }, { -9226.620117,18110.242188,3.003120 }, { -9234.461914,18103.654297,3.003078 }, { -8482.375977,18541.119141,2.982834 }, { -8483.225586,18538.291016,2.953335 }, { -8481.956055,18536.699219,2.979191 }, { -8481.821289,18539.570313,2.988953 }, { -8483.379883,18538.363281,2.947792 }, { -8478.719727,18540.296875,2.957558 }, { -8485.864258,18537.886719,2.962246 }, { -8479.735352,18540.478516,2.953968 }, { -8481.049805,18539.970703,2.964348 }, { -8482.176758,18540.406250,2.938976 }, { -8481.048828,18539.632813,2.960022 }, { -8478.571289,18543.058594,2.973610 }, { -8485.791016,18538.207031,2.995670 }, { -8488.593750,18537.574219,2.972752 }, { -8483.982422,18539.103516,2.976887 }, { -8483.660156,18539.236328,2.965309 }, { -8479.117188,18538.496094,2.962307 }, { -8481.502930,18542.505859,2.943119 }, { -8478.012695,18542.201172,2.999935 }, { -8480.037109,18540.906250,2.979660 }, { -8485.183594,18538.683594,2.957920 }, { -8482.592773,18541.896484,2.973885 }, { -8479.997070,18540.882813,2.963211 }, { -8481.995117,18542.439453,2.952419 }, { -8477.037109,18542.082031,2.957703 }, { -8484.041016,18540.246094,2.967625 }, { -8479.447266,18543.154297,2.973820 }, { -8477.777344,18545.392578,2.955101 }, { -8477.414063,18544.289063,2.987190 }, { -8482.357422,18538.683594,2.960110 }, { -8482.422852,18539.951172,2.953968 }, { -8485.345703,18539.935547,2.935528 }, { -8482.102539,18542.933594,2.987541 }, { -8482.508789,18541.664063,2.986984 }, { -8475.790039,18542.505859,2.978046 }, { -8484.886719,18538.917969,2.945782 }, { -8487.140625,18537.966797,2.953266 }, { -8480.787109,18541.431641,2.977745 }, { -8481.951172,18541.191406,2.969997 }, { -8480.562500,18539.322266,2.989098 }, { -7916.715820,18867.775391,9.987415 }, { -7917.971191,18868.984375,9.971020 }, { -7918.207520,18867.005859,9.985027 }, { -7916.826660,18866.287109,9.970459 }, { -7915.970215,18870.292969,10.004185 }, { -7925.182617,18863.968750,9.955441 }, { -7918.287109,18865.007813,9.965305 }, { -7907.986328,18874.076172,9.955448 }, { -7914.347168,18869.498047,9.953568 }, { -7902.489258,18876.181641,9.947899 }, { -7914.300293,18871.011719,9.961971 }, { -7894.109863,18881.048828,9.943085 }, { -7894.507324,18879.083984,9.964180 }, { -7909.792969,18869.458984,9.958164 }, { -7900.216797,18877.847656,9.962864 }, { -7903.776855,18876.070313,9.954948 }, { -7892.359863,18878.886719,9.965942 }, { -7907.780762,18872.328125,9.970623 }, { -7898.973633,18876.347656,9.953751 }, { -7895.863281,18878.384766,9.956715 }, { -7895.031738,18882.269531,9.955776 }, { -7891.757813,18883.503906,9.945133 }, { -7897.076172,18879.935547,9.973045 }, { -7906.815918,18872.052734,9.945335 }, { -7903.044922,18876.263672,9.939289 }, { -7906.648926,18872.480469,10.005516 }, { -7898.694336,18877.222656,9.946663 }, { -7908.072266,18871.789063,9.943756 }, { -7900.152832,18876.875000,9.976727 }, { -7899.554688,18877.482422,9.968349 }, { -7906.693359,18872.123047,9.967731 }, { -7901.748535,18875.919922,9.957802 }, { -7895.772949,18880.898438,9.963276 }, { -7891.843750,18882.203125,9.960739 }, { -7893.964355,18881.455078,9.964718 }, { -7907.279297,18875.103516,9.956245 }, { -7902.979004,18873.277344,9.946426 }, { -7919.921387,18863.992188,9.940788 }, { -7893.506348,18882.019531,9.955078 }, { -7895.267578,18882.369141,9.954437 }, { -7466.846191,19127.070313,9.954960 }, { -7483.102051,19117.417969,9.947636 }, { -7463.952148,19129.015625,9.946972 }, { -7481.186035,19118.980469,9.964951 }, { -7466.938477,19127.644531,9.964611 }, { -7473.280762,19123.496094,9.954136 }, { -7472.278320,19124.531250,9.965298 }, { -7464.271484,19128.537109,9.938778 }, { -7463.026855,19129.740234,9.947857 }, { -7464.350098,19128.125000,9.944756 }, { -7453.507324,19134.529297,9.941692 }, { -7473.007813,19123.638672,9.938908 }, { -7464.240234,19128.822266,9.970554 }, { -7465.317871,19128.873047,9.943195 }, { -7471.944824,19124.355469,9.947685 }, { -7460.576172,19130.779297,9.953178 }, { -7464.308594,19128.628906,9.963058 }, { -7463.668457,19129.251953,10.007679 }, { -7469.075684,19125.828125,9.935940 }, { -7479.128906,19119.990234,9.976097 }, { -7471.437988,19124.714844,9.976788 }, { -7474.998535,19122.359375,9.944569 }, { -7458.405762,19131.927734,9.968647 }, { -7471.863770,19124.333984,9.943127 }, { -7473.803711,19123.234375,9.950813 }, { -7461.642578,19130.359375,9.950443 }, { -7459.958984,19131.296875,9.958931 }, { -7469.343750,19125.921875,9.943687 }, { -7469.471191,19125.851563,9.983490 }, { -7463.527832,19129.273438,9.944492 }, { -7479.063965,19120.048828,9.968227 }, { -7461.835449,19130.015625,9.968353 }, { -7470.488770,19125.511719,9.968552 }, { -7463.961914,19129.130859,9.949055 }, { -7470.664063,19125.783203,9.937912 }, { -7395.937500,19168.201172,9.950539 }, { -7395.896484,19168.224609,9.950279 }, { -7396.828613,19167.693359,9.999542 }, { -7469.702148,19125.707031,10.010719 }, { -7459.390625,19131.615234,9.944229 }, { -7390.048340,19171.597656,9.928238 }, { -7390.048340,19171.599609,9.964935 }, { -7390.048340,19171.599609,9.956795 }, { -7390.048340,19171.597656,9.957088 }, { -7390.048340,19171.599609,9.927601 }, { -7390.048340,19171.597656,9.944885 }, { -7390.048340,19171.597656,9.930672 }, { -7390.048340,19171.597656,9.955936 }, { -7390.048828,19171.597656,9.945156 }, { -7390.048340,19171.599609,9.949032 }, { -7390.048340,19171.597656,9.941662 }, { -7390.048340,19171.599609,9.933071 }, { -7390.048340,19171.599609,9.951347 }, { -7390.048340,19171.597656,9.952442 }, { -7390.048340,19171.597656,9.941284 }, { -7390.048340,19171.597656,9.962498 }, { -7390.048340,19171.599609,9.947525 }, { -7390.048340,19171.597656,9.919014 }, { -7390.048340,19171.597656,9.935833 }, { -7390.048828,19171.599609,9.930176 }, { -7390.049316,19171.597656,9.925270 }, { -7390.048828,19171.599609,9.924374 }, { -7390.048340,19171.597656,9.953720 }, { -7390.048828,19171.597656,9.934433 }, { -7390.049316,19171.597656,9.932907 }, { -7390.048340,19171.597656,9.934124 }, { -7390.048340,19171.597656,9.933025 }, { -7390.048340,19171.599609,9.929024 }, { -7390.049316,19171.597656,9.942738 }, { -7390.048340,19171.599609,9.942211 }, { -7390.048340,19171.597656,9.941265 }, { -7390.048340,19171.597656,9.934746 }, { -7390.048340,19171.597656,9.937000 }, { -7390.048340,19171.599609,9.932541 }, { -7390.048828,19171.597656,9.918640 }, { -7390.048340,19171.597656,9.951229 }, { -7390.048340,19171.597656,9.935623 }, { -7390.048340,19171.597656,9.923939 }, { -7390.048340,19171.597656,9.932442 }, { -7390.048340,19171.597656,9.944309 }, { -7312.703125,19216.318359,9.966721 }, { -7309.011719,19218.398438,9.963802 }, { -7308.842285,19218.642578,9.953907 }, { -7314.169922,19215.316406,9.941360 }, { -7303.816406,19221.681641,9.955364 }, { -7309.888184,19217.964844,9.944012 }, { -7303.115234,19221.804688,9.939629 }, { -7307.732422,19218.935547,9.953457 }, { -7305.296875,19220.419922,9.983089 }, { -7306.204102,19219.888672,9.941666 }, { -7309.750977,19218.261719,9.969097 }, { -7306.974121,19219.464844,9.940815 }, { -7293.938965,19227.128906,9.942852 }, { -7306.409668,19219.962891,9.942631 }, { -7317.573730,19213.386719,9.947502 }, { -7309.456055,19218.191406,9.947964 }, { -7317.442871,19213.443359,9.945354 }, { -7309.916504,19217.791016,9.947090 }, { -7311.774902,19217.085938,9.984344 }, { -7301.566406,19222.656250,9.944923 }, { -7320.381348,19212.033203,9.939774 }, { -7308.638672,19218.476563,9.988182 }, { -7319.159180,19212.273438,9.967777 }, { -7317.714355,19213.589844,9.942219 }, { -7314.332031,19214.957031,9.959515 }, { -7312.286133,19216.634766,9.959766 }, { -7308.160645,19218.503906,9.960842 }, { -7313.528809,19215.808594,9.946003 }, { -7311.394531,19217.109375,9.983425 }, { -7316.401367,19214.242188,9.951496 }, { -7309.101074,19218.375000,9.952225 }, { -7316.024902,19214.275391,9.961750 }, { -7312.384277,19216.154297,9.978683 }, { -7307.948242,19219.009766,9.957153 }, { -7318.715332,19213.238281,9.947231 }, { -7317.957031,19213.427734,9.945602 }, { -7312.307617,19216.511719,9.975636 }, { -7306.734375,19219.201172,9.939213 }, { -7308.715820,19218.953125,9.945866 }, { -7315.042969,19215.167969,9.962063 }, { -6871.698730,19473.083984,9.962971 }, { -6866.737305,19472.335938,9.945656 }, { -6882.653809,19463.414063,9.960976 }, { -6867.397949,19472.285156,9.970150 }, { -6874.535645,19469.023438,9.948826 }, { -6871.574219,19469.445313,9.971516 }, { -6876.465332,19469.849609,9.961559 }, { -6871.737793,19469.289063,9.951061 }, { -6872.124512,19468.478516,9.965420 }, { -6871.606445,19470.390625,9.974724 }, { -6866.946777,19473.451172,9.980572 }, { -6873.631348,19468.447266,9.975063 }, { -6887.968750,19462.148438,9.944420 }, { -6898.061035,19458.412109,9.980110 }, { -6890.604980,19457.847656,9.958462 }, { -6877.134766,19468.648438,9.983017 }, { -6889.348145,19461.570313,9.973938 }, { -6892.817871,19458.980469,9.961117 }, { -6880.612793,19464.837891,9.982414 }, { -6896.558105,19454.875000,9.951744 }, { -6879.424805,19467.111328,9.940826 }, { -6875.228516,19470.056641,9.979877 }, { -6878.449707,19466.798828,9.953106 }, { -6880.246094,19465.181641,9.936745 }, { -6873.115234,19468.976563,9.956375 }, { -6884.268066,19462.335938,9.966072 }, { -6883.386230,19463.771484,9.945763 }, { -6892.737793,19460.755859,9.946072 }, { -6881.144043,19463.277344,9.941990 }, { -6881.951660,19464.302734,9.942127 }, { -6890.379395,19460.728516,9.979916 }, { -6897.835449,19456.123047,9.964832 }, { -6879.470215,19465.505859,9.944981 }, { -6875.927734,19470.367188,9.977585 }, { -6872.579102,19471.933594,9.957642 }, { -6888.261719,19462.439453,9.960106 }, { -6871.784668,19472.599609,9.956581 }, { -6880.006348,19464.109375,9.964802 }, { -6884.437988,19464.419922,9.970333 }, { -6879.939941,19464.664063,9.976357 }, { -6298.056152,19801.679688,9.954182 }, { -6300.729492,19798.582031,9.965664 }, { -6297.797363,19803.845703,9.944241 }, { -6306.912598,19794.320313,9.961182 }, { -6303.812500,19795.917969,9.984066 }, { -6301.604004,19798.619141,9.960045 }, { -6300.121094,19803.050781,9.970051 }, { -6298.316406,19801.871094,9.952572 }, { -6315.746582,19786.460938,9.943249 }, { -6308.239746,19794.531250,9.955585 }, { -6303.016113,19793.884766,9.964237 }, { -6305.371582,19797.859375,9.960114 }, { -6305.545898,19798.021484,9.963924 }, { -6311.507324,19793.626953,9.961788 }, { -6303.854980,19799.125000,9.972618 }, { -6299.752441,19800.880859,9.975758 }, { -6295.854980,19800.496094,9.968513 }, { -6296.237793,19800.490234,9.968029 }, { -6299.420410,19800.208984,10.008118 }, { -6303.208008,19797.789063,9.944439 }, { -6303.279297,19798.503906,9.963020 }, { -6307.854980,19796.113281,9.971832 }, { -6294.779297,19803.375000,9.966080 }, { -6301.167480,19800.615234,9.960915 }, { -6305.381348,19797.269531,9.953907 }, { -6300.781250,19799.824219,9.950741 }, { -6308.648926,19795.699219,9.948109 }, { -6298.234375,19799.384766,9.976524 }, { -6298.819336,19800.039063,9.948677 }, { -6299.333008,19804.765625,9.954803 }, { -6308.006348,19797.666016,9.946999 }, { -6299.327637,19799.894531,9.937214 }, { -6305.652832,19794.615234,9.978752 }, { -6301.414551,19799.677734,9.957676 }, { -6307.940918,19794.013672,9.978348 }, { -6301.745605,19799.869141,9.948151 }, { -6298.501465,19798.677734,9.969601 }, { -6309.224609,19794.843750,9.976875 }, { -6298.465820,19800.330078,9.976601 }, { -6297.884766,19803.361328,9.958988 }, { -4666.002441,20733.304688,2.914494 }, { -4687.251953,20723.468750,2.906391 }, { -4658.450195,20732.736328,2.916824 }, { -4649.775391,20743.794922,2.922195 }, { -4659.756348,20733.902344,2.918449 }, { -4645.539063,20746.308594,2.919369 }, { -4676.023438,20727.869141,2.911209 }, { -4679.987793,20723.787109,2.909248 }, { -4672.294922,20723.792969,2.908749 }, { -4666.379395,20732.289063,2.916012 }, { -4686.843262,20725.582031,2.911263 }, { -4666.129395,20735.958984,2.918282 }, { -4649.804199,20744.486328,2.915401 }, { -4663.303711,20741.134766,2.917160 }, { -4676.435547,20730.304688,2.908764 }, { -4653.984375,20737.068359,2.917480 }, { -4654.651855,20741.062500,2.920067 }, { -4652.372559,20741.554688,2.917347 }, { -4673.876953,20729.744141,2.908440 }, { -4669.445313,20734.027344,2.911163 }, { -4673.282715,20728.283203,2.911140 }, { -4674.386230,20733.685547,2.910885 }, { -4678.917969,20724.660156,2.910393 }, { -4677.194336,20725.304688,2.910816 }, { -4661.809082,20735.013672,2.915966 }, { -4668.993164,20732.238281,2.915043 }, { -4690.547852,20720.689453,2.905777 }, { -4665.293457,20727.337891,2.911400 }, { -4657.171387,20739.798828,2.917534 }, { -4669.209961,20737.589844,2.914341 }, { -4652.873047,20749.496094,2.918079 }, { -4669.094238,20738.697266,2.912041 }, { -4643.176270,20745.513672,2.922985 }, { -4662.293945,20734.955078,2.917694 }, { -4663.055176,20734.875000,2.917469 }, { -4689.187988,20723.617188,2.909733 }, { -4651.901855,20741.041016,2.918266 }, { -4673.096680,20732.064453,2.911884 }, { -4645.847656,20743.958984,2.918076 }, { -4659.299316,20734.078125,2.917297 }, { -3206.916260,21549.587891,-1.570904 }, { -3215.850342,21541.400391,-0.800343 }, { -3186.254883,21564.634766,-2.716078 }, { -3190.423096,21561.888672,-2.455608 }, { -3163.433594,21576.476563,-3.908281 }, { -3203.183838,21566.080078,-1.332603 }, { -3227.028809,21551.369141,-0.246037 }, { -3238.649170,21540.462891,0.151684 }, { -3198.878662,21551.214844,-1.503033 }, { -3187.183594,21568.349609,-2.716061 }, { -3177.151367,21561.826172,-2.918850 }, { -3186.313721,21564.562500,-2.584139 }, { -3181.674561,21566.978516,-3.161386 }, { -3209.317627,21536.457031,-1.093060 }, { -3198.891602,21555.714844,-1.846315 }, { -3192.138672,21544.789063,-2.292250 }, { -3201.484375,21551.046875,-1.570465 }, { -3179.835693,21553.488281,-2.819637 }, { -3160.087891,21554.361328,-4.422127 }, { -3186.404297,21565.667969,-2.649380 }, { -3188.577393,21558.003906,-2.738169 }, { -3187.276123,21566.693359,-2.515341 }, { -3198.167480,21566.628906,-1.912642 }, { -3190.722412,21553.037109,-2.358721 }, { -3195.894775,21559.550781,-1.778950 }, { -3195.729004,21554.314453,-1.930754 }, { -3186.320801,21568.564453,-2.603905 }, { -3175.436035,21567.474609,-3.135798 }, { -3196.418213,21556.759766,-1.880453 }, { -3191.625732,21559.904297,-2.388138 }, { -3178.088867,21566.894531,-3.004662 }, { -3214.144287,21541.914063,-1.137157 }, { -3230.081299,21541.677734,0.030403 }, { -3173.897705,21565.369141,-3.392891 }, { -3178.854736,21563.425781,-2.974091 }, { -3195.283203,21549.478516,-1.973045 }, { -3175.633057,21571.296875,-3.070930 }, { -3171.551514,21558.503906,-3.404917 }, { -3210.990967,21548.544922,-1.376854 }, { -3199.336426,21553.136719,-1.880596 }, { -3192.487061,21567.193359,-1.987522 }, { -3215.942383,21546.039063,-1.137260 }, { -3208.622559,21546.044922,-1.381008 }, { -3193.521484,21565.349609,-1.922144 }, { -3185.435791,21563.361328,-2.716455 }, { -3213.129150,21553.136719,-1.157593 }, { -3229.678467,21541.027344,-0.204624 }, { -3216.045410,21553.777344,-1.183701 }, { -3203.575928,21555.917969,-1.295021 }, { -3228.599365,21538.349609,-0.005203 }, { -3202.600830,21561.402344,-1.719936 }, { -3160.922852,21583.123047,-4.511364 }, { -3199.591064,21555.562500,-1.399441 }, { -3199.218506,21555.375000,-1.843847 }, { -3204.940186,21550.798828,-1.251854 }, { -3197.939697,21556.615234,-1.997997 }, { -3210.137207,21552.876953,-1.101101 }, { -3190.793701,21580.841797,-2.111399 }, { -3192.115723,21564.324219,-2.180315 }, { -3215.350586,21547.826172,-1.224998 }, { -3178.701904,21571.804688,-2.985615 }, { -3216.574707,21546.978516,-0.847294 }, { -3211.955322,21552.921875,-1.101231 }, { -3196.429443,21555.285156,-1.813322 }, { -3202.660889,21559.382813,-1.481190 }, { -3203.543701,21554.998047,-1.323563 }, { -3192.383301,21558.458984,-1.987768 }, { -3214.161865,21534.500000,-1.080433 }, { -3175.591553,21569.804688,-2.854336 }, { -3196.750488,21553.248047,-1.900562 }, { -3203.892578,21550.123047,-1.466110 }, { -3165.748535,21575.263672,-4.141291 }, { -3199.211670,21549.253906,-1.426201 }, { -3189.964844,21573.248047,-2.256203 }, { -3213.146240,21547.794922,-1.079906 }, { -3197.594238,21556.230469,-1.845270 }, { -3207.477783,21552.408203,-1.316486 }, { -3216.876709,21547.943359,-0.718616 }, { -3185.983643,21562.093750,-2.795549 }, { -3172.888184,21570.410156,-2.880638 }, { -3217.429199,21548.376953,-0.693371 }, { -3216.355469,21536.857422,-0.799450 }, { -3202.703125,21554.291016,-1.383850 }, { -3199.972168,21550.500000,-1.569885 }, { -3177.279785,21570.332031,-2.985699 }, { -3194.346680,21566.214844,-1.808371 }, { -3192.191650,21561.316406,-1.950266 }, { -3203.889160,21546.675781,-1.303013 }, { -3196.428467,21556.951172,-1.972858 }, { -3192.652100,21557.326172,-1.809258 }, { -3185.729736,21563.861328,-2.628481 }, { -3172.644775,21569.246094,-2.850950 }, { -3211.850342,21544.673828,-1.122471 }, { -3166.458252,21578.599609,-3.730022 }, { -3173.741211,21559.361328,-2.985569 }, { -3199.294434,21559.019531,-1.799707 }, { -3198.978027,21563.191406,-1.899261 }, { -3203.782471,21558.455078,-1.328068 }, { -3206.763428,21552.646484,-1.529682 }, { -3215.485107,21551.195313,-1.184208 }, { -3199.687256,21550.789063,-1.467392 }, { -3202.449951,21560.863281,-1.316448 }, { -3197.104736,21562.232422,-1.845930 }, { -3202.535156,21549.634766,-1.404636 }, { -3204.734375,21556.082031,-1.382988 }, { -3200.291260,21540.824219,-1.279919 }, { -3158.686279,21581.845703,-4.424013 }, { -3212.319580,21555.587891,-1.184284 }, { -3211.525635,21566.460938,-1.069489 }, { -3205.267090,21548.457031,-1.345810 }, { -3153.503662,21568.625000,-4.775166 }, { -3183.868652,21567.986328,-2.692530 }, { -3176.066895,21561.238281,-2.858727 }, { -3178.900879,21568.601563,-2.985907 }, { -3237.202393,21539.875000,0.131886 }, { -3204.062744,21551.445313,-1.324848 }, { -3178.227295,21563.378906,-2.968382 }, { -3203.474121,21552.392578,-1.556854 }, { -3172.285156,21571.281250,-3.448078 }, { -3199.215820,21545.392578,-1.913321 }, { -3192.359619,21568.005859,-1.846510 }, { -3194.077637,21553.970703,-2.186600 }, { -3160.948730,21572.076172,-4.408079 }, { -3213.615723,21554.847656,-1.205765 }, { -3203.261230,21551.886719,-1.436646 }, { -3183.818848,21568.980469,-2.590931 }, { -3199.638184,21548.363281,-1.502995 }, { -3205.953369,21552.765625,-1.570137 }, { -3210.885010,21544.757813,-1.329803 }, { -3183.040527,21568.410156,-2.653692 }, { -3200.593750,21554.332031,-1.877314 }, { -3207.256592,21549.144531,-1.316513 }, { -3201.937500,21554.265625,-1.345543 }, { -3197.618652,21562.890625,-2.035217 }, { -3183.003174,21568.785156,-2.561665 }, { -3184.339355,21560.001953,-2.585976 }, { -3151.196045,21579.708984,-4.810833 }, { -3177.083008,21562.869141,-2.985716 }, { -3175.268555,21571.494141,-2.790413 }, { -3205.912842,21547.519531,-1.438725 }, { -3196.239258,21551.884766,-1.898920 }, { -3182.003906,21566.367188,-2.816408 }, { -3176.773193,21568.224609,-3.070570 }, { -3164.215576,21573.765625,-4.014217 }, { -3198.372070,21555.384766,-1.329350 }, { -3170.948486,21561.855469,-3.432333 }, { -3221.484375,21541.851563,-0.602760 }, { -3187.092773,21562.482422,-2.679094 }, { -3200.859375,21558.582031,-1.570492 }, { -3201.079102,21554.351563,-1.383995 }, { -3209.056641,21554.355469,-1.127506 }, { -3208.306885,21545.431641,-1.570129 }, { -3210.331055,21564.216797,-0.982491 }, { -3218.445801,21549.259766,-0.673347 }, { -3155.137695,21585.726563,-4.924675 }, { -3211.884766,21540.785156,-1.163902 }, { -3191.697021,21567.521484,-2.342926 }, { -3213.879150,21547.714844,-1.051350 }, { -3172.474609,21552.023438,-3.138784 }, { -3197.830078,21552.949219,-2.019661 }, { -3202.812256,21556.746094,-1.278450 }, { -3189.545654,21562.556641,-2.214315 }, { -3223.495605,21537.080078,-0.473064 }, { -3186.287598,21566.337891,-2.657215 }, { -3214.902344,21540.455078,-1.101395 }, { -3164.489990,21572.248047,-3.900150 }, { -3197.311279,21555.775391,-1.845757 }, { -3191.286377,21561.964844,-2.169411 }, { -3208.361572,21546.693359,-1.636398 }, { -3134.459473,21585.064453,-6.300352 }, { -3205.115723,21561.398438,-1.361984 }, { -3173.691162,21563.009766,-3.174509 }, { -3199.719238,21562.150391,-1.749634 }, { -3196.817383,21564.109375,-2.066626 }, { -3202.282227,21553.048828,-1.377586 }, { -3198.022461,21560.605469,-1.780525 }, { -3202.514648,21559.789063,-1.213150 }, { -3186.521484,21559.917969,-2.611235 }, { -3209.452881,21558.634766,-1.050415 }, { -3204.542969,21548.275391,-1.383621 }, { -3185.333740,21558.205078,-2.566624 }, { -3194.599365,21552.289063,-2.073631 }, { -3198.138916,21552.392578,-2.034264 }, { -3205.056396,21558.476563,-1.296085 }, { -3185.528320,21564.763672,-2.690384 }, { -3216.262695,21532.005859,-0.756287 }, { -3189.371338,21556.119141,-2.737160 }, { -3197.542725,21555.503906,-1.996471 }, { -3186.735352,21563.136719,-2.696743 }, { -3212.742188,21546.042969,-1.096813 }, { -3202.220459,21561.693359,-1.757351 }, { -3219.507080,21547.902344,-0.764828 }, { -3201.994141,21552.828125,-1.346825 }, { -3151.708984,21578.853516,-4.695711 }, { -3195.841309,21566.681641,-1.819607 }, { -3210.385742,21538.296875,-1.129059 }, { -3209.937500,21558.556641,-1.016163 }, { -3198.140137,21556.310547,-1.969059 }, { -3211.208252,21550.873047,-1.125683 }, { -3177.638428,21561.283203,-3.049032 }, { -3231.794434,21534.611328,-0.328381 }, { -3172.467041,21569.294922,-2.880756 }, { -3179.725586,21566.982422,-2.946316 }, { -3217.158936,21547.453125,-0.580780 }, { -3196.939697,21555.611328,-1.832458 }, { -3200.140869,21553.656250,-1.997795 }, { -3150.755859,21576.949219,-4.602747 }, { -3205.862061,21550.857422,-1.427391 }, { -3196.141113,21557.660156,-1.800119 }, { -3183.205078,21559.861328,-2.795610 }, { -3205.532715,21558.099609,-1.346760 }, { -3191.198486,21561.287109,-2.217239 }, { -3160.287354,21579.396484,-4.377090 }, { -3172.432129,21571.281250,-3.489475 }, { -3201.057129,21555.093750,-1.824642 }, { -3163.682617,21571.974609,-3.886429 }, { -3182.760498,21562.994141,-2.649376 }, { -3198.524414,21556.005859,-1.529854 }, { -3219.223633,21546.001953,-0.947548 }, { -3188.775635,21570.132813,-2.580820 }, { -3227.951660,21536.369141,-0.226765 }, { -3194.454834,21550.132813,-1.767441 }, { -3184.015137,21563.564453,-2.944666 }, { -3198.747803,21550.511719,-1.846504 }, { -3201.851074,21556.974609,-1.281586 }, { -3175.949463,21569.677734,-2.816429 }, { -3189.728271,21562.576172,-2.223417 }, { -3218.388672,21540.796875,-0.739635 }, { -3163.053467,21579.464844,-3.889568 }, { -3203.343262,21558.419922,-1.346279 }, { -3237.157227,21539.134766,0.186932 }, { -3176.899658,21575.359375,-2.906651 }, { -3197.550781,21538.675781,-2.101170 }, { -3173.533203,21568.875000,-2.813684 }, { -3208.004639,21550.431641,-1.383541 }, { -3184.265137,21560.759766,-2.678703 }, { -3168.490234,21571.394531,-3.580072 }, { -3198.525391,21564.009766,-1.831776 }, { -3149.153564,21583.011719,-4.853001 }, { -3228.840576,21544.636719,-0.096645 }, { -3189.187744,21564.083984,-2.696033 }, { -3182.315186,21573.628906,-3.062725 }, { -3191.545166,21558.689453,-2.235327 }, { -3204.068115,21554.714844,-1.190662 }, { -3186.349121,21554.263672,-2.946819 }, { -3202.078857,21556.925781,-1.758656 }, { -3231.210938,21541.566406,0.085079 }, { -3171.789551,21561.128906,-3.108431 }, { -3186.460449,21565.791016,-2.535479 }, { -3175.298828,21561.017578,-3.358257 }, { -3187.000977,21549.708984,-2.758415 }, { -3200.355469,21544.945313,-1.635914 }, { -3225.651367,21531.404297,-0.462414 }, { -3223.760254,21541.781250,-0.460342 }, { -3205.602295,21548.798828,-1.383141 }, { -3189.482666,21561.705078,-2.125296 }, { -3178.993164,21570.792969,-3.359964 }, { -3193.533691,21568.380859,-1.876085 }, { -3204.475342,21550.796875,-1.315899 }, { -3211.382324,21550.076172,-1.096252 }, { -3216.739014,21547.900391,-1.003464 }, { -3186.970703,21553.185547,-2.613678 }, { -3213.841797,21551.203125,-1.049767 }, { -3201.159668,21560.447266,-1.317215 }, { -3197.324219,21553.695313,-1.912022 }, { -3200.770508,21543.234375,-1.316494 }, { -3222.558838,21537.623047,-0.443741 }, { -3196.690918,21555.328125,-1.997810 }, { -3175.365234,21567.437500,-2.918543 }, { -3202.280762,21552.095703,-1.279976 }, { -3188.364990,21569.464844,-2.604258 }, { -3165.323730,21569.275391,-3.693491 }, { -3193.771240,21558.240234,-2.156364 }, { -3188.576416,21559.259766,-2.507980 }, { -3193.382080,21555.892578,-1.855320 }, { -3158.573242,21570.302734,-4.435532 }, { -3203.697510,21558.390625,-1.228123 }, { -3234.499756,21541.562500,0.023579 }, { -3181.608154,21562.546875,-2.879498 }, { -3208.728760,21558.265625,-1.383553 }, { -3177.018311,21558.878906,-2.963306 }, { -3206.511475,21549.414063,-1.346016 }, { -3172.903564,21559.003906,-2.851257 }, { -3174.408936,21581.173828,-3.321217 }, { -3202.796631,21556.853516,-1.479988 }, { -3200.727295,21559.640625,-1.280170 }, { -3198.386475,21562.166016,-1.182625 }, { -3205.466064,21549.880859,-1.212879 }, { -3193.908447,21566.824219,-1.770939 }, { -3194.206787,21562.992188,-1.811762 }, { -3182.619385,21561.431641,-2.648914 }, { -3202.166016,21551.705078,-1.437695 }, { -3224.242920,21545.535156,-0.468956 }, { -3201.669434,21559.529297,-1.533123 }, { -3168.178223,21574.150391,-3.696669 }, { -3196.553955,21562.539063,-1.879929 }, { -3200.636475,21554.175781,-1.558739 }, { -3199.296387,21564.718750,-1.599262 }, { -3179.025879,21569.892578,-3.214033 }, { -3194.226563,21560.632813,-1.779160 }, { -3194.858643,21552.753906,-2.087851 }, { -3201.314941,21552.607422,-1.435734 }, { -3201.408691,21553.875000,-1.532219 }, { -3240.109619,21545.119141,0.120216 }, { -3178.381348,21572.074219,-2.813267 }, { -3199.110840,21540.960938,-1.211021 }, { -3140.466309,21587.964844,-5.379688 }, { -3205.707031,21557.429688,-1.258533 }, { -3183.645752,21567.716797,-2.535202 }, { -3170.954834,21568.382813,-3.135056 }, { -3181.104980,21565.341797,-2.929895 }, { -3157.473389,21574.128906,-4.706175 }, { -3198.067383,21563.031250,-2.222651 }, { -3180.068359,21566.716797,-3.027514 }, { -3152.824219,21576.140625,-4.651424 }, { -3197.853516,21554.746094,-1.830854 }, { -3215.987793,21556.265625,-1.164093 }, { -3181.967529,21560.763672,-2.883345 }, { -3177.289795,21577.822266,-2.896547 }, { -3198.729248,21561.849609,-1.781773 }, { -3192.948975,21573.675781,-1.765339 }, { -3206.736084,21552.044922,-1.279369 }, { -3199.148926,21553.623047,-1.963568 }, { -3184.608643,21578.333984,-2.632547 }, { -3198.739014,21555.828125,-1.929928 }, { -3171.717285,21569.621094,-3.071644 }, { -3213.512695,21557.050781,-1.148006 }, { -3160.953369,21576.763672,-4.584387 }, { -3192.280518,21552.324219,-2.406969 }, { -3196.405273,21556.388672,-2.065659 }, { -3203.609863,21556.601563,-1.317280 }, { -3222.500244,21531.347656,-0.443630 }, { -3199.999756,21551.851563,-1.533257 }, { -3200.314209,21563.828125,-1.384640 }, { -3191.351318,21559.988281,-2.222383 }, { -3202.884277,21552.814453,-1.825567 }, { -3210.524902,21550.812500,-1.098007 }, { -3204.782959,21548.970703,-1.258915 }, { -3185.013184,21554.792969,-2.680719 }, { -3164.072998,21582.878906,-4.091328 }, { -3194.076904,21548.958984,-2.075220 }, { -3216.033936,21541.250000,-0.781235 }, { -3184.661621,21560.398438,-2.662369 }, { -3215.160400,21549.990234,-1.185219 }, { -3201.067871,21546.105469,-1.384037 }, { -3182.581299,21564.904297,-2.515537 }, { -3205.721924,21550.900391,-1.258125 }, { -3196.236084,21554.662109,-1.809250 }, { -3159.812012,21561.429688,-4.405750 }, { -3224.623535,21535.740234,-0.475342 }, { -3155.697998,21581.660156,-4.541462 }, { -3217.003662,21542.035156,-0.774971 }, { -3209.580811,21552.439453,-1.408009 }, { -3169.832031,21548.841797,-3.734865 }, { -3193.502197,21562.708984,-2.064245 }, { -3186.229980,21567.972656,-2.695539 }, { -3170.285645,21569.636719,-3.406591 }, { -3201.265625,21548.851563,-1.280449 }, { -3172.909180,21564.078125,-3.204325 }, { -3161.748047,21585.671875,-3.908409 }, { -3194.329346,21556.712891,-2.035000 }, { -3208.183838,21548.681641,-1.279766 }, { -3197.995117,21556.416016,-1.930384 }, { -3199.076904,21562.412109,-1.967890 }, { -3225.474121,21548.841797,-0.599537 }, { -3193.266602,21558.994141,-1.832397 }, { -3181.734619,21561.361328,-2.879332 }, { -3194.679688,21549.287109,-1.781620 }, { -3178.141113,21579.970703,-2.946815 }, { -3191.342529,21564.667969,-2.222036 }, { -3208.367188,21551.316406,-1.317078 }, { -3186.992188,21571.378906,-2.629868 }, { -3190.401611,21556.796875,-2.282253 }, { -3200.331055,21555.003906,-1.692192 }, { -3221.056396,21547.193359,-0.655792 }, { -3220.004883,21550.265625,-0.586315 }, { -3213.335693,21550.062500,-1.148071 }, { -3215.875977,21544.369141,-1.117409 }, { -3147.445801,21584.724609,-4.686901 }, { -3206.582031,21555.679688,-1.318268 }, { -3225.879883,21541.355469,-0.458721 }, { -3194.588867,21558.167969,-1.846107 }, { -3221.479980,21546.925781,-0.637211 }, { -3182.694580,21558.593750,-2.896610 }, { -3193.921631,21549.058594,-2.035099 }, { -3174.161377,21559.908203,-2.918705 }, { -3182.816650,21561.650391,-2.589792 }, { -3210.955078,21542.798828,-1.376186 }, { -3186.331543,21564.933594,-3.010742 }, { -3144.756104,21579.285156,-4.612942 }, { -3199.608154,21558.845703,-1.317623 }, { -3188.788574,21558.585938,-2.716442 }, { -3200.274658,21551.939453,-1.505352 }, { -3194.945313,21554.755859,-1.779186 }, { -3203.803955,21557.162109,-1.425827 }, { -3188.397949,21564.171875,-2.604004 }, { -3200.185547,21557.521484,-1.346531 }, { -3187.000732,21562.792969,-2.595488 }, { -3206.505127,21562.847656,-1.542702 }, { -3212.516113,21539.609375,-1.418098 }, { -3209.651855,21553.824219,-1.204571 }, { -3194.879883,21544.937500,-2.064550 }, { -3217.834473,21552.994141,-0.846195 }, { -3200.205566,21553.052734,-1.425159 }, { -3208.856934,21554.796875,-1.349419 }, { -3193.416504,21558.775391,-1.913849 }, { -3211.858398,21554.505859,-1.158131 }, { -3189.324463,21561.710938,-2.485207 }, { -3195.485596,21562.402344,-2.034025 }, { -3191.456299,21559.226563,-2.157930 }, { -3227.677246,21535.455078,-0.266602 }, { -3191.817139,21558.052734,-2.245388 }, { -3225.201172,21540.691406,-0.340984 }, { -3179.354248,21567.322266,-2.919134 }, { -3232.252930,21538.376953,-0.160294 }, { -3179.659424,21573.421875,-3.241035 }, { -3172.866699,21578.203125,-2.884102 }, { -3199.402588,21550.669922,-1.876120 }, { -3172.968018,21569.648438,-3.325136 }, { -3184.631348,21567.167969,-2.795103 }, { -3201.478516,21553.042969,-1.426651 }, { -3204.035889,21556.212891,-1.636143 }, { -3175.919678,21556.699219,-2.985838 }, { -3158.998291,21577.839844,-4.540016 }, { -3176.526611,21555.269531,-2.884291 }, { -3174.071777,21577.779297,-2.947796 }, { -3192.269775,21552.847656,-1.975891 }, { -3175.395752,21572.167969,-3.205580 }, { -3183.711670,21561.138672,-2.648643 }, { -3207.578857,21548.664063,-1.308861 }, { -3179.192139,21567.716797,-2.879797 }, { -3199.177246,21559.779297,-1.600109 }, { -3180.061279,21571.281250,-3.160894 }, { -3182.298828,21579.421875,-2.522076 }, { -3183.820801,21568.281250,-2.994442 }, { -3212.583740,21552.908203,-1.045700 }, { -3210.482910,21555.683594,-1.339924 }, { -3191.065186,21565.972656,-2.374331 }, { -3184.165527,21555.119141,-3.010315 }, { -3196.733887,21556.759766,-1.742352 }, { -3181.726807,21568.634766,-2.760429 }, { -3201.055664,21556.787109,-1.317097 }, { -3225.292969,21538.056641,-0.472191 }, { -3174.273682,21563.033203,-3.355595 }, { -3190.645264,21557.972656,-2.281797 }, { -3176.746338,21562.044922,-2.851517 }, { -3188.699463,21557.951172,-2.707047 }, { -3206.311035,21553.777344,-1.258564 }, { -3224.251465,21536.607422,-0.496155 }, { -3165.741699,21576.642578,-4.027647 }, { -3185.876709,21560.705078,-2.897726 }, { -3183.849365,21565.312500,-2.716208 }, { -3213.103271,21551.093750,-1.189133 }, { -3193.290039,21560.183594,-1.973658 }, { -3177.197510,21570.412109,-2.947874 }, { -3172.751709,21577.121094,-3.357801 }, { -3190.880859,21557.800781,-2.214458 }, { -3195.792236,21555.582031,-1.864771 }, { -3196.405762,21555.242188,-1.848698 }, { -3160.979004,21581.314453,-4.377008 }, { -3188.995117,21559.544922,-2.347656 }, { -3171.858887,21577.835938,-3.538719 }, { -3165.473145,21578.779297,-3.663471 }, { -3197.323486,21558.117188,-2.223219 }, { -3199.545166,21556.748047,-1.466316 }, { -3228.894043,21540.564453,0.019909 }, { -3188.344238,21549.125000,-2.669752 }, { -3191.629883,21572.460938,-2.148659 }, { -3194.344727,21554.738281,-1.899054 }, { -3195.875732,21553.248047,-1.912781 }, { -3182.291992,21561.666016,-2.694517 }, { -3188.751953,21565.591797,-2.583963 }, { -3198.857422,21551.416016,-1.998695 }, { -3194.936279,21566.628906,-2.034475 }, { -3191.371826,21560.283203,-2.234783 }, { -3175.341553,21570.011719,-3.071156 }, { -3246.143555,21536.298828,0.466320 }, { -3225.821777,21540.054688,-0.745159 }, { -3192.807861,21556.095703,-1.741920 }, { -3197.011475,21573.701172,-2.021313 }, { -3172.371338,21562.861328,-2.918684 }, { -3171.665771,21577.845703,-3.448399 }, { -3176.219971,21564.443359,-2.920589 }, { -3168.393799,21567.181641,-3.626091 }, { -3202.481934,21550.535156,-1.877552 }, { -3207.383545,21549.392578,-1.280060 }, { -3178.477539,21564.458984,-2.918703 }, { -3208.593262,21550.574219,-1.600422 }, { -3182.726074,21562.841797,-2.954374 }, { -3187.875244,21562.078125,-2.711445 }, { -3174.816406,21582.228516,-3.311628 }, { -3202.435303,21563.117188,-1.441212 }, { -3199.135498,21548.080078,-1.846294 }, { -3177.463867,21573.521484,-2.813366 }, { -3173.343018,21566.013672,-3.383137 }, { -3198.329834,21547.486328,-2.034950 }, { -3204.156006,21550.343750,-1.570007 }, { -3195.289307,21549.906250,-1.794535 }, { -3177.459717,21562.144531,-2.761280 }, { -3181.718506,21569.306641,-2.947111 }, { -3179.075195,21565.013672,-2.851404 }, { -3175.452637,21560.697266,-3.292212 }, { -3203.067383,21552.292969,-1.345604 }, { -3186.656006,21543.796875,-2.602530 }, { -3178.016602,21564.728516,-3.010586 }, { -3189.521729,21563.158203,-2.648043 }, { -3192.610840,21556.851563,-1.779484 }, { -3157.860840,21572.884766,-4.778742 }, { -3183.901123,21570.441406,-2.680317 }, { -3201.762207,21550.259766,-1.622803 }, { -3170.757813,21573.298828,-3.475462 }, { -3178.850830,21573.089844,-2.930071 }, { -3196.296875,21550.031250,-1.913378 }, { -3228.851318,21542.562500,0.086105 }, { -3206.278564,21546.226563,-1.522728 }, { -3179.152588,21563.474609,-2.952505 }, { -3199.086670,21555.062500,-1.899199 }, { -3180.188477,21562.154297,-3.162487 }, { -3209.447021,21546.417969,-1.350876 }, { -3200.470459,21551.351563,-1.945473 }, { -3188.731445,21561.212891,-2.690969 }, { -3179.646484,21564.966797,-2.922758 }, { -3191.423340,21560.539063,-2.341221 }, { -3206.025391,21560.982422,-1.279869 }, { -3196.447266,21558.867188,-1.729069 }, { -3177.474121,21563.421875,-2.791409 }, { -3170.393066,21561.529297,-3.528486 }, { -3179.616211,21564.523438,-2.984024 }, { -3199.316895,21561.464844,-1.280537 }, { -3227.066406,21532.410156,-0.137486 }, { -3175.353760,21564.804688,-2.852072 }, { -3178.712646,21559.728516,-2.858431 }, { -3182.530762,21557.031250,-2.611326 }, { -3205.212158,21531.433594,-1.463985 }, { -3216.007324,21551.724609,-0.646664 }, { -3175.512695,21571.892578,-3.137997 }, { -3157.519531,21583.501953,-4.628716 }, { -3210.438721,21537.263672,-1.225357 }, { -3204.729004,21554.689453,-1.384029 }, { -3198.046875,21557.056641,-1.899136 }, { -3186.487793,21568.484375,-2.611408 }, { -3203.322998,21559.394531,-1.693233 }, { -3193.204834,21558.703125,-1.954033 }, { -3160.819336,21577.615234,-4.404089 }, { -3203.380371,21553.765625,-1.537178 }, { -3165.844971,21572.765625,-3.512897 }, { -3206.823975,21533.880859,-1.535751 }, { -3213.739502,21551.982422,-1.147568 }, { -3164.052490,21577.921875,-4.027803 }, { -3171.689941,21573.009766,-3.446400 }, { -3213.260010,21553.742188,-1.138996 }, { -3211.018799,21556.779297,-1.080719 }, { -3181.591064,21563.460938,-2.947107 }, { -3187.769287,21557.693359,-2.544605 }, { -3170.723633,21580.396484,-3.579531 }, { -3176.828857,21574.525391,-3.071844 }, { -3216.761475,21556.527344,-0.906906 }, { -3195.845459,21557.337891,-2.034613 }, { -3174.413818,21564.748047,-3.169830 }, { -3186.644043,21559.281250,-2.632895 }, { -3221.573242,21543.505859,-0.673977 }, { -3213.352539,21547.646484,-1.148010 }, { -3197.557617,21546.007813,-2.034214 }, { -3185.854004,21569.421875,-2.612364 }, { -3215.212646,21549.703125,-1.054527 }, { -3185.552002,21561.892578,-2.695404 }, { -3222.484619,21538.986328,-0.370396 }, { -3190.376953,21560.623047,-2.215092 }, { -3201.052002,21554.398438,-1.210758 }, { -3190.016357,21555.095703,-2.281900 }, { -3189.121826,21563.630859,-2.147228 }, { -3226.252930,21543.111328,-0.133339 }, { -3147.109863,21587.066406,-4.869972 }, { -3205.898926,21564.707031,-1.693275 }, { -3211.211182,21548.492188,-1.254463 }, { -3226.527100,21536.591797,-0.598740 }, { -3159.739258,21575.511719,-4.406124 }, { -3188.684082,21551.939453,-2.534655 }, { -3175.739746,21570.750000,-3.049309 }, { -3209.824707,21563.222656,-1.060585 }, { -3191.507568,21559.021484,-2.235928 }, { -3197.449951,21556.324219,-2.066221 }, { -3202.321289,21551.271484,-1.787525 }, { -3206.181641,21546.826172,-1.383614 }, { -3212.555420,21549.173828,-1.032524 }, { -3212.500488,21559.998047,-1.097572 }, { -3201.714600,21549.259766,-1.462467 }, { -3211.860840,21544.169922,-1.391071 }, { -3194.450928,21545.162109,-1.996845 }, { -3192.144775,21555.128906,-1.912495 }, { -3189.892090,21561.128906,-2.202150 }, { -3167.693359,21572.371094,-3.520294 }, { -3163.657227,21571.263672,-3.959343 }, { -3194.240723,21559.865234,-2.140011 }, { -3192.582031,21559.841797,-2.343092 }, { -3231.234863,21547.884766,-0.046600 }, { -3151.822998,21586.156250,-4.785830 }, { -3205.283447,21543.626953,-1.444527 }, { -3193.104736,21552.873047,-1.913311 }, { -3202.864990,21557.644531,-1.462299 }, { -3182.859863,21570.324219,-2.650234 }, { -3195.051025,21559.054688,-1.913334 }, { -3198.059814,21549.896484,-1.912222 }, { -3174.236816,21562.193359,-3.166620 }, { -3143.074951,21576.666016,-5.565599 }, { -3161.690918,21576.607422,-4.404982 }, { -3198.963623,21550.994141,-1.845522 }, { -3193.681641,21559.878906,-1.998522 }, { -3213.070313,21551.404297,-1.137047 }, { -3173.897705,21568.277344,-3.135054 }, { -3200.635254,21557.605469,-1.635628 }, { -3181.861816,21563.697266,-2.944437 }, { -3188.767090,21558.925781,-2.641188 }, { -3162.151367,21573.453125,-4.077694 }, { -3178.120850,21557.224609,-2.851107 }, { -3194.481689,21557.994141,-2.101282 }, { -3221.511230,21541.939453,-0.474689 }, { -3181.031494,21566.761719,-2.823889 }, { -3177.301758,21564.464844,-2.858364 }, { -3201.883057,21549.191406,-1.345371 }, { -3180.398193,21565.156250,-2.823391 }, { -3186.335205,21566.595703,-2.630003 }, { -3186.929932,21566.572266,-2.629019 }, { -3206.639160,21549.855469,-1.383083 }, { -3190.103027,21550.919922,-2.215631 }, { -3195.400635,21555.880859,-1.953495 }, { -3168.294922,21574.234375,-3.912329 }, { -3172.029053,21571.375000,-2.853243 }, { -3161.813477,21577.644531,-3.953512 }, { -3198.207764,21554.871094,-1.249485 }, { -3198.960693,21554.462891,-1.248367 }, { -3189.505127,21563.576172,-2.281731 }, { -3209.785645,21549.169922,-1.184361 }, { -3165.221436,21570.474609,-3.441536 }, { -3202.494629,21540.886719,-1.414299 }, { -3202.315430,21549.525391,-1.277374 }, { -3186.188721,21564.960938,-2.633913 }, { -3184.000488,21561.253906,-2.922701 }, { -3187.697266,21547.013672,-2.592339 }, { -3211.100342,21554.869141,-1.080746 }, { -3172.172607,21569.142578,-2.886375 }, { -3177.603027,21566.113281,-3.193436 }, { -3226.402588,21548.283203,-0.179596 }, { -3213.483643,21557.791016,-1.118996 }, { -3206.544434,21542.464844,-1.213528 }, { -3206.364502,21551.523438,-1.619213 }, { -3210.156738,21555.208984,-1.350765 }, { -3192.460693,21562.224609,-2.143637 }, { -3169.086914,21572.001953,-3.582287 }, { -3169.880127,21571.611328,-3.696564 }, { -3175.969727,21562.765625,-3.272072 }, { -3202.823730,21551.416016,-1.636131 }, { -3200.726074,21547.820313,-1.249577 }, { -3205.669922,21553.500000,-1.213818 }, { -3198.890869,21551.941406,-1.963062 }, { -3168.873535,21572.921875,-3.496201 }, { -3162.860596,21571.355469,-4.020126 }, { -3212.531982,21542.164063,-1.443443 }, { -3201.433350,21551.074219,-1.505939 }, { -3204.204346,21554.777344,-1.316441 }, { -3181.666748,21569.097656,-2.918818 }, { -3205.199951,21553.857422,-1.316814 }, { -3204.104736,21550.148438,-1.345856 }, { -3178.430176,21569.865234,-2.863644 }, { -3205.476074,21558.695313,-1.347038 }, { -3184.380371,21565.101563,-2.809643 }, { -3202.549316,21564.916016,-1.192268 }, { -3199.032715,21558.085938,-1.832289 }, { -3179.745850,21586.285156,-2.918255 }, { -3201.154785,21557.498047,-1.503963 }, { -3176.761963,21569.662109,-3.233789 }, { -3175.359131,21569.103516,-3.135021 }, { -3205.676758,21555.265625,-1.249859 }, { -3197.701660,21549.693359,-2.101509 }, { -3198.251221,21556.556641,-2.035181 }, { -3160.209473,21580.324219,-4.524166 }, { -3203.406006,21547.109375,-1.278870 }, { -3202.704102,21553.162109,-1.508537 }, { -3171.275635,21562.646484,-3.667671 }, { -3170.846680,21565.240234,-3.445581 }, { -3175.578613,21563.896484,-2.745409 }, { -3197.049072,21553.880859,-1.931992 }, { -3193.589844,21562.582031,-1.833111 }, { -3195.067383,21560.531250,-2.043798 }, { -3170.419922,21566.958984,-3.472727 }, { -3205.412842,21556.419922,-1.316158 }, { -3194.506348,21549.488281,-1.742455 }, { -3206.354004,21552.097656,-1.316929 }, { -3200.562500,21559.806641,-1.316662 }, { -3193.524170,21556.113281,-1.853859 }, { -3177.745850,21567.789063,-3.202168 }, { -3177.456055,21565.849609,-3.071054 }, { -3189.597656,21573.734375,-2.214260 }, { -3198.534424,21557.414063,-1.383183 }, { -3174.793701,21578.314453,-3.137087 }, { -3200.053955,21559.830078,-1.720818 }, { -3202.034424,21556.197266,-1.757687 }, { -3218.207520,21544.287109,-0.794456 }, { -3184.868652,21566.746094,-2.574945 }, { -3208.566650,21546.626953,-1.295242 }, { -3199.780762,21559.701172,-1.787395 }, { -3197.339355,21556.968750,-2.017185 }, { -3203.526123,21552.613281,-1.382351 }, { -3162.975830,21573.263672,-3.967953 }, { -3204.357422,21558.496094,-1.383816 }, { -3218.941895,21542.080078,-0.692795 }, { -3152.213135,21574.689453,-4.652281 }, { -3202.913818,21547.085938,-1.383602 }, { -3215.129639,21561.248047,-1.148338 }, { -3179.215332,21573.210938,-3.137911 }, { -3194.728760,21553.513672,-1.846224 }, { -3186.365234,21567.595703,-2.716131 }, { -3183.769775,21567.740234,-2.916534 }, { -3180.925537,21552.324219,-3.063782 }, { -3209.265137,21556.763672,-1.116970 }, { -3190.700439,21562.216797,-2.078236 }, { -3201.428711,21546.773438,-1.504341 }, { -3199.447998,21554.796875,-1.912859 }, { -3224.298096,21545.724609,-0.443485 }, { -3195.895020,21554.787109,-2.034716 }, { -3217.517334,21545.732422,-0.793228 }, { -3207.488037,21555.123047,-1.227974 }, { -3198.297363,21557.658203,-1.345551 }, { -3224.789307,21541.453125,-0.598732 }, { -3183.070557,21569.617188,-2.794437 }, { -3154.765137,21579.921875,-5.078907 }, { -3168.812256,21573.517578,-3.471684 }, { -3172.806152,21566.468750,-3.205376 }, { -3186.082031,21566.386719,-3.009174 }, { -3211.985352,21547.929688,-1.127548 }, { -3210.275635,21549.962891,-1.417027 }, { -3209.356689,21552.021484,-1.112587 }, { -3212.738525,21539.564453,-1.060898 }, { -3207.146729,21553.675781,-1.638065 }, { -3202.358154,21552.625000,-1.944815 }, { -3184.505615,21569.146484,-2.806095 }, { -3199.444580,21556.585938,-1.369347 }, { -3199.975098,21555.742188,-1.316631 }, { -3183.437744,21563.111328,-2.940252 }, { -3171.932861,21573.960938,-3.163767 }, { -3180.945313,21562.308594,-2.919352 }, { -3194.152832,21560.646484,-2.208544 }, { -3165.868164,21569.798828,-3.445837 }, { -3165.565186,21575.771484,-4.159512 }, { -3198.860352,21556.716797,-1.844946 }, { -3175.430420,21566.976563,-2.983633 }, { -3205.251709,21562.808594,-1.294670 }, { -3195.175781,21555.187500,-2.110977 }, { -3205.653564,21550.373047,-1.227772 }, { -3174.760742,21566.445313,-2.846148 }, { -3172.066406,21575.833984,-2.750196 }, { -3224.766602,21548.755859,-0.598892 }, { -3197.960449,21554.572266,-1.895681 }, { -3195.406738,21550.078125,-2.109821 }, { -3198.940430,21569.119141,-1.912777 }, { -3201.354492,21556.763672,-1.315086 }, { -3196.423584,21546.238281,-1.895927 }, { -3170.300781,21571.250000,-3.418419 }, { -3173.437744,21564.201172,-2.918745 }, { -3198.177246,21560.994141,-2.089540 }, { -3201.988281,21552.785156,-1.625515 }, { -3156.856689,21573.617188,-4.523199 }, { -3197.395996,21559.111328,-2.057188 }, { -3187.354980,21551.238281,-2.650030 }, { -3180.732666,21567.910156,-2.918816 }, { -3196.991211,21560.476563,-1.880396 }, { -3151.392822,21582.988281,-4.687260 }, { -3208.683594,21550.535156,-1.504383 }, { -3181.408691,21561.341797,-2.812773 }, { -3193.718506,21571.701172,-1.912874 }, { -3180.259766,21568.060547,-3.200405 }, { -3165.175293,21565.365234,-3.691734 }, { -3197.902344,21558.089844,-1.862368 }, { -3172.991455,21570.681641,-3.249884 }, { -3219.871094,21545.523438,-0.406830 }, { -3199.922363,21551.652344,-1.637188 }, { -3193.731689,21551.527344,-2.021589 }, { -3176.367676,21565.576172,-2.851974 }, { -3183.490723,21567.089844,-2.900593 }, { -3191.994385,21549.943359,-2.213963 }, { -3191.904053,21560.353516,-2.090361 }, { -3178.316406,21567.041016,-2.846478 }, { -3189.084717,21571.080078,-2.339148 }, { -3175.846191,21572.716797,-2.820139 }, { -3203.719238,21554.669922,-1.250725 }, { -3187.681885,21562.798828,-2.695351 }, { -3196.396484,21558.148438,-2.034853 }, { -3179.054199,21558.363281,-2.925026 }, { -3211.541016,21559.078125,-1.225246 }, { -3206.796143,21548.609375,-1.503841 }, { -3189.975586,21564.583984,-2.301723 }, { -3197.946289,21551.998047,-1.967136 }, { -3155.529541,21579.148438,-4.777277 }, { -3218.149170,21541.218750,-0.696594 }, { -3177.073242,21563.117188,-3.324198 }, { -3175.424561,21575.349609,-3.072702 }, { -3201.949951,21560.525391,-1.346512 }, { -3193.100830,21568.447266,-2.119207 }, { -3188.925781,21561.740234,-2.685707 }, { -3206.926514,21544.660156,-1.324909 }};
+	const float endPOS[2090][3] = { { -0.009829,30.087524,0.000042 },{ -0.009617,30.122574,0.000039 },{ -0.009617,30.090666,0.000040 },{ -0.009644,30.078680,0.000036 },{ -0.010956,30.072088,0.000033 },{ -0.009617,30.061253,0.000043 },{ -0.009583,30.079285,0.000043 },{ -0.009644,30.155075,0.000045 },{ -0.009617,30.073967,0.000039 },{ -0.009583,30.043610,0.000038 },{ -0.009706,30.101746,0.000035 },{ -0.009617,30.088047,0.000041 },{ -0.009617,30.101854,0.000040 },{ -0.009617,30.096186,0.000038 },{ -0.009583,30.096666,0.000040 },{ -0.009617,30.069551,0.000038 },{ -0.009644,30.092234,0.000047 },{ -0.009617,30.243505,0.000046 },{ -0.009678,30.102760,0.000032 },{ -0.009644,30.125385,0.000038 },{ -0.009583,30.080639,0.000038 },{ -0.044103,30.086241,0.000151 },{ -0.013613,29.992752,0.000011 },{ -0.005218,29.930960,0.000000 },{ -0.008606,30.102688,0.000501 },{ -0.001100,30.000053,-0.000000 },{ 0.005150,30.102243,-0.000275 },{ 0.004993,29.792791,0.000005 },{ 0.012854,29.974260,0.000026 },{ 0.285044,29.656580,0.004545 },{ -3.654937,29.191168,-1.920196 },{ -3.395260,29.238214,-1.794952 },{ -3.117182,29.252031,-1.666016 },{ -3.055936,29.273432,-2.230805 },{ -3.162685,29.178825,-2.317108 },{ -3.896274,29.221781,-2.010529 },{ -2.755769,29.234426,-2.044007 },{ -3.571895,29.229633,-1.872498 },{ -3.024018,29.165194,-2.210693 },{ -3.713130,29.253231,-1.960510 },{ -3.277405,29.202885,-1.741242 },{ -3.266230,29.155750,-1.647278 },{ -3.334628,29.210007,-2.374542 },{ -3.116813,29.252275,-1.666595 },{ -3.717897,29.126156,-1.952178 },{ -3.114566,29.218834,-1.549591 },{ -3.454682,29.206335,-2.524018 },{ -3.274953,29.191483,-2.365753 },{ -3.374878,29.248634,-1.794342 },{ -3.065696,29.119724,-2.256714 },{ 0.007937,30.056068,0.000014 },{ 0.007971,30.002541,0.000011 },{ 0.007984,30.016319,0.000007 },{ 0.008012,30.011215,0.000009 },{ 0.007944,30.009233,0.000010 },{ 0.007978,30.120405,0.000011 },{ 0.007950,29.943172,0.000008 },{ 0.007971,30.075682,0.000009 },{ 0.007950,30.083765,0.000010 },{ 0.007616,29.996492,0.000005 },{ 0.008025,29.994406,0.000014 },{ 0.007971,29.979778,0.000010 },{ 0.007984,29.970438,0.000012 },{ 0.007998,30.057438,0.000008 },{ 0.007964,29.912600,0.000011 },{ 0.007950,30.056679,0.000012 },{ 0.007991,29.956009,0.000009 },{ 0.007971,29.870464,0.000011 },{ 0.007998,29.825914,0.000007 },{ 0.007964,30.000286,0.000012 },{ 0.007978,30.039181,0.000008 },{ 0.007903,29.985901,0.000006 },{ 0.007998,30.069197,0.000007 },{ 0.007991,30.015991,0.000010 },{ 0.007957,29.870508,0.000013 },{ 0.007991,29.923214,0.000012 },{ 0.007978,29.902882,0.000010 },{ 0.007964,29.965885,0.000007 },{ 0.007978,29.887266,0.000010 },{ 0.007930,30.039167,0.000011 },{ 0.007991,29.918306,0.000007 },{ 0.007971,29.964762,0.000009 },{ 0.007998,30.008196,0.000006 },{ 0.007875,29.930170,0.000013 },{ 0.008032,29.987589,0.000008 },{ 0.007930,29.902689,0.000014 },{ 0.007991,30.030096,0.000010 },{ 0.007978,30.056519,0.000006 },{ 0.007978,29.829824,0.000008 },{ 0.007998,30.021303,0.000011 },{ -0.009125,30.077341,0.000031 },{ -0.009644,30.079847,0.000041 },{ -0.009706,30.095175,0.000037 },{ -0.009856,30.100382,0.000035 },{ -0.009678,30.100834,0.000029 },{ -0.009767,30.075504,0.000033 },{ -0.009706,30.093313,0.000037 },{ -0.009706,30.068447,0.000036 },{ -0.009617,30.085325,0.000041 },{ -0.010717,30.114794,0.000042 },{ -0.009767,30.107220,0.000043 },{ -0.009644,30.132105,0.000038 },{ -0.009583,30.091349,0.000036 },{ -0.009617,30.067915,0.000035 },{ -0.009555,30.080076,0.000037 },{ -0.009678,30.125866,0.000033 },{ -0.009740,30.094683,0.000036 },{ -0.009678,30.105219,0.000036 },{ -0.009740,30.170502,0.000043 },{ -0.009644,30.110262,0.000042 },{ -0.009740,30.120771,0.000035 },{ -0.009617,30.097950,0.000038 },{ -0.009740,30.128099,0.000043 },{ -0.009678,30.127491,0.000038 },{ -0.009644,30.072706,0.000039 },{ -0.009706,30.116659,0.000042 },{ -0.009706,30.138365,0.000040 },{ -0.009678,30.124514,0.000041 },{ -0.009829,30.135786,0.000032 },{ -0.009678,30.109159,0.000039 },{ -0.009678,30.115580,0.000040 },{ -0.009678,30.097094,0.000037 },{ -0.009617,30.087624,0.000038 },{ -0.009856,30.109640,0.000044 },{ -0.009952,30.100136,0.000036 },{ -0.009706,30.101103,0.000039 },{ -0.009678,30.114531,0.000036 },{ -0.009794,30.089235,0.000038 },{ -0.010225,30.105942,0.000042 },{ -0.009829,30.084242,0.000042 },{ -0.009794,30.104879,0.000039 },{ -0.009856,30.106226,0.000039 },{ -0.009678,30.103344,0.000033 },{ -0.009706,30.098782,0.000035 },{ -0.009617,30.130606,0.000038 },{ -0.010068,30.100887,0.000033 },{ -0.009583,30.050150,0.000035 },{ -0.009583,30.203081,0.000046 },{ -0.009617,30.040041,0.000039 },{ -0.009706,30.152708,0.000042 },{ -0.010006,30.104553,0.000041 },{ -0.009432,30.123697,0.000032 },{ -0.009767,30.129192,0.000030 },{ -0.009890,30.046915,0.000034 },{ -0.009555,30.114189,0.000039 },{ -0.009460,30.023149,0.000037 },{ -0.009583,30.108006,0.000041 },{ -0.009644,30.085382,0.000045 },{ -0.009617,30.109730,0.000040 },{ -0.009521,30.046844,0.000034 },{ -0.010068,30.068035,0.000041 },{ -0.009337,30.120348,0.000041 },{ -0.009494,30.076521,0.000034 },{ -0.009432,30.100901,0.000041 },{ -0.009644,30.092489,0.000042 },{ -0.010259,30.089348,0.000043 },{ -0.009583,30.117182,0.000038 },{ -0.009767,30.083200,0.000035 },{ -0.009644,30.099276,0.000034 },{ -0.010225,30.088795,0.000035 },{ -0.009555,30.070091,0.000038 },{ -0.009583,30.049562,0.000037 },{ -0.009794,30.126034,0.000038 },{ -0.009706,30.111895,0.000038 },{ -0.009617,30.097517,0.000040 },{ -0.009644,30.084633,0.000039 },{ -0.009644,30.064835,0.000034 },{ -0.009706,29.957710,0.000037 },{ -0.009706,30.205578,0.000057 },{ -0.009644,30.050180,0.000039 },{ -0.009829,30.111155,0.000035 },{ -0.009494,30.092674,0.000038 },{ -0.009460,30.090786,0.000036 },{ -0.009460,30.139595,0.000034 },{ -0.009521,30.072649,0.000035 },{ -0.009678,30.069820,0.000036 },{ -0.009583,30.137621,0.000037 },{ -0.009432,30.106770,0.000036 },{ -0.009583,30.023455,0.000037 },{ -0.009494,30.140213,0.000037 },{ -0.009432,30.067322,0.000040 },{ -0.009432,30.071436,0.000035 },{ -0.009767,30.079779,0.000037 },{ -0.009555,30.097521,0.000038 },{ -0.009521,30.054098,0.000039 },{ -0.009740,30.096960,0.000039 },{ -0.009644,30.115282,0.000039 },{ -0.009644,30.126320,0.000037 },{ -0.009794,30.113974,0.000036 },{ -0.009678,30.059595,0.000036 },{ -0.009767,30.054863,0.000033 },{ -0.009794,30.130630,0.000037 },{ -0.009644,30.099020,0.000037 },{ -0.009706,30.117380,0.000038 },{ -0.009740,30.086271,0.000029 },{ -0.009706,30.000494,0.000039 },{ -0.009767,30.096312,0.000037 },{ -0.009794,30.132536,0.000041 },{ -0.009706,30.148487,0.000031 },{ -0.010102,30.130665,0.000040 },{ -0.009856,30.092052,0.000038 },{ -0.009644,30.064411,0.000039 },{ -0.009767,30.104174,0.000034 },{ -0.009706,30.120638,0.000036 },{ -0.010006,30.086906,0.000037 },{ -0.009678,30.095530,0.000036 },{ -0.009794,30.094786,0.000031 },{ -0.009767,30.046539,0.000041 },{ -0.009521,30.111280,0.000036 },{ -0.009617,30.169495,0.000039 },{ -0.010286,30.101807,0.000041 },{ -0.009740,30.096735,0.000043 },{ -0.009829,30.090652,0.000038 },{ -0.009583,30.063066,0.000037 },{ -0.009740,30.093706,0.000039 },{ -0.010163,30.078257,0.000034 },{ -0.009583,30.158730,0.000039 },{ -0.009398,30.075453,0.000042 },{ -0.009678,30.106707,0.000034 },{ -0.009644,30.115973,0.000040 },{ -0.009890,30.091114,0.000040 },{ -0.009678,30.162519,0.000039 },{ -0.009706,29.992035,0.000033 },{ -0.009856,30.081354,0.000034 },{ -0.009794,30.090445,0.000041 },{ -0.009740,30.075424,0.000038 },{ -0.009644,30.119450,0.000043 },{ -0.009706,30.145367,0.000034 },{ -0.009617,30.130795,0.000036 },{ -0.009856,30.171556,0.000035 },{ -0.009706,30.072153,0.000034 },{ -0.009275,30.097240,0.000031 },{ -0.009917,30.101570,0.000041 },{ -0.009644,30.128649,0.000040 },{ -0.009678,30.113462,0.000040 },{ -0.009706,30.176228,0.000036 },{ -0.009617,30.044909,0.000043 },{ -0.009678,30.061460,0.000035 },{ -0.010006,30.089424,0.000041 },{ -0.009678,30.094168,0.000032 },{ -0.009678,30.153732,0.000040 },{ -0.009706,30.029110,0.000037 },{ -0.009767,30.161633,0.000037 },{ -0.009248,30.041380,0.000033 },{ -0.009678,30.116383,0.000038 },{ -0.009644,30.072153,0.000040 },{ -0.009979,30.076391,0.000037 },{ -0.010006,30.051559,0.000030 },{ -0.009829,30.083109,0.000035 },{ -0.009856,30.100809,0.000038 },{ -0.009890,30.044922,0.000035 },{ -0.010068,30.092186,0.000011 },{ -0.010068,30.132639,0.000040 },{ -0.009952,30.148699,0.000038 },{ -0.009952,30.110819,0.000039 },{ -0.009678,30.060606,0.000039 },{ -0.009371,30.086531,0.000040 },{ -0.009555,30.121555,0.000041 },{ -0.009398,30.086603,0.000036 },{ -0.009371,30.000710,0.000039 },{ -0.009644,30.076183,0.000034 },{ -0.009494,30.068428,0.000038 },{ -0.009644,30.047451,0.000040 },{ -0.009494,30.097902,0.000037 },{ -0.009617,30.100395,0.000038 },{ -0.009248,30.120249,0.000033 },{ -0.009337,30.038774,0.000036 },{ -0.009125,30.152794,0.000039 },{ -0.009337,30.077662,0.000036 },{ -0.009644,30.108675,0.000038 },{ -0.010102,30.088856,0.000037 },{ -0.009555,30.131617,0.000039 },{ -0.009644,30.098166,0.000040 },{ -0.009617,30.075302,0.000039 },{ -0.009494,30.147087,0.000041 },{ -0.009890,30.031332,0.000041 },{ -0.009706,30.111977,0.000038 },{ -0.009856,30.175760,0.000035 },{ -0.009829,30.090544,0.000041 },{ -0.009740,30.101746,0.000039 },{ -0.009767,30.133953,0.000040 },{ -0.009678,30.090254,0.000034 },{ -0.009617,30.120935,0.000037 },{ -0.009856,30.063288,0.000039 },{ -0.009856,30.085705,0.000040 },{ -0.009740,30.065771,0.000035 },{ -0.009678,30.101465,0.000043 },{ -0.009767,30.100752,0.000039 },{ -0.009890,30.064991,0.000038 },{ -0.009644,30.078936,0.000041 },{ -0.009678,30.150707,0.000037 },{ -0.009432,30.081511,0.000031 },{ -0.009856,30.152142,0.000022 },{ -0.009706,30.100739,0.000039 },{ -0.010136,30.102760,0.000038 },{ -0.009644,30.091309,0.000038 },{ -0.009856,30.217144,0.000036 },{ -0.009706,30.098713,0.000038 },{ -0.009583,30.150396,0.000037 },{ -0.009432,30.059240,0.000037 },{ -0.009398,30.055307,0.000036 },{ -0.009794,30.126820,0.000041 },{ -0.009337,30.049757,0.000030 },{ -0.009398,30.105648,0.000038 },{ -0.009432,30.098186,0.000036 },{ -0.009398,30.092897,0.000040 },{ -0.009303,30.119070,0.000032 },{ -0.009829,30.054686,0.000033 },{ -0.009303,30.207617,0.000041 },{ -0.009706,30.068783,0.000037 },{ -0.009706,30.120111,0.000042 },{ -0.009706,30.124458,0.000039 },{ -0.009617,30.076180,0.000040 },{ -0.009678,30.092760,0.000036 },{ -0.009583,30.131918,0.000039 },{ -0.009617,30.058441,0.000035 },{ -0.009555,30.115799,0.000037 },{ -0.009617,30.126122,0.000040 },{ -0.009617,30.114952,0.000033 },{ -0.009767,30.101971,0.000040 },{ -0.009678,30.079489,0.000037 },{ -0.009678,30.097876,0.000037 },{ -0.009767,30.066935,0.000035 },{ -0.009740,30.008179,0.000037 },{ -0.009617,30.138590,0.000037 },{ -0.009917,30.112438,0.000037 },{ -0.009740,30.097702,0.000029 },{ -0.009794,30.100679,0.000035 },{ -0.009678,30.097866,0.000037 },{ -0.009794,30.218884,0.000053 },{ -0.009740,30.104282,0.000040 },{ -0.008913,30.059473,0.000032 },{ -0.009767,30.109228,0.000041 },{ -0.009521,30.077419,0.000039 },{ -0.009678,30.080370,0.000033 },{ -0.009678,30.069456,0.000029 },{ -0.009706,30.094799,0.000041 },{ -0.009678,30.144909,0.000038 },{ -0.009644,30.100105,0.000039 },{ -0.009740,30.174105,0.000030 },{ -0.009398,30.124578,0.000038 },{ -0.009767,30.094912,0.000038 },{ -0.009644,30.120811,0.000037 },{ -0.009706,29.982185,0.000041 },{ -0.009794,30.108749,0.000036 },{ -0.009856,30.119104,0.000039 },{ -0.009740,30.131176,0.000041 },{ -0.009767,30.084246,0.000033 },{ -0.009678,30.078093,0.000038 },{ -0.009644,30.091978,0.000045 },{ -0.009371,30.120661,0.000038 },{ -0.009460,30.090090,0.000043 },{ -0.009706,30.116966,0.000039 },{ -0.009617,30.089010,0.000042 },{ -0.009617,30.055368,0.000041 },{ -0.009521,30.106508,0.000034 },{ -0.009678,30.067888,0.000037 },{ -0.009494,30.171406,0.000042 },{ -0.009064,30.113371,0.000038 },{ -0.010498,30.096195,0.000052 },{ -0.010136,30.135323,0.000038 },{ -0.009187,30.300381,0.000068 },{ -0.009767,30.094160,0.000052 },{ -0.009644,30.160860,0.000031 },{ -0.009555,30.098740,0.000038 },{ -0.009494,30.094437,0.000042 },{ -0.009337,30.099638,0.000033 },{ -0.009678,30.109743,0.000040 },{ -0.009583,30.118046,0.000039 },{ -0.009432,30.033491,0.000040 },{ -0.009555,30.090816,0.000035 },{ -0.009767,30.094334,0.000043 },{ -0.009494,30.075596,0.000033 },{ -0.009890,30.103466,0.000041 },{ -0.009767,30.102467,0.000042 },{ -0.009617,30.100451,0.000037 },{ -0.009678,30.111105,0.000036 },{ -0.009644,30.118263,0.000041 },{ -0.009617,30.127361,0.000036 },{ -0.009740,30.079697,0.000040 },{ -0.009678,30.126934,0.000035 },{ -0.009432,30.056665,0.000033 },{ -0.009856,30.123999,0.000040 },{ -0.009583,30.071920,0.000039 },{ -0.009740,30.062260,0.000033 },{ -0.009678,30.113510,0.000045 },{ -0.009678,30.110306,0.000039 },{ -0.009432,30.106956,0.000037 },{ -0.009678,30.102739,0.000041 },{ -0.010068,30.113678,0.000042 },{ -0.009794,30.143099,0.000034 },{ -0.009856,30.100601,0.000043 },{ -0.009521,30.121519,0.000052 },{ -0.009678,30.135288,0.000039 },{ -0.009706,30.091619,0.000038 },{ -0.009829,30.112732,0.000033 },{ -0.009678,30.149881,0.000037 },{ -0.009917,30.112011,0.000037 },{ -0.009398,30.071795,0.000033 },{ -0.009767,30.105833,0.000035 },{ -0.009979,30.070421,0.000042 },{ -0.009494,30.104044,0.000033 },{ -0.009740,30.101336,0.000037 },{ -0.009617,30.096684,0.000039 },{ -0.009644,30.069845,0.000041 },{ -0.009521,30.054781,0.000040 },{ -0.009856,30.113388,0.000037 },{ -0.009706,30.083559,0.000041 },{ -0.009521,30.111120,0.000035 },{ -0.009678,30.124622,0.000038 },{ -0.009706,30.068260,0.000040 },{ -0.009371,30.109661,0.000045 },{ -0.009979,30.075418,0.000042 },{ -0.009678,30.128885,0.000039 },{ -0.009740,30.102654,0.000036 },{ -0.009398,30.108948,0.000040 },{ -0.009617,30.094799,0.000034 },{ -0.009398,29.981028,0.000032 },{ -0.009494,30.100082,0.000040 },{ -0.009521,30.127977,0.000036 },{ -0.009583,30.074841,0.000038 },{ -0.009706,30.087532,0.000036 },{ -0.009678,30.069950,0.000040 },{ -0.009706,30.126307,0.000037 },{ -0.009460,30.010792,0.000037 },{ -0.009890,30.121891,0.000039 },{ -0.009740,30.061707,0.000034 },{ -0.009767,30.068165,0.000041 },{ -0.009159,30.088310,0.000040 },{ -0.009678,30.085032,0.000038 },{ -0.009644,30.093187,0.000036 },{ -0.009678,30.106213,0.000035 },{ -0.009617,30.056171,0.000041 },{ -0.010006,30.129517,0.000042 },{ -0.009617,30.093077,0.000035 },{ -0.009706,30.012663,0.000034 },{ -0.009678,30.091265,0.000038 },{ -0.009644,30.092794,0.000041 },{ -0.009952,30.060808,0.000034 },{ -0.009678,30.096315,0.000033 },{ -0.009829,30.120180,0.000040 },{ -0.009678,30.104631,0.000038 },{ -0.009952,30.121027,0.000037 },{ -0.009740,30.061781,0.000035 },{ -0.009706,30.102943,0.000041 },{ -0.009583,30.099552,0.000037 },{ -0.009829,30.101120,0.000036 },{ -0.009706,30.061638,0.000038 },{ -0.009740,30.111977,0.000041 },{ -0.009644,30.050150,0.000042 },{ -0.009678,29.985680,0.000036 },{ -0.009740,30.095802,0.000032 },{ -0.009521,30.105379,0.000031 },{ -0.010136,30.098408,0.000041 },{ -0.009767,30.139185,0.000034 },{ -0.009644,30.107941,0.000041 },{ -0.009856,30.034533,0.000035 },{ -0.009767,30.079332,0.000041 },{ -0.009678,30.070251,0.000036 },{ -0.009678,30.129145,0.000029 },{ -0.009829,30.099512,0.000038 },{ -0.009740,30.122549,0.000039 },{ -0.009890,30.102200,0.000031 },{ -0.009521,30.106640,0.000035 },{ -0.009767,30.129025,0.000037 },{ -0.009740,30.108694,0.000038 },{ -0.009521,30.124043,0.000041 },{ -0.009617,30.131279,0.000036 },{ -0.009917,30.153389,0.000038 },{ -0.009890,30.096973,0.000040 },{ -0.009644,30.004374,0.000034 },{ -0.009002,30.092569,0.000049 },{ -0.009767,30.104662,0.000037 },{ -0.009555,30.093344,0.000035 },{ -0.009521,30.115713,0.000036 },{ -0.009829,30.161421,0.000037 },{ -0.009583,30.192122,0.000039 },{ -0.009583,30.101219,0.000037 },{ -0.009678,30.106451,0.000036 },{ -0.009583,30.075453,0.000039 },{ -0.009678,30.175856,0.000053 },{ -0.009617,30.121157,0.000039 },{ -0.009767,30.080330,0.000037 },{ -0.009555,30.121395,0.000033 },{ -0.009678,30.071505,0.000040 },{ -0.009829,30.101746,0.000037 },{ -0.009917,30.099724,0.000039 },{ -0.009617,30.172174,0.000034 },{ -0.009706,30.100260,0.000037 },{ -0.009678,30.087965,0.000040 },{ -0.009740,30.141129,0.000033 },{ -0.009706,30.087620,0.000028 },{ -0.009706,30.100130,0.000044 },{ -0.009706,30.139566,0.000034 },{ -0.009706,30.055611,0.000035 },{ -0.009740,30.117052,0.000037 },{ -0.009706,30.163162,0.000040 },{ -0.009706,30.021534,0.000040 },{ -0.009644,30.131050,0.000035 },{ -0.009706,30.101587,0.000036 },{ -0.010040,30.078279,0.000040 },{ -0.009494,30.048893,0.000036 },{ -0.009767,30.089731,0.000035 },{ -0.009678,30.063742,0.000034 },{ -0.009555,30.102619,0.000038 },{ -0.009706,30.105064,0.000042 },{ -0.009678,30.040546,0.000036 },{ -0.009248,30.084707,0.000034 },{ -0.009979,30.140024,0.000036 },{ -0.009706,30.159603,0.000001 },{ -0.008640,30.059853,0.000032 },{ -0.009460,30.091175,0.000043 },{ -0.009678,30.080793,0.000039 },{ -0.009706,30.079332,0.000041 },{ -0.009644,30.099897,0.000039 },{ -0.009555,30.071003,0.000037 },{ -0.009583,30.099054,0.000042 },{ -0.009644,30.130384,0.000043 },{ -0.009583,30.083153,0.000039 },{ -0.009678,30.107941,0.000040 },{ -0.009706,30.085022,0.000039 },{ -0.009644,30.064493,0.000034 },{ -0.009678,30.099989,0.000038 },{ -0.009767,30.098890,0.000040 },{ -0.009706,30.080374,0.000041 },{ -0.009521,30.110922,0.000037 },{ -0.009555,30.097176,0.000033 },{ -0.009706,30.110033,0.000037 },{ -0.009890,30.091370,0.000036 },{ -0.009767,30.101479,0.000038 },{ -0.009494,30.099802,0.000038 },{ -0.009740,30.118055,0.000036 },{ -0.009678,30.146002,0.000035 },{ -0.009583,30.157499,0.000038 },{ -0.009706,30.086189,0.000041 },{ -0.009678,30.117788,0.000036 },{ -0.009644,30.108166,0.000036 },{ -0.009706,30.092350,0.000041 },{ -0.009521,30.085005,0.000046 },{ -0.009644,30.108261,0.000038 },{ -0.009644,30.088112,0.000040 },{ -0.009583,30.109272,0.000044 },{ -0.009678,30.105625,0.000039 },{ -0.009767,30.097517,0.000031 },{ -0.009740,30.099129,0.000033 },{ -0.009583,30.100246,0.000034 },{ -0.009617,30.099119,0.000034 },{ -0.009644,30.094450,0.000031 },{ -0.009644,30.083458,0.000043 },{ -0.009678,30.100130,0.000036 },{ -0.009644,30.060423,0.000038 },{ -0.009617,30.074486,0.000032 },{ -0.009583,30.112619,0.000039 },{ -0.009583,30.057240,0.000035 },{ -0.009794,30.083338,0.000042 },{ -0.009706,30.081446,0.000036 },{ -0.009617,30.083817,0.000039 },{ -0.009706,30.101336,0.000038 },{ -0.009678,30.109409,0.000049 },{ -0.009583,30.109388,0.000041 },{ -0.009706,30.076504,0.000037 },{ -0.009767,30.078833,0.000039 },{ -0.009678,30.110819,0.000042 },{ -0.009678,30.099993,0.000038 },{ -0.009706,30.108698,0.000043 },{ -0.009706,30.118496,0.000039 },{ -0.009917,30.073273,0.000032 },{ -0.009617,30.107100,0.000040 },{ -0.009678,30.114006,0.000040 },{ -0.009583,30.109545,0.000039 },{ -0.009767,30.107578,0.000037 },{ -0.009644,30.059053,0.000042 },{ -0.009617,30.099033,0.000040 },{ -0.009617,30.153381,0.000041 },{ -0.009583,30.097446,0.000032 },{ -0.009767,30.092022,0.000036 },{ -0.009979,30.102144,0.000039 },{ -0.009644,30.141865,0.000037 },{ -0.009740,30.107527,0.000037 },{ -0.009644,30.122065,0.000035 },{ -0.009767,30.075954,0.000038 },{ -0.009644,30.088863,0.000037 },{ -0.009644,30.081425,0.000036 },{ -0.009644,30.094778,0.000032 },{ -0.009767,30.117788,0.000038 },{ -0.009555,30.151009,0.000042 },{ -0.009398,30.075333,0.000036 },{ -0.009275,30.121529,0.000039 },{ -0.009617,30.130272,0.000041 },{ -0.009460,30.131586,0.000034 },{ -0.009521,30.104126,0.000040 },{ -0.009555,30.141876,0.000034 },{ -0.009555,30.112455,0.000036 },{ -0.009555,30.112606,0.000035 },{ -0.009678,30.123999,0.000040 },{ -0.009644,30.061007,0.000037 },{ -0.009740,30.103193,0.000038 },{ -0.009829,30.201603,0.000039 },{ -0.009583,30.095741,0.000036 },{ -0.009583,30.071997,0.000032 },{ -0.009829,30.085581,0.000040 },{ -0.009644,30.174507,0.000040 },{ -0.009856,30.150150,0.000038 },{ -0.009555,30.120132,0.000037 },{ -0.009583,30.160454,0.000037 },{ -0.009740,30.122362,0.000040 },{ -0.009555,30.115211,0.000037 },{ -0.009644,30.076927,0.000038 },{ -0.009706,30.098864,0.000038 },{ -0.009740,30.123083,0.000036 },{ -0.009678,30.133421,0.000036 },{ -0.009460,30.052626,0.000034 },{ -0.009829,30.114189,0.000037 },{ -0.009678,30.133680,0.000035 },{ -0.009678,30.098856,0.000034 },{ -0.009706,30.131498,0.000033 },{ -0.009706,30.099495,0.000041 },{ -0.009644,30.083523,0.000039 },{ -0.009678,30.153128,0.000036 },{ -0.009583,30.093712,0.000042 },{ -0.009494,30.094976,0.000039 },{ -0.009521,30.108667,0.000038 },{ -0.009494,30.125551,0.000033 },{ -0.009644,30.083904,0.000032 },{ -0.009740,30.089663,0.000036 },{ -0.009583,30.056536,0.000039 },{ -0.009583,30.081631,0.000034 },{ -0.009521,30.101007,0.000038 },{ -0.009275,30.106075,0.000041 },{ -0.009583,30.084410,0.000037 },{ -0.009644,30.118855,0.000033 },{ -0.009555,30.121891,0.000042 },{ -0.009521,30.104031,0.000038 },{ -0.009617,30.177937,0.000038 },{ -0.009555,30.052465,0.000035 },{ -0.009555,30.092081,0.000040 },{ -0.009337,30.188143,0.000039 },{ -0.009678,30.076853,0.000039 },{ -0.009678,30.051758,0.000040 },{ -0.009644,30.100554,0.000042 },{ -0.009398,30.076612,0.000039 },{ -0.009583,30.092047,0.000040 },{ -0.009706,30.112595,0.000042 },{ -0.009767,30.032101,0.000040 },{ -0.009678,30.082132,0.000039 },{ -0.009740,30.094297,0.000038 },{ -0.009644,30.089663,0.000036 },{ -0.009583,30.026112,0.000040 },{ -0.009740,30.093685,0.000038 },{ -0.010068,30.101685,0.000041 },{ -0.009521,30.157562,0.000035 },{ -0.009678,30.062311,0.000040 },{ -0.009460,30.100317,0.000042 },{ -0.009583,30.096544,0.000033 },{ -0.009678,30.122635,0.000030 },{ -0.009583,30.061136,0.000035 },{ -0.009644,30.035021,0.000037 },{ -0.009617,30.074827,0.000040 },{ -0.009555,30.117813,0.000036 },{ -0.009767,30.074053,0.000031 },{ -0.009617,30.218872,0.000043 },{ -0.009617,30.090488,0.000035 },{ -0.009706,30.177168,0.000029 },{ -0.009617,30.133017,0.000039 },{ -0.009706,30.127703,0.000038 },{ -0.009706,30.049896,0.000037 },{ -0.009583,30.166861,0.000038 },{ -0.009740,30.032234,0.000039 },{ -0.009617,30.106472,0.000038 },{ -0.009644,30.099451,0.000040 },{ -0.009678,30.066034,0.000043 },{ -0.009337,30.067888,0.000033 },{ -0.009678,30.111366,0.000037 },{ -0.009740,30.053514,0.000039 },{ -0.009767,30.057196,0.000039 },{ -0.009644,30.074640,0.000035 },{ -0.009460,30.124285,0.000037 },{ -0.009767,30.136528,0.000036 },{ -0.009678,30.100359,0.000029 },{ -0.009644,30.093676,0.000034 },{ -0.009617,30.091978,0.000036 },{ -0.009583,30.072796,0.000034 },{ -0.009583,30.133358,0.000037 },{ -0.009706,30.100506,0.000037 },{ -0.009583,30.098433,0.000040 },{ -0.009706,30.105820,0.000035 },{ -0.009644,30.099171,0.000038 },{ -0.009644,30.079956,0.000034 },{ -0.009740,30.190994,0.000037 },{ -0.009644,30.089663,0.000040 },{ -0.009706,30.101315,0.000036 },{ -0.009617,30.074348,0.000038 },{ -0.009617,30.102139,0.000039 },{ -0.009706,30.139458,0.000034 },{ -0.009644,30.051083,0.000038 },{ -0.009371,30.003407,0.000037 },{ -0.009740,30.052963,0.000037 },{ -0.009617,30.097305,0.000038 },{ -0.009617,30.050198,0.000044 },{ -0.009740,30.115044,0.000039 },{ -0.009583,30.064302,0.000042 },{ -0.009617,30.144991,0.000037 },{ -0.009829,30.112606,0.000033 },{ -0.009740,30.096930,0.000040 },{ -0.009583,30.106461,0.000038 },{ -0.009644,30.018547,0.000037 },{ -0.009678,30.087049,0.000029 },{ -0.009617,30.091097,0.000033 },{ -0.009740,30.097626,0.000038 },{ -0.009583,30.077225,0.000043 },{ -0.009583,30.097866,0.000035 },{ -0.009644,30.099693,0.000037 },{ -0.009555,30.115429,0.000034 },{ -0.009583,30.248806,0.000026 },{ -0.009678,30.100420,0.000034 },{ -0.009617,30.153730,0.000036 },{ -0.009706,30.046278,0.000039 },{ -0.009644,30.102636,0.000041 },{ -0.009555,30.071672,0.000029 },{ -0.009706,30.050581,0.000026 },{ -0.009617,30.155478,0.000038 },{ -0.009917,30.084332,0.000038 },{ -0.009706,30.159210,0.000036 },{ -0.009583,30.099419,0.000039 },{ -0.009583,30.115959,0.000038 },{ -0.009617,30.107128,0.000034 },{ -0.009706,30.105465,0.000038 },{ -0.009617,30.091234,0.000039 },{ -0.009583,30.096304,0.000036 },{ -0.009794,30.148218,0.000038 },{ -0.009644,30.120405,0.000038 },{ -0.009337,30.083778,0.000035 },{ -0.009829,30.085758,0.000039 },{ -0.009890,30.099033,0.000043 },{ -0.010163,30.081043,0.000043 },{ -0.009678,30.212599,0.000051 },{ -0.009583,30.025616,0.000042 },{ -0.009617,30.110481,0.000036 },{ -0.009706,30.158426,0.000032 },{ -0.009644,30.152651,0.000032 },{ -0.009583,30.129917,0.000039 },{ -0.009767,30.083597,0.000038 },{ -0.009583,30.104170,0.000036 },{ -0.009644,30.157745,0.000040 },{ -0.009794,30.114733,0.000037 },{ -0.009555,30.064692,0.000036 },{ -0.009644,30.088535,0.000036 },{ -0.009706,30.121166,0.000037 },{ -0.009583,30.106192,0.000038 },{ -0.009740,30.093386,0.000039 },{ -0.009706,30.066139,0.000034 },{ -0.009890,30.101158,0.000040 },{ -0.009521,30.115013,0.000040 },{ -0.009583,30.109907,0.000040 },{ -0.009644,30.065845,0.000039 },{ -0.009398,30.045013,0.000029 },{ -0.009555,30.125729,0.000037 },{ -0.009644,30.133137,0.000041 },{ -0.009583,30.106943,0.000035 },{ -0.009460,30.042137,0.000035 },{ -0.009555,30.077679,0.000034 },{ -0.009583,30.060965,0.000036 },{ -0.009678,30.129021,0.000040 },{ -0.009740,30.068602,0.000041 },{ -0.009617,30.147881,0.000041 },{ -0.009678,30.098904,0.000041 },{ -0.009617,30.073833,0.000037 },{ -0.009678,30.107647,0.000039 },{ -0.010068,30.100365,0.000039 },{ -0.009644,30.110666,0.000039 },{ -0.009644,30.064316,0.000037 },{ -0.009555,30.085333,0.000037 },{ -0.009678,30.023556,0.000038 },{ -0.009617,30.106174,0.000042 },{ -0.009617,30.060675,0.000032 },{ -0.009617,30.107695,0.000037 },{ -0.009644,30.131819,0.000039 },{ -0.009706,30.093685,0.000042 },{ -0.009706,30.070715,0.000034 },{ -0.009494,30.104109,0.000038 },{ -0.009706,30.164825,0.000037 },{ -0.009706,30.107031,0.000037 },{ -0.009617,30.111574,0.000039 },{ -0.009767,30.100554,0.000038 },{ -0.009644,30.127344,0.000034 },{ -0.009740,30.120279,0.000037 },{ -0.009644,30.120026,0.000040 },{ -0.009644,30.076387,0.000035 },{ -0.009583,30.048525,0.000041 },{ -0.009521,30.193827,0.000033 },{ -0.009706,30.111273,0.000038 },{ -0.009583,30.096697,0.000041 },{ -0.009644,30.080664,0.000035 },{ -0.009706,30.153360,0.000037 },{ -0.009644,30.104296,0.000040 },{ -0.009740,30.074209,0.000039 },{ -0.009617,30.111488,0.000028 },{ -0.009856,29.978914,0.000040 },{ -0.009740,30.096851,0.000020 },{ -0.009617,30.071514,0.000038 },{ -0.009706,30.078257,0.000042 },{ -0.009767,30.083082,0.000039 },{ -0.009617,30.108011,0.000037 },{ -0.009644,30.167391,0.000039 },{ -0.009740,30.102537,0.000035 },{ -0.009644,30.142719,0.000036 },{ -0.009644,30.046539,0.000037 },{ -0.009555,30.100403,0.000037 },{ -0.009494,30.102169,0.000036 },{ -0.009706,30.100658,0.000035 },{ -0.009706,30.135695,0.000034 },{ -0.009706,30.132908,0.000040 },{ -0.009583,30.096277,0.000037 },{ -0.009829,30.149424,0.000040 },{ -0.009644,30.116266,0.000030 },{ -0.009460,30.089136,0.000039 },{ -0.009856,30.102684,0.000039 },{ -0.009644,30.119713,0.000034 },{ -0.009555,30.078072,0.000035 },{ -0.009767,30.161676,0.000035 },{ -0.009521,30.095261,0.000036 },{ -0.009371,30.116306,0.000036 },{ -0.009740,30.088583,0.000037 },{ -0.009617,30.155800,0.000038 },{ -0.009644,30.163422,0.000036 },{ -0.009644,30.116638,0.000037 },{ -0.009583,30.089464,0.000037 },{ -0.009740,30.082798,0.000034 },{ -0.009678,30.105604,0.000038 },{ -0.009617,30.048664,0.000039 },{ -0.009617,30.125507,0.000036 },{ -0.009583,30.102467,0.000035 },{ -0.009794,30.074575,0.000040 },{ -0.009617,30.089588,0.000041 },{ -0.009740,29.992144,0.000034 },{ -0.009555,30.066420,0.000032 },{ -0.009706,30.102964,0.000035 },{ -0.009555,30.099918,0.000034 },{ -0.009740,30.029150,0.000040 },{ -0.009583,30.093157,0.000033 },{ -0.009583,30.075937,0.000040 },{ -0.009460,30.100727,0.000041 },{ -0.009706,30.071167,0.000045 },{ -0.009706,30.061317,0.000039 },{ -0.009555,30.127813,0.000039 },{ -0.009583,30.084124,0.000035 },{ -0.009678,30.117529,0.000040 },{ -0.009644,30.154600,0.000032 },{ -0.009432,30.084751,0.000035 },{ -0.009644,30.128626,0.000022 },{ -0.009856,30.099272,0.000041 },{ -0.009248,30.079121,0.000035 },{ -0.009644,30.032484,0.000041 },{ -0.009617,30.084803,0.000037 },{ -0.009678,30.091896,0.000037 },{ -0.009617,30.100233,0.000035 },{ -0.009644,30.055355,0.000040 },{ -0.009583,30.100735,0.000039 },{ -0.009617,30.093979,0.000040 },{ -0.009583,30.123526,0.000039 },{ -0.009521,30.033703,0.000037 },{ -0.009794,30.125597,0.000036 },{ -0.009767,30.113247,0.000039 },{ -0.009460,30.128714,0.000043 },{ -0.009678,30.116659,0.000036 },{ -0.009644,30.071289,0.000038 },{ -0.009678,30.144396,0.000036 },{ -0.009521,30.173021,0.000051 },{ -0.009460,30.069626,0.000039 },{ -0.009644,30.091524,0.000037 },{ -0.009583,30.090834,0.000034 },{ -0.009678,30.107199,0.000035 },{ -0.009644,30.097162,0.000036 },{ -0.009706,30.067608,0.000036 },{ -0.009678,30.064722,0.000036 },{ -0.009275,30.104256,0.000032 },{ -0.009706,30.157810,0.000032 },{ -0.009644,30.110098,0.000038 },{ -0.009644,30.114279,0.000036 },{ -0.009555,30.097219,0.000036 },{ -0.009678,30.089878,0.000038 },{ -0.009644,30.160168,0.000051 },{ -0.009678,30.054832,0.000037 },{ -0.009706,30.085533,0.000036 },{ -0.009583,30.150358,0.000038 },{ -0.009644,30.038744,0.000038 },{ -0.009706,30.090616,0.000034 },{ -0.009617,30.067902,0.000037 },{ -0.009740,30.048336,0.000039 },{ -0.009617,30.100368,0.000035 },{ -0.009678,30.076780,0.000038 },{ -0.009767,30.176191,0.000039 },{ -0.009706,30.045010,0.000040 },{ -0.009678,30.158043,0.000038 },{ -0.009644,30.083778,0.000037 },{ -0.009678,30.115829,0.000039 },{ -0.009740,30.041885,0.000038 },{ -0.009583,30.087597,0.000037 },{ -0.009740,30.117575,0.000032 },{ -0.009740,30.106226,0.000036 },{ -0.009678,30.089684,0.000035 },{ -0.009706,30.085714,0.000038 },{ -0.009555,30.157326,0.000038 },{ -0.009767,30.090906,0.000035 },{ -0.009706,30.069746,0.000036 },{ -0.009644,30.069315,0.000040 },{ -0.009767,30.122679,0.000034 },{ -0.009678,30.094717,0.000038 },{ -0.009767,30.080858,0.000040 },{ -0.009617,30.101807,0.000035 },{ -0.009617,30.063509,0.000039 },{ -0.009617,30.119551,0.000037 },{ -0.009555,30.077250,0.000040 },{ -0.009678,30.127857,0.000040 },{ -0.009555,30.095400,0.000036 },{ -0.009521,30.152866,0.000037 },{ -0.009337,30.053442,0.000037 },{ -0.009740,30.054527,0.000028 },{ -0.009398,30.108374,0.000038 },{ -0.009460,30.114466,0.000043 },{ -0.009432,30.158678,0.000012 },{ -0.010136,30.100088,0.000037 },{ -0.008975,30.026026,0.000042 },{ -0.009856,30.103579,0.000022 },{ -0.008606,30.127123,0.000042 },{ -0.008668,30.304731,0.000054 },{ -0.009494,30.090786,0.000032 },{ -0.008422,30.145401,0.000027 },{ -0.009678,30.112478,0.000032 },{ -0.010286,29.953817,0.000048 },{ -0.043911,30.115597,0.000158 },{ -0.043761,30.086142,0.000154 },{ -0.043850,30.117580,0.000154 },{ -0.043761,30.084240,0.000153 },{ -0.044007,30.039034,0.000159 },{ -0.043672,30.147968,0.000152 },{ -0.043945,30.108948,0.000155 },{ -0.043788,30.055225,0.000150 },{ -0.044103,30.120638,0.000153 },{ -0.043973,30.126070,0.000156 },{ -0.044342,29.934797,0.000156 },{ -0.044465,30.005474,0.000154 },{ -0.043700,30.053268,0.000149 },{ -0.044376,30.065203,0.000162 },{ -0.044314,30.089201,0.000153 },{ -0.044041,30.114611,0.000156 },{ -0.044007,30.116646,0.000163 },{ -0.043911,30.218975,0.000167 },{ -0.044068,30.138239,0.000155 },{ -0.044191,30.135328,0.000157 },{ -0.044068,30.100113,0.000160 },{ -0.044130,30.117563,0.000159 },{ -0.044191,30.150751,0.000156 },{ -0.044314,30.032179,0.000152 },{ -0.044007,30.079315,0.000159 },{ -0.044103,30.065849,0.000259 },{ -0.043911,30.061829,0.000156 },{ -0.043973,30.104403,0.000156 },{ -0.043816,30.099157,0.000151 },{ -0.044068,30.037155,0.000155 },{ -0.043945,30.072866,0.000154 },{ -0.044103,30.095444,0.000156 },{ -0.043761,30.018341,0.000156 },{ -0.044041,29.942326,0.000149 },{ -0.043877,30.105242,0.000157 },{ -0.044007,30.121662,0.000158 },{ -0.044007,30.103773,0.000154 },{ -0.043788,30.055597,0.000158 },{ -0.044164,30.048201,0.000156 },{ -0.042969,30.096653,0.000158 },{ -0.013613,29.998859,0.000006 },{ -0.014098,30.090841,0.000011 },{ -0.013763,30.182016,0.000010 },{ -0.013640,30.073112,0.000012 },{ -0.014043,30.085121,0.000009 },{ -0.014316,30.116076,0.000013 },{ -0.013886,30.046780,0.000008 },{ -0.014460,30.082508,0.000014 },{ -0.013947,30.109777,0.000008 },{ -0.013920,30.029840,0.000010 },{ -0.013585,30.089001,0.000014 },{ -0.014617,30.009121,0.000007 },{ -0.013886,30.036303,0.000007 },{ -0.013244,29.998695,0.000008 },{ -0.013244,30.041389,0.000009 },{ -0.013428,30.044426,0.000013 },{ -0.014651,30.176830,0.000006 },{ -0.014432,29.966619,0.000012 },{ -0.014009,30.053606,0.000016 },{ -0.013695,30.063192,0.000012 },{ -0.013490,30.033596,0.000007 },{ -0.013585,29.967136,0.000003 },{ -0.013305,30.062998,0.000016 },{ -0.014009,29.957092,0.000012 },{ -0.013278,30.083597,0.000014 },{ -0.013059,29.996277,0.000013 },{ -0.012943,29.985542,0.000007 },{ -0.013695,29.932060,0.000007 },{ -0.013339,29.984673,0.000016 },{ -0.013674,30.096056,0.000015 },{ -0.014255,30.044580,0.000008 },{ -0.013886,29.981632,0.000012 },{ -0.013640,29.936670,0.000005 },{ -0.013763,29.975271,0.000016 },{ -0.013824,30.096048,0.000019 },{ -0.014159,30.027205,0.000011 },{ -0.014774,30.016924,0.000011 },{ -0.014193,30.024366,0.000016 },{ -0.014043,30.007328,0.000016 },{ -0.013858,30.170792,0.000094 },{ -0.005403,29.951334,-0.000122 },{ -0.005833,29.823343,-0.000153 },{ 0.005143,29.970537,0.000176 },{ -0.008763,30.116781,0.000253 },{ -0.010040,29.808340,0.000027 },{ -0.007390,29.862705,-0.000031 },{ -0.005403,30.178810,-0.000000 },{ -0.010102,29.837250,0.000000 },{ -0.011782,29.928864,-0.000122 },{ -0.007445,29.896805,-0.000031 },{ -0.005799,29.863361,0.000250 },{ -0.007506,29.959875,-0.000061 },{ -0.012451,30.087805,-0.000305 },{ 0.003640,30.240921,0.000081 },{ 0.002152,29.884777,0.000076 },{ 0.004194,29.875242,0.000083 },{ -0.003880,30.252396,0.000296 },{ -0.007807,30.038593,-0.000366 },{ -0.014740,30.190531,-0.000183 },{ 0.004911,30.182850,0.000289 },{ -0.008210,29.701462,0.000065 },{ -0.000034,29.801319,0.000328 },{ 0.001018,30.019178,0.001683 },{ -0.013886,30.110767,0.000126 },{ 0.020661,29.868633,-0.000214 },{ -0.012513,30.140001,-0.000153 },{ -0.014740,30.229023,0.000348 },{ -0.010894,30.116871,0.000151 },{ -0.004699,30.005085,0.000462 },{ -0.004849,30.028885,0.000273 },{ -0.011017,30.098761,-0.000275 },{ -0.006168,29.938719,-0.000275 },{ -0.004761,29.768421,0.000024 },{ -0.015443,29.881454,-0.000458 },{ -0.000915,29.960524,-0.000336 },{ -0.016509,29.832075,-0.000336 },{ -0.003388,30.234455,0.000214 },{ 0.008114,30.142231,-0.000214 },{ -0.017424,29.900644,0.000250 },{ -0.032198,29.610785,-0.001129 },{ 0.016816,30.339542,-0.000702 },{ 0.018790,30.152073,0.000766 },{ -0.019678,30.041632,-0.000031 },{ 0.001912,29.916855,0.000268 },{ 0.003934,29.822510,0.001137 },{ 0.000895,30.130142,-0.000702 },{ 0.007629,29.902882,-0.000580 },{ 0.029124,30.093054,0.000630 },{ -0.010225,29.673731,-0.000244 },{ 0.013080,30.314581,0.000041 },{ 0.034028,30.515467,0.000231 },{ 0.022253,30.024820,0.000709 },{ -0.024835,30.114777,0.001704 },{ -0.000642,29.541952,-0.001099 },{ 0.012328,29.943657,-0.001862 },{ -0.024657,30.036251,-0.001160 },{ -0.019712,30.034416,0.000386 },{ -0.032655,29.950193,0.000260 },{ 0.028748,29.955603,0.002809 },{ -0.002261,30.069199,-0.001129 },{ -0.046541,30.113913,0.001254 },{ 0.025026,30.105341,-0.000916 },{ -0.007295,30.162203,-0.000793 },{ 0.017444,30.012897,-0.001190 },{ 0.003415,30.046806,0.000518 },{ -0.020723,29.954199,-0.000549 },{ -0.001284,30.061317,-0.001709 },{ 0.019439,29.868486,-0.000244 },{ -0.018681,29.740837,-0.000458 },{ 0.009111,29.847265,-0.000336 },{ -0.007445,30.207623,0.000473 },{ -0.035920,30.031384,-0.000214 },{ 0.009159,29.969564,0.000947 },{ 0.022956,29.835651,0.001258 },{ 0.038106,29.407938,-0.000275 },{ -0.013155,29.979242,-0.000122 },{ -0.009125,30.024281,-0.000366 },{ -0.037320,29.992455,-0.000122 },{ -0.003880,29.891283,-0.000061 },{ 0.022000,29.981705,-0.000458 },{ -0.001188,30.000036,0.000000 },{ -0.000949,30.000057,-0.000000 },{ -0.000642,30.000057,-0.000000 },{ -0.000888,30.000036,0.000000 },{ -0.001161,30.000057,-0.000000 },{ -0.000792,30.000044,0.000000 },{ -0.001038,30.000036,-0.000000 },{ -0.000888,30.000036,0.000000 },{ -0.000915,30.000036,-0.000000 },{ -0.000792,30.000057,0.000000 },{ -0.001100,30.000036,-0.000000 },{ -0.001127,30.000057,0.000000 },{ -0.001161,30.000057,-0.000000 },{ -0.000826,30.000044,0.000000 },{ -0.000731,30.000044,0.000000 },{ -0.000949,30.000044,0.000000 },{ -0.000915,30.000057,0.000000 },{ -0.001072,30.000044,0.000000 },{ -0.001072,30.000044,0.000000 },{ -0.001223,30.000057,-0.000000 },{ -0.001284,30.000036,0.000000 },{ -0.001250,30.000057,0.000000 },{ -0.001011,30.000036,0.000000 },{ -0.001161,30.000044,0.000000 },{ -0.001346,30.000036,0.000000 },{ -0.001161,30.000044,0.000000 },{ -0.001188,30.000036,0.000000 },{ -0.001100,30.000057,-0.000000 },{ -0.001284,30.000036,0.000000 },{ -0.001100,30.000057,-0.000000 },{ -0.000792,30.000036,0.000000 },{ -0.001038,30.000036,-0.000000 },{ -0.000765,30.000036,0.000000 },{ -0.001100,30.000057,-0.000000 },{ -0.001127,30.000036,0.000000 },{ -0.001223,30.000036,0.000000 },{ -0.001161,30.000036,0.000000 },{ -0.001100,30.000044,-0.000000 },{ -0.001100,30.000036,-0.000000 },{ -0.000704,30.000044,0.000000 },{ -0.024042,30.069172,0.000989 },{ -0.010259,29.939026,-0.000549 },{ 0.033912,30.028942,0.000836 },{ -0.023803,29.970629,-0.001221 },{ -0.008545,30.432230,-0.001465 },{ -0.007663,29.905001,-0.001312 },{ -0.034820,29.725712,0.000077 },{ 0.013920,29.926830,0.001956 },{ 0.003524,29.652643,0.000207 },{ -0.035647,29.782419,0.000603 },{ 0.014296,30.360302,-0.000641 },{ -0.022034,29.840391,0.001975 },{ -0.043549,30.270273,0.000319 },{ 0.000649,29.888704,-0.000580 },{ -0.034390,30.061634,-0.000610 },{ 0.017881,30.098467,-0.001587 },{ -0.005614,29.991789,-0.001190 },{ -0.045373,29.970015,0.001312 },{ -0.004795,30.514839,-0.000977 },{ -0.021638,30.230972,0.000514 },{ -0.017888,30.093334,-0.000488 },{ 0.030565,29.987797,-0.000153 },{ -0.004576,29.788099,-0.001526 },{ -0.027799,29.862722,-0.002289 },{ -0.018066,29.660023,0.000066 },{ 0.012964,30.026636,0.001263 },{ 0.007042,29.821247,-0.001831 },{ -0.015532,30.127625,-0.001038 },{ 0.018025,29.934593,0.001031 },{ -0.001311,30.039902,0.000845 },{ -0.003483,29.945251,-0.000122 },{ -0.002869,29.716713,-0.000366 },{ -0.000034,29.791695,0.000764 },{ 0.041924,29.935242,0.000253 },{ 0.039185,30.370796,0.000700 },{ 0.004959,30.305609,0.000153 },{ -0.012151,30.048773,0.000000 },{ -0.024596,29.252066,0.000224 },{ -0.005437,30.392622,0.000087 },{ -0.001161,30.493675,0.000320 },{ 0.006256,30.317488,-0.000092 },{ 0.006140,29.858471,0.000115 },{ 0.016420,29.916866,-0.000122 },{ -0.003087,29.900322,-0.000092 },{ 0.008770,30.056561,-0.000183 },{ 0.011318,29.903578,-0.000092 },{ 0.013387,30.090065,-0.000061 },{ -0.003053,29.903263,0.000046 },{ 0.006509,29.707632,0.000017 },{ 0.017670,29.804655,0.000668 },{ 0.005177,30.026073,0.000010 },{ 0.004446,29.821810,0.000358 },{ -0.017424,30.136713,-0.000763 },{ -0.003176,30.295753,-0.000397 },{ 0.009207,29.800240,0.000110 },{ 0.012977,30.149441,-0.000244 },{ 0.014774,30.284218,-0.000366 },{ -0.014862,29.968693,0.000783 },{ 0.021522,29.915178,0.000225 },{ 0.008524,29.904137,-0.000214 },{ -0.014835,30.141703,0.000214 },{ 0.007165,30.252481,0.000127 },{ -0.000061,29.939497,0.000395 },{ -0.020812,29.902079,0.000009 },{ -0.001284,29.910404,-0.000122 },{ 0.014111,29.953318,0.000130 },{ 0.017786,30.000843,0.000248 },{ 0.019104,30.308865,-0.000244 },{ -0.021085,29.886597,-0.000305 },{ 0.000943,29.953096,0.000147 },{ 0.001680,30.121979,-0.000092 },{ 0.010170,30.080046,-0.000214 },{ 0.003313,29.941416,0.000085 },{ 0.011051,30.194332,-0.000092 },{ 0.008715,30.183079,0.000041 },{ 0.006666,30.135902,0.000081 },{ 0.004829,30.169556,0.000041 },{ 0.008524,29.826904,0.000040 },{ 0.007616,30.233250,0.000503 },{ 0.003852,29.840305,0.000052 },{ 0.012711,29.976547,0.000033 },{ 0.012752,29.917797,0.000025 },{ 0.012690,30.056259,0.000024 },{ 0.012964,29.878777,0.000015 },{ 0.012923,29.882147,0.000023 },{ 0.012711,29.938616,0.000017 },{ 0.012984,30.080736,0.000025 },{ 0.012738,29.991348,0.000024 },{ 0.012772,29.770733,0.000023 },{ 0.012670,29.924942,0.000008 },{ 0.012725,29.779715,0.000022 },{ 0.012704,29.994518,0.000014 },{ 0.013216,30.006723,0.000023 },{ 0.012930,29.965395,0.000025 },{ 0.012930,30.012331,0.000023 },{ 0.012848,29.984133,0.000023 },{ 0.012690,29.879736,0.000022 },{ 0.012820,29.888683,0.000022 },{ 0.013052,29.951696,0.000026 },{ 0.012868,29.941181,0.000027 },{ 0.012602,29.971087,0.000026 },{ 0.013093,29.982098,0.000018 },{ 0.012581,29.970512,0.000023 },{ 0.013230,30.006926,0.000023 },{ 0.012745,29.970110,0.000026 },{ 0.012718,29.967085,0.000026 },{ 0.012690,29.987305,0.000022 },{ 0.013025,29.892933,0.000028 },{ 0.012656,29.930723,0.000023 },{ 0.012670,30.127962,0.000028 },{ 0.012848,30.044857,0.000020 },{ 0.012670,29.934183,0.000023 },{ 0.013155,29.866692,0.000035 },{ 0.012711,29.975328,0.000024 },{ 0.013216,29.898813,0.000024 },{ 0.012786,29.990376,0.000019 },{ 0.012902,29.868347,0.000027 },{ 0.013148,29.963747,0.000029 },{ 0.012957,29.934566,0.000024 },{ 0.012615,30.042555,0.000024 },{ 0.288036,29.678513,0.004640 },{ 0.291840,29.719957,0.004572 },{ 0.286888,29.604616,0.004489 },{ 0.279860,29.698326,0.004531 },{ 0.285884,29.631916,0.004636 },{ 0.280393,29.698750,0.004521 },{ 0.290584,29.689331,0.004492 },{ 0.294996,29.659279,0.004557 },{ 0.284512,29.584471,0.004570 },{ 0.280243,29.669113,0.004471 },{ 0.291458,29.751923,0.004496 },{ 0.288712,29.726255,0.004556 },{ 0.285898,29.708811,0.004573 },{ 0.287291,29.782608,0.004509 },{ 0.292073,29.730080,0.004512 },{ 0.286301,29.632801,0.004492 },{ 0.283719,29.701595,0.004486 },{ 0.288835,29.685581,0.004663 },{ 0.295208,29.699074,0.004527 },{ 0.286219,29.723974,0.004517 },{ 0.289928,29.669376,0.004527 },{ 0.291840,29.764416,0.004572 },{ 0.294374,29.663893,0.004562 },{ 0.292154,29.658623,0.004518 },{ 0.289040,29.671146,0.004558 },{ 0.287845,29.588696,0.004558 },{ 0.294682,29.705769,0.004590 },{ 0.287578,29.625828,-0.001343 },{ 0.286820,29.700663,0.004650 },{ 0.285317,29.780664,0.004473 },{ 0.288295,29.816957,0.004577 },{ 0.290529,29.793154,0.004615 },{ 0.278002,29.665539,0.004491 },{ 0.287770,29.674189,0.004534 },{ 0.287804,29.679903,0.004547 },{ 0.293589,29.742228,0.004490 },{ 0.283391,29.675373,0.004530 },{ 0.288596,29.728127,0.004485 },{ 0.281069,29.664715,0.004533 },{ 0.282497,29.631531,0.004509 },{ -2.848783,29.172089,-1.564148 },{ -2.022460,29.067934,-2.096558 },{ -3.416071,29.253080,-1.975006 },{ -2.999293,29.194201,-2.400116 },{ -3.197389,29.123924,-3.209016 },{ -2.254720,29.314812,-1.578461 },{ -2.014428,29.382109,-0.926758 },{ -2.171016,29.306957,-1.278076 },{ -2.304349,29.151308,-1.581482 },{ -3.409815,29.290070,-1.974182 },{ -3.088926,29.147642,-1.442016 },{ -3.416870,29.248932,-1.975006 },{ -3.405088,29.195574,-1.800995 },{ -2.659327,29.080185,-1.410614 },{ -3.189630,29.157141,-1.905518 },{ -2.528229,28.953608,-2.518311 },{ -2.850436,29.162409,-1.565430 },{ -2.984007,29.075321,-1.456604 },{ -4.012107,29.014198,-2.348725 },{ -3.409637,29.261322,-1.974182 },{ -3.172998,29.188826,-1.699860 },{ -3.353548,29.296206,-1.951385 },{ -3.190088,29.267475,-1.905273 },{ -2.524834,29.026606,-2.518036 },{ -3.182315,29.170900,-1.904205 },{ -3.429445,29.161367,-1.550323 },{ -3.169822,29.277546,-1.699677 },{ -3.420012,29.254133,-1.052917 },{ -3.372775,29.208435,-1.483551 },{ -2.808130,29.169086,-2.115235 },{ -2.802543,29.186209,-1.876587 },{ -2.764860,29.174059,-1.585632 },{ -1.935607,29.250584,-0.955353 },{ -3.728511,29.189928,-1.422669 },{ -3.384516,29.145300,-1.738282 },{ -2.944515,28.964621,-2.269531 },{ -3.431733,29.206448,-1.810944 },{ -3.745389,29.044865,-2.101563 },{ -3.089260,29.219025,-1.949768 },{ -3.147003,29.137156,-1.837585 },{ -3.021300,29.230316,-1.625092 },{ -2.765441,29.235842,-1.585602 },{ -2.549894,29.173420,-1.225586 },{ -3.017386,29.219763,-1.624908 },{ -3.418947,29.239222,-1.975434 },{ -2.661103,29.284920,-1.410828 },{ -2.240227,29.298918,-0.700470 },{ -2.788752,29.314047,-1.626038 },{ -2.511652,29.255413,-1.237000 },{ -1.978269,29.223293,-0.959503 },{ -2.570125,29.249128,-1.863861 },{ -4.039483,29.298361,-2.323273 },{ -2.268490,29.240513,-1.579102 },{ -3.113063,29.145571,-1.833771 },{ -2.548767,29.202690,-1.226532 },{ -2.905576,29.127985,-2.265808 },{ -2.725669,29.262135,-1.582031 },{ -2.660550,29.316704,-2.706360 },{ -2.497001,29.151291,-2.477661 },{ -2.660645,29.240927,-1.410797 },{ -3.089103,29.258125,-1.441803 },{ -2.045983,29.225224,-2.137543 },{ -2.724303,29.275337,-1.582153 },{ -3.140958,29.131582,-1.835938 },{ -2.279999,29.367012,-1.592712 },{ -2.484802,29.254023,-1.177154 },{ -3.020070,29.136114,-1.624542 },{ -2.744903,29.087158,-1.621765 },{ -3.090517,29.221905,-1.441956 },{ -2.943115,29.096809,-2.269287 },{ -2.266325,29.160191,-1.578888 },{ -3.562736,29.210968,-2.809724 },{ -2.227721,29.113041,-1.523651 },{ -2.493347,29.218796,-2.424652 },{ -2.704707,29.242722,-1.587646 },{ -3.182431,29.150755,-1.903778 },{ -2.545803,29.229811,-1.226410 },{ -2.003076,29.159241,-2.091553 },{ -3.239627,29.210220,-1.686768 },{ -3.052883,29.290661,-1.439514 },{ -2.152124,29.161936,-2.308014 },{ -2.026305,29.024748,-2.097015 },{ -2.548057,29.267912,-1.226837 },{ -2.852321,29.143049,-1.565155 },{ -3.087641,29.228443,-1.441315 },{ -3.149537,29.274633,-1.902069 },{ -2.975039,29.146206,-1.619720 },{ -2.306452,29.137808,-1.581574 },{ -3.472960,29.200420,-1.555023 },{ -3.147187,29.121288,-1.901642 },{ -3.385950,29.255703,-1.991760 },{ -3.087307,29.198286,-1.441528 },{ -2.619992,29.138979,-1.407501 },{ -4.136963,29.256021,-1.786652 },{ -3.092648,29.101048,-1.441772 },{ -3.130699,29.208231,-1.835480 },{ -3.174590,29.249538,-1.905060 },{ -2.268579,29.254147,-1.527893 },{ -2.820492,29.196493,-1.554443 },{ -2.788117,29.284338,-1.626434 },{ -2.791321,29.217178,-0.874115 },{ -2.550440,29.290134,-1.226776 },{ -3.183046,29.207432,-1.904144 },{ -2.204218,29.165039,-1.532928 },{ -2.545932,29.254587,-1.226318 },{ -2.506099,29.057167,-1.223663 },{ -4.002893,29.293453,-2.351074 },{ -2.790890,29.308285,-1.626160 },{ -2.766049,29.420950,-1.584930 },{ -2.514862,29.234783,-1.168823 },{ -3.566253,28.981249,-1.579346 },{ -3.142058,29.266409,-1.658631 },{ -3.027283,29.141356,-1.459564 },{ -3.095025,29.231056,-1.442413 },{ -2.144228,29.291538,-1.237640 },{ -2.483914,29.216440,-1.177399 },{ -2.762333,29.152390,-1.819642 },{ -2.605526,29.173454,-1.924744 },{ -3.724338,29.148748,-2.094666 },{ -3.192437,29.054861,-1.905548 },{ -3.191556,29.243290,-1.905701 },{ -3.191768,29.144440,-1.910522 },{ -4.006958,29.174522,-2.319123 },{ -2.627198,29.314461,-1.420044 },{ -2.857048,29.183395,-1.565582 },{ -3.340850,29.286846,-1.987061 },{ -2.304629,29.126217,-1.581360 },{ -2.851440,29.202391,-1.565369 },{ -3.065607,29.172058,-1.908416 },{ -3.106992,29.258848,-1.652283 },{ -2.891629,29.226074,-1.569733 },{ -2.549798,29.205147,-1.227051 },{ -2.515258,29.221922,-1.168274 },{ -2.943142,29.200426,-2.268250 },{ -3.385684,29.291128,-1.991546 },{ -3.110010,29.179909,-1.653443 },{ -3.607146,29.165194,-1.655945 },{ -3.092682,29.158806,-1.441803 },{ -3.025056,29.240633,-1.459381 },{ -2.299766,29.141092,-1.585236 },{ -3.168613,29.108240,-1.903535 },{ -3.053217,29.233072,-1.377106 },{ -3.430756,29.179377,-1.811218 },{ -2.968503,29.093557,-2.864838 },{ -2.264918,29.187136,-1.527741 },{ -3.793425,29.072590,-2.180451 },{ -2.808075,29.190741,-1.322388 },{ -3.375855,29.220989,-1.970398 },{ -2.859527,29.235554,-1.565491 },{ -2.547633,29.218161,-1.226959 },{ -2.719023,29.277067,-1.630493 },{ -2.850183,29.137695,-1.564484 },{ -2.725887,29.393618,-1.593506 },{ -2.177942,29.180000,-2.348481 },{ -3.925986,29.266403,-2.075897 },{ -2.760284,29.170300,-1.635285 },{ -2.974581,29.255159,-2.357910 },{ -2.729248,29.247040,-1.594391 },{ -2.808314,29.001385,-1.877228 },{ -3.448938,29.186466,-1.553131 },{ -2.509678,29.250765,-1.167847 },{ -2.695336,29.132244,-2.798828 },{ -2.531186,29.107222,-1.575714 },{ -3.342462,29.319157,-1.984985 },{ -2.586879,29.163181,-1.415588 },{ -3.178736,29.081373,-3.155518 },{ -3.191529,29.150185,-1.905243 },{ -2.513824,29.105425,-2.467499 },{ -2.848845,29.148674,-1.564240 },{ -4.677491,29.182981,-2.672364 },{ -2.518256,29.377041,-1.238068 },{ -3.392480,29.120592,-1.740204 },{ -3.148314,29.233627,-1.838135 },{ -3.438413,29.287624,-1.491089 },{ -2.242249,29.195532,-1.589172 },{ -3.189575,29.206633,-1.906128 },{ -2.510005,29.284578,-1.168030 },{ -3.379632,29.200064,-1.971497 },{ -2.780399,29.318165,-1.625397 },{ -2.541281,29.168079,-1.225952 },{ -3.354852,29.179752,-1.930939 },{ -2.733544,29.048389,-1.984345 },{ -2.942076,29.118238,-2.268708 },{ -2.519950,29.292688,-1.237946 },{ -3.204957,29.232866,-1.683411 },{ -2.163087,28.872625,-2.305603 },{ -3.172882,29.180958,-1.701263 },{ -3.429595,29.187555,-1.550812 },{ -3.390649,29.256334,-1.991730 },{ -2.764553,29.229258,-1.635162 },{ -3.138185,29.326263,-1.214935 },{ -2.035178,29.175343,-2.132446 },{ -2.507383,29.193306,-1.224335 },{ -3.608361,29.187254,-1.685730 },{ -2.924496,29.245901,-2.267823 },{ -2.723572,29.119797,-1.630859 },{ -2.746030,29.320303,-1.623627 },{ -2.940062,29.129826,-2.267883 },{ -2.724480,29.258162,-1.628510 },{ -2.777312,29.140713,-1.896607 },{ -2.043456,29.166245,-1.604828 },{ -3.050076,29.178450,-1.438904 },{ -3.055779,29.206741,-1.439484 },{ -2.143156,29.147202,-2.266724 },{ -3.177028,29.159214,-1.905395 },{ -3.435571,29.188354,-1.551056 },{ -3.568972,29.157724,-1.611695 },{ -2.236327,29.184820,-1.525207 },{ -3.126253,29.172024,-1.834961 },{ -3.243868,29.175667,-1.687836 },{ -2.509801,29.373558,-1.224396 },{ -2.696354,29.137468,-2.799927 },{ -4.045077,29.263971,-2.323700 },{ -3.764008,29.250765,-1.424805 },{ -3.130030,29.352360,-1.215179 },{ -3.217709,29.076729,-3.249603 },{ -3.408660,29.205654,-1.973969 },{ -2.793151,29.268005,-0.821930 },{ -2.268278,29.181435,-1.758789 },{ -3.413148,29.329262,-1.974365 },{ -2.230986,29.159975,-1.259888 },{ -3.168245,29.082350,-1.904785 },{ -3.753052,29.215637,-2.325135 },{ -3.194056,29.104702,-1.906311 },{ -2.507472,29.229471,-1.223266 },{ -3.045069,29.219770,-1.375183 },{ -2.661376,29.158691,-2.760468 },{ -2.181788,29.098383,-2.348816 },{ -3.216001,29.135492,-3.189942 },{ -2.507724,29.260546,-1.224213 },{ -2.128656,29.276890,-1.273681 },{ -2.693205,29.269405,-1.831421 },{ -3.470883,29.025255,-1.554413 },{ -3.045527,29.182682,-1.439514 },{ -2.549402,29.217813,-1.226868 },{ -3.376586,29.192972,-1.971619 },{ -3.812803,29.144674,-2.176728 },{ -3.173401,29.259211,-1.905030 },{ -3.633298,29.294092,-1.657013 },{ -1.768978,29.266520,-1.283661 },{ -3.387787,29.285654,-1.993011 },{ -3.533380,29.298748,-2.067505 },{ -2.667660,29.100321,-2.756897 },{ -2.484003,29.251572,-1.178070 },{ -3.672879,29.137749,-2.348389 },{ -2.614255,29.202961,-1.924591 },{ -2.005002,29.259798,-1.011383 },{ -3.389099,29.081602,-1.740021 },{ -3.389276,29.268656,-1.933899 },{ -3.146204,29.080629,-2.252625 },{ -3.202361,29.039791,-1.683838 },{ -2.848448,29.084177,-1.563721 },{ -2.522942,29.064819,-1.626678 },{ -2.518857,29.167576,-1.624878 },{ -2.546690,29.182211,-1.226379 },{ -2.485137,29.091526,-2.426911 },{ -3.152371,29.207756,-2.253327 },{ -3.151517,29.345291,-1.902588 },{ -2.547660,29.200550,-1.226227 },{ -2.759396,29.265474,-1.635529 },{ -2.769560,29.262205,-1.586090 },{ -3.383177,29.132481,-1.971741 },{ -2.791867,29.276709,-1.626038 },{ -2.539061,29.270767,-1.225739 },{ -3.190586,29.129229,-1.904815 },{ -2.544983,29.095133,-1.226471 },{ -2.575801,29.117451,-1.635559 },{ -2.909790,29.112268,-2.265717 },{ -3.083974,29.185797,-1.440765 },{ -2.502684,29.183258,-1.223083 },{ -3.384003,29.316696,-1.934937 },{ -4.096344,29.129976,-1.783386 },{ -3.219048,29.178047,-1.913025 },{ -3.332675,29.195133,-1.969330 },{ -3.018547,29.111408,-1.623474 },{ -3.973934,29.138054,-2.317047 },{ -2.518461,29.278595,-1.237640 },{ -1.925294,29.272724,-1.006561 },{ -3.056482,29.168991,-1.440246 },{ -2.544614,29.298403,-1.226501 },{ -3.065061,29.133917,-1.462005 },{ -2.509056,29.198084,-1.168243 },{ -3.086822,29.091738,-1.441589 },{ -3.105803,29.260979,-2.250427 },{ -2.269037,29.241463,-1.591309 },{ -2.503783,29.356371,-1.224609 },{ -2.546718,29.275938,-1.226379 },{ -2.506618,29.188000,-1.224091 },{ -3.176086,29.259836,-1.906372 },{ -3.147426,29.195354,-1.902862 },{ -3.415654,29.202936,-1.974549 },{ -2.828675,29.246569,-0.876404 },{ -2.377555,29.191940,-1.918487 },{ -2.817200,29.233816,-1.562195 },{ -3.478424,29.120096,-2.618653 },{ -3.149468,29.219357,-1.837524 },{ -2.578458,29.249357,-1.227966 },{ -2.814789,29.273609,-1.562164 },{ -3.345365,29.230152,-1.767792 },{ -3.190306,29.185751,-1.905609 },{ -3.450707,29.163759,-1.553131 },{ -2.302211,29.178629,-1.581451 },{ -2.815486,29.173771,-1.562073 },{ -2.130671,29.362183,-1.273865 },{ -3.054870,29.251530,-1.439606 },{ -2.513701,29.069351,-1.167938 },{ -4.151423,29.133614,-2.032440 },{ -2.482357,29.280558,-1.235565 },{ -3.389707,29.269911,-1.933410 },{ -3.414548,29.224247,-1.052063 },{ -3.017912,29.214630,-1.393524 },{ -4.335025,29.188635,-2.735901 },{ -3.225946,29.262093,-1.914093 },{ -3.331295,29.179083,-1.827057 },{ -3.561336,29.144211,-1.582794 },{ -3.164365,29.146450,-1.903229 },{ -2.765318,29.357315,-1.635346 },{ -3.055451,29.188005,-1.434906 },{ -3.062342,29.321045,-1.461365 },{ -3.182404,29.258062,-1.904419 },{ -3.177336,29.326653,-1.905273 },{ -2.508264,29.212471,-1.224396 },{ -2.866446,29.102468,-2.201782 },{ -3.352352,29.377110,-1.930603 },{ -3.432764,29.201065,-1.550659 },{ -2.797973,29.169155,-1.876160 },{ -2.756008,29.326382,-1.622803 },{ -3.786158,29.214016,-1.924835 },{ -2.986015,29.107912,-2.370636 },{ -3.429049,29.196541,-1.490448 },{ -2.549341,29.257500,-1.227020 },{ -2.570248,29.146107,-1.634766 },{ -2.812433,29.161772,-1.500092 },{ -2.542784,29.305546,-1.226837 },{ -2.492281,29.090187,-2.464752 },{ -3.138212,29.237474,-1.215027 },{ -2.765926,29.267221,-1.635620 },{ -2.479577,29.184662,-1.234924 },{ -3.213952,29.132921,-1.646301 },{ -2.963776,29.159203,-2.858125 },{ -3.207880,29.106531,-1.912446 },{ -2.054261,29.072966,-2.139130 },{ -3.237667,29.189867,-1.688019 },{ -2.786307,29.267580,-1.626923 },{ -2.540776,29.115196,-1.225708 },{ -3.358575,29.244577,-1.950745 },{ -2.477173,29.211020,-1.234558 },{ -3.150964,29.117062,-1.901764 },{ -4.008146,29.059940,-2.320465 },{ -2.536036,29.093599,-1.630982 },{ -3.794648,29.257196,-1.989655 },{ -2.406774,29.146389,-1.972779 },{ -3.055601,29.232567,-1.944855 },{ -3.516448,28.890934,-2.621491 },{ -3.426269,29.229195,-1.550324 },{ -3.379366,29.294247,-1.991089 },{ -3.765128,29.115606,-2.173767 },{ -2.505341,29.143541,-1.223144 },{ -3.436179,29.088142,-1.812683 },{ -3.186030,29.199696,-3.209107 },{ -2.940608,29.119896,-2.269043 },{ -2.501365,29.181286,-1.224029 },{ -2.908595,29.130297,-2.265229 },{ -2.938989,29.200830,-2.268433 },{ -2.376585,29.236227,-1.917786 },{ -3.168183,29.167332,-1.903839 },{ -3.056878,29.158848,-1.439209 },{ -3.191064,29.067743,-1.905609 },{ -2.738981,29.316612,-1.893402 },{ -2.654266,29.181564,-2.759827 },{ -2.548029,29.227154,-1.226471 },{ -3.383054,29.337902,-1.991364 },{ -2.695247,29.080872,-2.798798 },{ -2.592371,29.262995,-1.227813 },{ -2.796443,29.266171,-1.316711 },{ -2.180900,29.197390,-1.692993 },{ -2.748844,29.249666,-1.622803 },{ -2.790405,29.216864,-1.626068 },{ -3.595493,29.205313,-1.585358 },{ -2.554443,29.261271,-1.226441 },{ -2.511781,29.177347,-1.568329 },{ -3.193482,29.163099,-1.905884 },{ -2.244564,29.187401,-1.706482 },{ -3.721346,29.077549,-2.283600 },{ -2.934263,29.029034,-2.268280 },{ -3.091337,29.109398,-1.441742 },{ -3.346799,29.210238,-1.986298 },{ -3.085838,29.149679,-1.948730 },{ -3.749787,29.239676,-2.325470 },{ -3.588588,29.112333,-1.655335 },{ -2.543699,29.246059,-1.225800 },{ -3.416740,29.205935,-1.974976 },{ -2.833524,29.240379,-0.876831 },{ -3.190675,29.129776,-1.905945 },{ -2.232754,29.236374,-1.524536 },{ -3.388825,29.259682,-1.934356 },{ -2.509644,29.231394,-1.224030 },{ -3.317566,29.227331,-1.927215 },{ -2.821380,29.325029,-1.585907 },{ -3.051482,29.137177,-1.966400 },{ -2.633393,29.389128,-1.420166 },{ -3.437805,29.065861,-1.551453 },{ -2.052977,29.211115,-2.138764 },{ -2.226505,29.169403,-1.525055 },{ -2.508783,29.310133,-1.157257 },{ -3.186795,29.156345,-1.905579 },{ -2.650298,29.281713,-1.409851 },{ -2.807030,29.156252,-2.086121 },{ -3.470945,29.253862,-1.554107 },{ -2.685480,29.093603,-2.747956 },{ -2.273162,29.152874,-1.317322 },{ -2.502984,29.094296,-2.477540 },{ -2.536377,29.148790,-1.631317 },{ -3.082000,29.212471,-1.440979 },{ -2.242488,29.219591,-1.262055 },{ -3.389222,29.255764,-1.740448 },{ -3.042596,29.279140,-1.375610 },{ -3.151183,29.098299,-1.902313 },{ -3.099669,29.152575,-2.185975 },{ -3.243561,29.260307,-1.687714 },{ -2.746269,29.250090,-0.818573 },{ -2.855347,29.224886,-1.564972 },{ -3.086631,29.074812,-1.440857 },{ -3.792046,29.237211,-1.988800 },{ -3.045130,29.075960,-1.375885 },{ -3.047972,29.275019,-1.439209 },{ -2.761835,29.044903,-1.986359 },{ -3.432464,29.211540,-1.812073 },{ -3.411222,29.202991,-1.975067 },{ -2.471347,29.187838,-1.164734 },{ -3.054474,29.209126,-1.440460 },{ -2.811675,29.216255,-1.561218 },{ -3.406461,29.227608,-1.800018 },{ -3.338159,29.380707,-1.985260 },{ -3.534875,29.254068,-2.068146 },{ -2.712917,29.267530,-1.619446 },{ -3.047296,29.270857,-1.944489 },{ -2.985865,29.259655,-2.401215 },{ -3.748749,29.126213,-2.324768 },{ -3.144557,29.133392,-1.900909 },{ -2.984553,29.272064,-1.380493 },{ -2.547087,29.242836,-1.226868 },{ -2.539300,29.137257,-1.576660 },{ -3.765927,29.176254,-1.424194 },{ -2.696654,29.093506,-2.798676 },{ -3.089752,29.141247,-1.441559 },{ -3.212887,29.205990,-1.704407 },{ -2.474393,29.244072,-1.235474 },{ -2.546930,29.123280,-1.627777 },{ -2.975183,29.110298,-2.864411 },{ -3.724119,29.197323,-2.284668 },{ -3.411522,29.240423,-1.973999 },{ -2.622342,29.252861,-1.406769 },{ -2.998842,29.175524,-1.623260 },{ -3.053525,29.219364,-1.439422 },{ -3.148130,29.235014,-2.252839 },{ -2.690179,29.087370,-2.797639 },{ -2.902161,29.102823,-2.265747 },{ -3.189029,29.136145,-1.905945 },{ -4.038151,29.275450,-2.322663 },{ -2.497984,29.095272,-2.520966 },{ -3.742431,29.241056,-2.102478 },{ -4.130891,29.242313,-1.785491 },{ -3.215755,29.300667,-1.913543 },{ -2.267787,29.203537,-1.579224 },{ -2.008451,29.244076,-1.011658 },{ -3.391715,29.108715,-1.934875 },{ -2.688786,29.240932,-2.798493 },{ -3.168668,29.127115,-1.903534 },{ -3.193291,29.116259,-1.905884 },{ -3.378478,29.203289,-1.990875 },{ -3.421262,29.288250,-1.975647 },{ -3.430940,29.153507,-1.551452 },{ -3.475801,29.296131,-1.554504 },{ -2.510593,29.088531,-2.466095 },{ -2.804503,29.198385,-1.876556 },{ -1.628536,29.225979,-1.852295 },{ -2.591975,29.204498,-1.594574 },{ -3.151757,29.113089,-1.902222 },{ -3.454805,29.495180,-1.554322 },{ -3.084561,29.090765,-1.440948 },{ -3.726961,29.212980,-2.094788 },{ -3.089260,29.170511,-1.442108 },{ -4.099637,29.137941,-1.783508 },{ -2.888637,29.200979,-1.569305 },{ -2.509521,29.202068,-1.168182 },{ -3.089964,29.180746,-1.441742 },{ -2.817200,29.187708,-1.562561 },{ -3.578520,29.180029,-2.041229 },{ -3.183653,29.217127,-1.642548 },{ -3.731660,29.366758,-1.420654 },{ -2.243833,29.310728,-1.537506 },{ -3.193359,29.084688,-1.905029 },{ -3.050472,29.251690,-1.439789 },{ -3.726291,29.190321,-1.420257 },{ -2.942616,29.048683,-2.269257 },{ -2.856535,29.172239,-1.565827 },{ -3.133820,29.074505,-1.901398 },{ -3.060328,29.168608,-1.461396 },{ -3.051783,29.244980,-1.440430 },{ -3.088345,29.193983,-1.441681 },{ -3.075279,29.072870,-2.184784 },{ -2.510620,29.205507,-1.168029 },{ -3.384003,29.044340,-1.935425 },{ -2.734828,29.166763,-1.894348 },{ -3.416351,29.259153,-1.974457 },{ -3.184658,29.129154,-1.904816 },{ -4.165343,29.141727,-2.304993 },{ -3.215086,29.290646,-1.646576 },{ -2.608483,29.130550,-1.923401 },{ -3.771883,29.158710,-2.173859 },{ -3.014825,29.289652,-1.395477 },{ -3.193359,29.086985,-1.905487 },{ -2.000515,29.254442,-1.011078 },{ -2.736727,29.117590,-1.484680 },{ -3.050171,29.176764,-1.377747 },{ -3.172759,29.167446,-1.905091 },{ -3.404876,29.127604,-1.800415 },{ -3.051148,29.191292,-1.965759 },{ -2.891752,29.195894,-1.570099 },{ -3.200961,29.208815,-1.683380 },{ -3.031279,29.197504,-1.457916 },{ -2.977628,29.166080,-2.369751 },{ -2.511624,29.406630,-1.224640 },{ -3.134913,29.169968,-1.901550 },{ -3.026272,29.172710,-1.460175 },{ -4.061278,29.092987,-1.710876 },{ -3.091309,29.187206,-1.441040 },{ -2.507103,29.260113,-1.223144 },{ -2.242091,29.194386,-0.700378 },{ -3.090695,29.163988,-1.441528 },{ -3.031613,29.140404,-1.459869 },{ -3.377289,29.140249,-1.971039 },{ -2.269098,28.889339,-1.528900 },{ -2.013362,29.174660,-2.088043 },{ -3.354798,29.202200,-1.738067 },{ -3.823731,29.268772,-1.964661 },{ -2.654963,29.102369,-1.411102 },{ -2.549163,29.241127,-1.227081 },{ -3.168211,29.175264,-1.903687 },{ -3.379851,29.289898,-1.970795 },{ -2.531493,29.229469,-1.939117 },{ -3.456260,29.219872,-1.553772 },{ -4.006739,29.229042,-2.318543 },{ -2.812255,29.198503,-1.500763 },{ -3.810576,29.135614,-2.175720 },{ -2.813594,28.926905,-1.500824 },{ -2.755155,29.274115,-1.622589 },{ -3.533632,29.231117,-2.769654 },{ -3.802305,29.173328,-2.175568 },{ -2.631467,29.299597,-1.419342 },{ -2.750367,29.304499,-1.622497 },{ -3.057643,29.181623,-1.440674 },{ -3.321801,29.196264,-1.946991 },{ -3.809108,29.242626,-2.175537 },{ -2.803581,29.250496,-1.876678 },{ -2.404138,29.343105,-1.954834 },{ -3.472099,29.207838,-1.554504 },{ -3.403804,29.126076,-1.811951 },{ -3.136074,29.187408,-1.694458 },{ -2.587303,29.218550,-1.593414 },{ -2.751439,29.219999,-1.622101 },{ -3.472769,29.101358,-1.554565 },{ -3.374052,29.284746,-1.970184 },{ -2.571074,29.227129,-1.372375 },{ -3.385096,29.234831,-1.991882 },{ -2.493224,29.113045,-1.572143 },{ -2.700595,29.124266,-2.799866 },{ -2.508913,29.215029,-1.167542 },{ -2.696961,29.064875,-2.799469 },{ -2.695705,29.139904,-2.798188 },{ -1.804843,29.233885,-1.286499 },{ -3.271729,29.204401,-2.107910 },{ -2.600396,29.273745,-1.928467 },{ -2.989287,29.195318,-1.891113 },{ -2.367671,29.108595,-1.916656 },{ -4.007108,29.211174,-2.321289 },{ -3.388491,29.135233,-1.933472 },{ -2.768009,29.223080,-1.897766 },{ -2.718900,29.374842,-1.630280 },{ -2.665372,29.100792,-2.757386 },{ -3.433720,29.208216,-1.491241 },{ -3.098570,29.217308,-1.154785 },{ -2.547517,29.165409,-1.226532 },{ -2.718019,29.229076,-1.580383 },{ -2.757566,29.370041,-1.636292 },{ -2.269098,29.151525,-1.528351 },{ -2.919366,29.071596,-1.753174 },{ -3.432648,28.981064,-1.550354 },{ -3.185149,29.108698,-1.904266 },{ -2.686095,29.137323,-2.800904 },{ -3.558166,29.113663,-1.822204 },{ -3.221862,29.055101,-3.190247 },{ -3.254756,29.200455,-1.265381 },{ -2.983638,29.197773,-2.359528 },{ -2.010405,29.330364,-1.011749 },{ -3.640074,29.247524,-1.657166 },{ -2.231628,29.115274,-1.589935 },{ -3.185327,29.089514,-1.904571 },{ -2.271113,29.240879,-1.528107 },{ -3.417444,29.291883,-1.974915 },{ -3.194821,29.178444,-1.906128 },{ -3.193906,29.015507,-1.905304 },{ -3.397186,29.100546,-1.812317 },{ -4.097383,29.016619,-2.973206 },{ -4.010646,29.234619,-2.320618 },{ -3.184118,29.103598,-1.904144 },{ -3.428249,29.207644,-1.550323 },{ -2.766910,29.378609,-1.586578 },{ -3.418912,29.244574,-1.052734 },{ -2.853175,29.325853,-1.565063 },{ -3.056182,29.189013,-1.439972 },{ -3.208194,29.213055,-1.704102 },{ -3.003480,29.059595,-2.901978 },{ -3.082669,29.102068,-1.440735 },{ -3.469087,29.199265,-1.553864 },{ -2.537190,29.138197,-1.631256 },{ -2.985960,29.225029,-1.388397 },{ -3.028014,29.186743,-1.460266 },{ -2.510832,29.170118,-1.167816 },{ -2.985844,29.203718,-1.388001 },{ -3.353452,29.272079,-1.929596 },{ -3.390110,29.300697,-1.992646 },{ -2.545932,29.199894,-1.226257 },{ -2.499753,29.006470,-2.520020 },{ -2.926907,29.129988,-2.267578 },{ -3.920474,29.239407,-1.423035 },{ -3.088038,29.206810,-1.440796 },{ -3.215393,29.117163,-3.249238 },{ -2.540250,29.193453,-1.225495 },{ -2.548890,29.193886,-1.225922 },{ -2.696961,29.142902,-2.799103 },{ -2.791778,29.226665,-1.626129 },{ -3.798582,29.104616,-2.172974 },{ -2.271577,29.077059,-1.592163 },{ -2.505491,29.164230,-1.165985 },{ -3.350857,29.251673,-1.932526 },{ -3.695856,29.176081,-2.268311 },{ -3.353664,29.093081,-1.988037 },{ -2.748072,29.279243,-1.621674 },{ -3.047787,29.197748,-1.378021 },{ -3.030821,29.156208,-2.211548 },{ -2.007659,29.341459,-0.926575 },{ -2.790863,29.342075,-1.626648 },{ -2.509821,29.123518,-1.224670 },{ -2.533624,29.176275,-1.863953 },{ -3.044891,29.284094,-1.965881 },{ -2.669976,29.146353,-2.746765 },{ -4.044216,29.214130,-1.714417 },{ -3.480623,29.110685,-2.619049 },{ -3.431487,29.120356,-1.811920 },{ -2.851863,29.173950,-1.565033 },{ -2.544703,29.142263,-1.226563 },{ -2.504849,29.228987,-1.168701 },{ -2.866084,29.088484,-2.202363 },{ -3.792387,29.169653,-2.179565 },{ -3.219239,29.066282,-3.249847 },{ -3.091309,29.160015,-1.949341 },{ -2.860900,29.161959,-1.566101 },{ -2.548036,29.288130,-1.226746 },{ -3.091063,29.248592,-1.441742 },{ -2.548576,29.231705,-1.226471 },{ -2.506283,29.182549,-1.166961 },{ -3.022399,29.254221,-1.395569 },{ -2.505190,29.272751,-1.223145 },{ -3.748442,29.228508,-2.324127 },{ -2.473874,29.329647,-1.234894 },{ -3.174255,29.196810,-1.904572 },{ -3.085504,29.400057,-1.440735 },{ -2.826961,29.347849,-0.876556 },{ -3.401338,29.192368,-1.811157 },{ -3.416502,29.269722,-1.052948 },{ -2.542387,29.356117,-1.226898 },{ -3.472741,29.143244,-1.554993 },{ -2.937227,29.142574,-2.269348 },{ -3.785612,29.240145,-1.961548 },{ -2.513544,29.156895,-1.168518 },{ -2.769894,29.196772,-1.517975 },{ -3.520628,29.051037,-2.621887 },{ -3.801116,29.081787,-2.174194 },{ -3.048313,29.042181,-1.438202 },{ -3.427307,29.175661,-1.490570 },{ -3.174255,29.210812,-1.905152 },{ -2.767183,29.148651,-1.987793 },{ -3.738975,29.110247,-2.100617 },{ -2.546137,29.263588,-1.226288 },{ -3.150452,29.053940,-1.902344 },{ -2.539184,29.212957,-1.225677 },{ -2.544614,29.265755,-1.226410 },{ -3.010952,29.114731,-1.623199 },{ -3.434355,29.194096,-1.812592 },{ -2.802427,29.168293,-1.876587 },{ -2.691894,29.238205,-2.797608 },{ -2.541076,29.223129,-1.225525 },{ -3.351348,29.264706,-1.737915 },{ -2.561184,29.202482,-1.920257 },{ -2.608155,29.193060,-1.924317 },{ -2.039242,29.107166,-2.095642 },{ -3.339477,29.252480,-1.968506 },{ -2.517266,29.191172,-1.237915 },{ -3.099246,29.288704,-1.154602 },{ -3.376859,29.218649,-1.484802 },{ -2.552059,29.211666,-1.226379 },{ -3.556063,29.138500,-2.768799 },{ -2.549894,29.277359,-1.226990 },{ -2.153354,29.106758,-2.307343 },{ -3.640470,29.132595,-1.657196 },{ -2.550324,29.152285,-1.226685 },{ -2.746515,29.368593,-1.621368 },{ -3.438440,29.255625,-1.813293 },{ -3.189821,29.111763,-1.905457 },{ -3.410976,29.279999,-1.974030 },{ -3.704858,29.260460,-2.350555 },{ -3.371374,29.057608,-1.829102 },{ -2.789640,29.305593,-1.625855 },{ -2.666253,29.133686,-2.747620 },{ -2.302306,29.118511,-1.581879 },{ -3.190607,29.153542,-1.905334 },{ -2.577146,29.211512,-1.635834 },{ -2.943326,29.110687,-2.268921 },{ -2.164671,29.147011,-2.344269 },{ -2.516412,29.267332,-1.237274 },{ -2.504391,29.224920,-1.166840 },{ -2.374727,29.152956,-1.917206 },{ -3.240201,29.277205,-1.687531 },{ -3.974487,29.183731,-1.980255 },{ -3.742254,29.166563,-2.099243 },{ -3.347168,29.128956,-1.736389 },{ -3.748715,29.254498,-2.324615 },{ -2.723108,29.236961,-1.631103 },{ -2.953886,29.207148,-1.736633 },{ -2.630278,29.250048,-1.371216 },{ -2.720061,29.153595,-1.631439 },{ -2.861057,29.225880,-1.565582 },{ -2.891171,29.219999,-1.569366 },{ -3.680235,29.274408,-2.332947 },{ -2.293058,29.199980,-1.580871 },{ -2.545994,29.216314,-1.226440 },{ -3.674191,29.197552,-2.332337 },{ -3.384796,29.296486,-0.993195 },{ -3.087799,29.178574,-1.441955 },{ -3.209567,29.238829,-1.913574 },{ -3.813110,29.113468,-2.176147 },{ -3.572052,29.203247,-2.810364 },{ -3.188414,29.172287,-1.905060 },{ -3.090456,29.191832,-1.441223 },{ -2.512328,29.330942,-1.236969 },{ -2.775761,29.098951,-1.988617 },{ -2.517205,29.213253,-1.237518 },{ -3.005399,29.171078,-1.373566 },{ -3.044768,29.250072,-1.375274 },{ -2.374174,29.230856,-1.917511 },{ -2.862976,29.104940,-2.201111 },{ -3.295867,29.125357,-1.270111 },{ -3.190429,29.303392,-1.905487 },{ -2.551424,29.242384,-1.225434 },{ -2.868010,29.056351,-2.201325 },{ -3.764616,29.149483,-2.098816 },{ -3.087976,29.142914,-1.441284 },{ -3.218378,29.334564,-1.913544 },{ -2.589140,29.245054,-1.227509 },{ -3.793999,29.156494,-1.960266 },{ -3.192014,29.206423,-1.910919 },{ -3.355064,29.125357,-1.950592 },{ -3.093782,29.233358,-1.441620 },{ -3.148833,29.200537,-1.837219 },{ -3.593690,29.212872,-1.585419 },{ -2.856351,29.199419,-1.566223 },{ -3.057527,29.160095,-1.440155 },{ -3.196037,29.298044,-1.906006 },{ -3.439751,29.206911,-1.811585 },{ -3.601265,29.010958,-1.824921 },{ -3.427396,29.213413,-1.550537 },{ -3.114006,29.265181,-1.431061 },{ -2.535639,29.161631,-1.630707 },{ -2.855558,29.157946,-1.565277 },{ -3.447415,29.242607,-1.553283 },{ -3.094479,29.182009,-1.441223 },{ -3.723300,29.236422,-2.309204 },{ -2.694455,29.016626,-2.798645 },{ -2.679046,29.100582,-2.746094 },{ -3.012202,29.202297,-1.374695 },{ -2.976924,29.266979,-2.369812 },{ -3.072082,29.232447,-1.447662 },{ -2.537046,29.223789,-1.225708 },{ -3.378867,29.249943,-1.991791 },{ -2.941161,29.148989,-2.269043 },{ -3.028526,29.127344,-1.459503 },{ -2.664149,29.335030,-1.410858 },{ -2.783630,29.169968,-1.581635 },{ -2.514254,29.126036,-2.466614 },{ -3.468957,29.162235,-1.554260 },{ -4.164735,29.192251,-2.304596 },{ -2.158415,29.090412,-2.310120 },{ -3.107265,29.120615,-2.186524 },{ -3.438720,29.247295,-1.812744 },{ -2.512294,29.277512,-1.224396 },{ -3.185422,29.376911,-1.910279 },{ -3.216151,29.229069,-1.647492 },{ -2.478853,29.158165,-1.177460 } };
+	const float steer[2090] = { 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9, -2.0, -1.9, -1.8, -1.7, -1.6, -1.5, -1.4, -1.3, -1.2, -1.1, -1.0, -0.9, -0.8, -0.7, -0.6, -0.5, -0.4, -0.3, -0.2, -0.1, 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8, 1.9 };
+	const float throttle[2090] = { -5.0, -4.8, -4.6, -4.4, -4.2, -4.0, -3.8, -3.6, -3.4, -3.2, -3.0, -2.8, -2.6, -2.4, -2.2, -2.0, -1.8, -1.6, -1.4, -1.2, -1.0, -0.8, -0.6, -0.4, -0.2, 0.0, 0.2, 0.4, 0.6, 0.8, 1.0, 1.2, 1.4, 1.6, 1.8, 2.0, 2.2, 2.4, 2.6, 2.8, 3.0, 3.2, 3.4, 3.6, 3.8, 4.0, 4.2, 4.4, 4.6, 4.8, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, -5.0, -5.0, -5.0, -5.0, -5.0, -5.0, -5.0, -5.0, -5.0, -5.0, -5.0, -5.0, -5.0, -5.0, -5.0, -5.0, -5.0, -5.0, -5.0, -5.0, -5.0, -5.0, -5.0, -5.0, -5.0, -5.0, -5.0, -5.0, -5.0, -5.0, -5.0, -5.0, -5.0, -5.0, -5.0, -5.0, -5.0, -5.0, -5.0, -5.0, -4.8, -4.8, -4.8, -4.8, -4.8, -4.8, -4.8, -4.8, -4.8, -4.8, -4.8, -4.8, -4.8, -4.8, -4.8, -4.8, -4.8, -4.8, -4.8, -4.8, -4.8, -4.8, -4.8, -4.8, -4.8, -4.8, -4.8, -4.8, -4.8, -4.8, -4.8, -4.8, -4.8, -4.8, -4.8, -4.8, -4.8, -4.8, -4.8, -4.8, -4.6, -4.6, -4.6, -4.6, -4.6, -4.6, -4.6, -4.6, -4.6, -4.6, -4.6, -4.6, -4.6, -4.6, -4.6, -4.6, -4.6, -4.6, -4.6, -4.6, -4.6, -4.6, -4.6, -4.6, -4.6, -4.6, -4.6, -4.6, -4.6, -4.6, -4.6, -4.6, -4.6, -4.6, -4.6, -4.6, -4.6, -4.6, -4.6, -4.6, -4.4, -4.4, -4.4, -4.4, -4.4, -4.4, -4.4, -4.4, -4.4, -4.4, -4.4, -4.4, -4.4, -4.4, -4.4, -4.4, -4.4, -4.4, -4.4, -4.4, -4.4, -4.4, -4.4, -4.4, -4.4, -4.4, -4.4, -4.4, -4.4, -4.4, -4.4, -4.4, -4.4, -4.4, -4.4, -4.4, -4.4, -4.4, -4.4, -4.4, -4.2, -4.2, -4.2, -4.2, -4.2, -4.2, -4.2, -4.2, -4.2, -4.2, -4.2, -4.2, -4.2, -4.2, -4.2, -4.2, -4.2, -4.2, -4.2, -4.2, -4.2, -4.2, -4.2, -4.2, -4.2, -4.2, -4.2, -4.2, -4.2, -4.2, -4.2, -4.2, -4.2, -4.2, -4.2, -4.2, -4.2, -4.2, -4.2, -4.2, -4.0, -4.0, -4.0, -4.0, -4.0, -4.0, -4.0, -4.0, -4.0, -4.0, -4.0, -4.0, -4.0, -4.0, -4.0, -4.0, -4.0, -4.0, -4.0, -4.0, -4.0, -4.0, -4.0, -4.0, -4.0, -4.0, -4.0, -4.0, -4.0, -4.0, -4.0, -4.0, -4.0, -4.0, -4.0, -4.0, -4.0, -4.0, -4.0, -4.0, -3.8, -3.8, -3.8, -3.8, -3.8, -3.8, -3.8, -3.8, -3.8, -3.8, -3.8, -3.8, -3.8, -3.8, -3.8, -3.8, -3.8, -3.8, -3.8, -3.8, -3.8, -3.8, -3.8, -3.8, -3.8, -3.8, -3.8, -3.8, -3.8, -3.8, -3.8, -3.8, -3.8, -3.8, -3.8, -3.8, -3.8, -3.8, -3.8, -3.8, -3.6, -3.6, -3.6, -3.6, -3.6, -3.6, -3.6, -3.6, -3.6, -3.6, -3.6, -3.6, -3.6, -3.6, -3.6, -3.6, -3.6, -3.6, -3.6, -3.6, -3.6, -3.6, -3.6, -3.6, -3.6, -3.6, -3.6, -3.6, -3.6, -3.6, -3.6, -3.6, -3.6, -3.6, -3.6, -3.6, -3.6, -3.6, -3.6, -3.6, -3.4, -3.4, -3.4, -3.4, -3.4, -3.4, -3.4, -3.4, -3.4, -3.4, -3.4, -3.4, -3.4, -3.4, -3.4, -3.4, -3.4, -3.4, -3.4, -3.4, -3.4, -3.4, -3.4, -3.4, -3.4, -3.4, -3.4, -3.4, -3.4, -3.4, -3.4, -3.4, -3.4, -3.4, -3.4, -3.4, -3.4, -3.4, -3.4, -3.4, -3.2, -3.2, -3.2, -3.2, -3.2, -3.2, -3.2, -3.2, -3.2, -3.2, -3.2, -3.2, -3.2, -3.2, -3.2, -3.2, -3.2, -3.2, -3.2, -3.2, -3.2, -3.2, -3.2, -3.2, -3.2, -3.2, -3.2, -3.2, -3.2, -3.2, -3.2, -3.2, -3.2, -3.2, -3.2, -3.2, -3.2, -3.2, -3.2, -3.2, -3.0, -3.0, -3.0, -3.0, -3.0, -3.0, -3.0, -3.0, -3.0, -3.0, -3.0, -3.0, -3.0, -3.0, -3.0, -3.0, -3.0, -3.0, -3.0, -3.0, -3.0, -3.0, -3.0, -3.0, -3.0, -3.0, -3.0, -3.0, -3.0, -3.0, -3.0, -3.0, -3.0, -3.0, -3.0, -3.0, -3.0, -3.0, -3.0, -3.0, -2.8, -2.8, -2.8, -2.8, -2.8, -2.8, -2.8, -2.8, -2.8, -2.8, -2.8, -2.8, -2.8, -2.8, -2.8, -2.8, -2.8, -2.8, -2.8, -2.8, -2.8, -2.8, -2.8, -2.8, -2.8, -2.8, -2.8, -2.8, -2.8, -2.8, -2.8, -2.8, -2.8, -2.8, -2.8, -2.8, -2.8, -2.8, -2.8, -2.8, -2.6, -2.6, -2.6, -2.6, -2.6, -2.6, -2.6, -2.6, -2.6, -2.6, -2.6, -2.6, -2.6, -2.6, -2.6, -2.6, -2.6, -2.6, -2.6, -2.6, -2.6, -2.6, -2.6, -2.6, -2.6, -2.6, -2.6, -2.6, -2.6, -2.6, -2.6, -2.6, -2.6, -2.6, -2.6, -2.6, -2.6, -2.6, -2.6, -2.6, -2.4, -2.4, -2.4, -2.4, -2.4, -2.4, -2.4, -2.4, -2.4, -2.4, -2.4, -2.4, -2.4, -2.4, -2.4, -2.4, -2.4, -2.4, -2.4, -2.4, -2.4, -2.4, -2.4, -2.4, -2.4, -2.4, -2.4, -2.4, -2.4, -2.4, -2.4, -2.4, -2.4, -2.4, -2.4, -2.4, -2.4, -2.4, -2.4, -2.4, -2.2, -2.2, -2.2, -2.2, -2.2, -2.2, -2.2, -2.2, -2.2, -2.2, -2.2, -2.2, -2.2, -2.2, -2.2, -2.2, -2.2, -2.2, -2.2, -2.2, -2.2, -2.2, -2.2, -2.2, -2.2, -2.2, -2.2, -2.2, -2.2, -2.2, -2.2, -2.2, -2.2, -2.2, -2.2, -2.2, -2.2, -2.2, -2.2, -2.2, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -1.8, -1.8, -1.8, -1.8, -1.8, -1.8, -1.8, -1.8, -1.8, -1.8, -1.8, -1.8, -1.8, -1.8, -1.8, -1.8, -1.8, -1.8, -1.8, -1.8, -1.8, -1.8, -1.8, -1.8, -1.8, -1.8, -1.8, -1.8, -1.8, -1.8, -1.8, -1.8, -1.8, -1.8, -1.8, -1.8, -1.8, -1.8, -1.8, -1.8, -1.6, -1.6, -1.6, -1.6, -1.6, -1.6, -1.6, -1.6, -1.6, -1.6, -1.6, -1.6, -1.6, -1.6, -1.6, -1.6, -1.6, -1.6, -1.6, -1.6, -1.6, -1.6, -1.6, -1.6, -1.6, -1.6, -1.6, -1.6, -1.6, -1.6, -1.6, -1.6, -1.6, -1.6, -1.6, -1.6, -1.6, -1.6, -1.6, -1.6, -1.4, -1.4, -1.4, -1.4, -1.4, -1.4, -1.4, -1.4, -1.4, -1.4, -1.4, -1.4, -1.4, -1.4, -1.4, -1.4, -1.4, -1.4, -1.4, -1.4, -1.4, -1.4, -1.4, -1.4, -1.4, -1.4, -1.4, -1.4, -1.4, -1.4, -1.4, -1.4, -1.4, -1.4, -1.4, -1.4, -1.4, -1.4, -1.4, -1.4, -1.2, -1.2, -1.2, -1.2, -1.2, -1.2, -1.2, -1.2, -1.2, -1.2, -1.2, -1.2, -1.2, -1.2, -1.2, -1.2, -1.2, -1.2, -1.2, -1.2, -1.2, -1.2, -1.2, -1.2, -1.2, -1.2, -1.2, -1.2, -1.2, -1.2, -1.2, -1.2, -1.2, -1.2, -1.2, -1.2, -1.2, -1.2, -1.2, -1.2, -1.0, -1.0, -1.0, -1.0, -1.0, -1.0, -1.0, -1.0, -1.0, -1.0, -1.0, -1.0, -1.0, -1.0, -1.0, -1.0, -1.0, -1.0, -1.0, -1.0, -1.0, -1.0, -1.0, -1.0, -1.0, -1.0, -1.0, -1.0, -1.0, -1.0, -1.0, -1.0, -1.0, -1.0, -1.0, -1.0, -1.0, -1.0, -1.0, -1.0, -0.8, -0.8, -0.8, -0.8, -0.8, -0.8, -0.8, -0.8, -0.8, -0.8, -0.8, -0.8, -0.8, -0.8, -0.8, -0.8, -0.8, -0.8, -0.8, -0.8, -0.8, -0.8, -0.8, -0.8, -0.8, -0.8, -0.8, -0.8, -0.8, -0.8, -0.8, -0.8, -0.8, -0.8, -0.8, -0.8, -0.8, -0.8, -0.8, -0.8, -0.6, -0.6, -0.6, -0.6, -0.6, -0.6, -0.6, -0.6, -0.6, -0.6, -0.6, -0.6, -0.6, -0.6, -0.6, -0.6, -0.6, -0.6, -0.6, -0.6, -0.6, -0.6, -0.6, -0.6, -0.6, -0.6, -0.6, -0.6, -0.6, -0.6, -0.6, -0.6, -0.6, -0.6, -0.6, -0.6, -0.6, -0.6, -0.6, -0.6, -0.4, -0.4, -0.4, -0.4, -0.4, -0.4, -0.4, -0.4, -0.4, -0.4, -0.4, -0.4, -0.4, -0.4, -0.4, -0.4, -0.4, -0.4, -0.4, -0.4, -0.4, -0.4, -0.4, -0.4, -0.4, -0.4, -0.4, -0.4, -0.4, -0.4, -0.4, -0.4, -0.4, -0.4, -0.4, -0.4, -0.4, -0.4, -0.4, -0.4, -0.2, -0.2, -0.2, -0.2, -0.2, -0.2, -0.2, -0.2, -0.2, -0.2, -0.2, -0.2, -0.2, -0.2, -0.2, -0.2, -0.2, -0.2, -0.2, -0.2, -0.2, -0.2, -0.2, -0.2, -0.2, -0.2, -0.2, -0.2, -0.2, -0.2, -0.2, -0.2, -0.2, -0.2, -0.2, -0.2, -0.2, -0.2, -0.2, -0.2, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.2, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.4, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.8, 0.8, 0.8, 0.8, 0.8, 0.8, 0.8, 0.8, 0.8, 0.8, 0.8, 0.8, 0.8, 0.8, 0.8, 0.8, 0.8, 0.8, 0.8, 0.8, 0.8, 0.8, 0.8, 0.8, 0.8, 0.8, 0.8, 0.8, 0.8, 0.8, 0.8, 0.8, 0.8, 0.8, 0.8, 0.8, 0.8, 0.8, 0.8, 0.8, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.2, 1.2, 1.2, 1.2, 1.2, 1.2, 1.2, 1.2, 1.2, 1.2, 1.2, 1.2, 1.2, 1.2, 1.2, 1.2, 1.2, 1.2, 1.2, 1.2, 1.2, 1.2, 1.2, 1.2, 1.2, 1.2, 1.2, 1.2, 1.2, 1.2, 1.2, 1.2, 1.2, 1.2, 1.2, 1.2, 1.2, 1.2, 1.2, 1.2, 1.4, 1.4, 1.4, 1.4, 1.4, 1.4, 1.4, 1.4, 1.4, 1.4, 1.4, 1.4, 1.4, 1.4, 1.4, 1.4, 1.4, 1.4, 1.4, 1.4, 1.4, 1.4, 1.4, 1.4, 1.4, 1.4, 1.4, 1.4, 1.4, 1.4, 1.4, 1.4, 1.4, 1.4, 1.4, 1.4, 1.4, 1.4, 1.4, 1.4, 1.6, 1.6, 1.6, 1.6, 1.6, 1.6, 1.6, 1.6, 1.6, 1.6, 1.6, 1.6, 1.6, 1.6, 1.6, 1.6, 1.6, 1.6, 1.6, 1.6, 1.6, 1.6, 1.6, 1.6, 1.6, 1.6, 1.6, 1.6, 1.6, 1.6, 1.6, 1.6, 1.6, 1.6, 1.6, 1.6, 1.6, 1.6, 1.6, 1.6, 1.8, 1.8, 1.8, 1.8, 1.8, 1.8, 1.8, 1.8, 1.8, 1.8, 1.8, 1.8, 1.8, 1.8, 1.8, 1.8, 1.8, 1.8, 1.8, 1.8, 1.8, 1.8, 1.8, 1.8, 1.8, 1.8, 1.8, 1.8, 1.8, 1.8, 1.8, 1.8, 1.8, 1.8, 1.8, 1.8, 1.8, 1.8, 1.8, 1.8, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.2, 2.2, 2.2, 2.2, 2.2, 2.2, 2.2, 2.2, 2.2, 2.2, 2.2, 2.2, 2.2, 2.2, 2.2, 2.2, 2.2, 2.2, 2.2, 2.2, 2.2, 2.2, 2.2, 2.2, 2.2, 2.2, 2.2, 2.2, 2.2, 2.2, 2.2, 2.2, 2.2, 2.2, 2.2, 2.2, 2.2, 2.2, 2.2, 2.2, 2.4, 2.4, 2.4, 2.4, 2.4, 2.4, 2.4, 2.4, 2.4, 2.4, 2.4, 2.4, 2.4, 2.4, 2.4, 2.4, 2.4, 2.4, 2.4, 2.4, 2.4, 2.4, 2.4, 2.4, 2.4, 2.4, 2.4, 2.4, 2.4, 2.4, 2.4, 2.4, 2.4, 2.4, 2.4, 2.4, 2.4, 2.4, 2.4, 2.4, 2.6, 2.6, 2.6, 2.6, 2.6, 2.6, 2.6, 2.6, 2.6, 2.6, 2.6, 2.6, 2.6, 2.6, 2.6, 2.6, 2.6, 2.6, 2.6, 2.6, 2.6, 2.6, 2.6, 2.6, 2.6, 2.6, 2.6, 2.6, 2.6, 2.6, 2.6, 2.6, 2.6, 2.6, 2.6, 2.6, 2.6, 2.6, 2.6, 2.6, 2.8, 2.8, 2.8, 2.8, 2.8, 2.8, 2.8, 2.8, 2.8, 2.8, 2.8, 2.8, 2.8, 2.8, 2.8, 2.8, 2.8, 2.8, 2.8, 2.8, 2.8, 2.8, 2.8, 2.8, 2.8, 2.8, 2.8, 2.8, 2.8, 2.8, 2.8, 2.8, 2.8, 2.8, 2.8, 2.8, 2.8, 2.8, 2.8, 2.8, 3.0, 3.0, 3.0, 3.0, 3.0, 3.0, 3.0, 3.0, 3.0, 3.0, 3.0, 3.0, 3.0, 3.0, 3.0, 3.0, 3.0, 3.0, 3.0, 3.0, 3.0, 3.0, 3.0, 3.0, 3.0, 3.0, 3.0, 3.0, 3.0, 3.0, 3.0, 3.0, 3.0, 3.0, 3.0, 3.0, 3.0, 3.0, 3.0, 3.0, 3.2, 3.2, 3.2, 3.2, 3.2, 3.2, 3.2, 3.2, 3.2, 3.2, 3.2, 3.2, 3.2, 3.2, 3.2, 3.2, 3.2, 3.2, 3.2, 3.2, 3.2, 3.2, 3.2, 3.2, 3.2, 3.2, 3.2, 3.2, 3.2, 3.2, 3.2, 3.2, 3.2, 3.2, 3.2, 3.2, 3.2, 3.2, 3.2, 3.2, 3.4, 3.4, 3.4, 3.4, 3.4, 3.4, 3.4, 3.4, 3.4, 3.4, 3.4, 3.4, 3.4, 3.4, 3.4, 3.4, 3.4, 3.4, 3.4, 3.4, 3.4, 3.4, 3.4, 3.4, 3.4, 3.4, 3.4, 3.4, 3.4, 3.4, 3.4, 3.4, 3.4, 3.4, 3.4, 3.4, 3.4, 3.4, 3.4, 3.4, 3.6, 3.6, 3.6, 3.6, 3.6, 3.6, 3.6, 3.6, 3.6, 3.6, 3.6, 3.6, 3.6, 3.6, 3.6, 3.6, 3.6, 3.6, 3.6, 3.6, 3.6, 3.6, 3.6, 3.6, 3.6, 3.6, 3.6, 3.6, 3.6, 3.6, 3.6, 3.6, 3.6, 3.6, 3.6, 3.6, 3.6, 3.6, 3.6, 3.6, 3.8, 3.8, 3.8, 3.8, 3.8, 3.8, 3.8, 3.8, 3.8, 3.8, 3.8, 3.8, 3.8, 3.8, 3.8, 3.8, 3.8, 3.8, 3.8, 3.8, 3.8, 3.8, 3.8, 3.8, 3.8, 3.8, 3.8, 3.8, 3.8, 3.8, 3.8, 3.8, 3.8, 3.8, 3.8, 3.8, 3.8, 3.8, 3.8, 3.8, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 4.0, 4.2, 4.2, 4.2, 4.2, 4.2, 4.2, 4.2, 4.2, 4.2, 4.2, 4.2, 4.2, 4.2, 4.2, 4.2, 4.2, 4.2, 4.2, 4.2, 4.2, 4.2, 4.2, 4.2, 4.2, 4.2, 4.2, 4.2, 4.2, 4.2, 4.2, 4.2, 4.2, 4.2, 4.2, 4.2, 4.2, 4.2, 4.2, 4.2, 4.2, 4.4, 4.4, 4.4, 4.4, 4.4, 4.4, 4.4, 4.4, 4.4, 4.4, 4.4, 4.4, 4.4, 4.4, 4.4, 4.4, 4.4, 4.4, 4.4, 4.4, 4.4, 4.4, 4.4, 4.4, 4.4, 4.4, 4.4, 4.4, 4.4, 4.4, 4.4, 4.4, 4.4, 4.4, 4.4, 4.4, 4.4, 4.4, 4.4, 4.4, 4.6, 4.6, 4.6, 4.6, 4.6, 4.6, 4.6, 4.6, 4.6, 4.6, 4.6, 4.6, 4.6, 4.6, 4.6, 4.6, 4.6, 4.6, 4.6, 4.6, 4.6, 4.6, 4.6, 4.6, 4.6, 4.6, 4.6, 4.6, 4.6, 4.6, 4.6, 4.6, 4.6, 4.6, 4.6, 4.6, 4.6, 4.6, 4.6, 4.6, 4.8, 4.8, 4.8, 4.8, 4.8, 4.8, 4.8, 4.8, 4.8, 4.8, 4.8, 4.8, 4.8, 4.8, 4.8, 4.8, 4.8, 4.8, 4.8, 4.8, 4.8, 4.8, 4.8, 4.8, 4.8, 4.8, 4.8, 4.8, 4.8, 4.8, 4.8, 4.8, 4.8, 4.8, 4.8, 4.8, 4.8, 4.8, 4.8, 4.8 };
 }
 
-void UInputControlMapping::init()
+const FInputControlMapping& FInputControlMapping::Get()
 {
-	
-	if (EndTransforms && EndTransforms->Num() > 0)
-	{
-		return;
-	}
+	// function-local static: constructed once, by whichever thread gets here first
+	static const FInputControlMapping mapping;
+	return mapping;
+}
 
-	buildTransforms();
-	calculateDistances(1);
+FInputControlMapping FInputControlMapping::Build()
+{
+	return FInputControlMapping();
 }
 
-void UInputControlMapping::init(int metric)
+FInputControlMapping::FInputControlMapping()
+	: startTransform(FRotator(-7390.049805, 19171.597656, 9.984459), FVector(-0.006106, 30.000040, 0.000000), FVector(1.000000, 1.000000, 1.000000))
+	, NeutralIndex(0)
 {
+	buildTransforms();
+	calculateDistances(1);
 
-	if (EndTransforms && EndTransforms->Num() > 0)
+	Adjustments.Reserve(NUM_INPUTS);
+	for (int i = 0; i < NUM_INPUTS; i++)
 	{
-		return;
+		Adjustments.Add(FVector2D(throttle[i], steer[i]));
+	}
+	for (int i = 1; i < NUM_INPUTS; i++)
+	{
+		if (FMath::Abs(throttle[i]) + FMath::Abs(steer[i]) < FMath::Abs(throttle[NeutralIndex]) + FMath::Abs(steer[NeutralIndex]))
+		{
+			NeutralIndex = i;
+		}
 	}
+}
 
-	buildTransforms();
-	calculateDistances(metric);
+float FInputControlMapping::GetThrottle(int32 index) const
+{
+	check(index >= 0 && index < NUM_INPUTS);
+	return throttle[index];
 }
 
-void UInputControlMapping::buildTransforms()
+float FInputControlMapping::GetSteer(int32 index) const
 {
-	EndTransforms = new TArray<FTransform>;
+	check(index >= 0 && index < NUM_INPUTS);
+	return steer[index];
+}
+
+void FInputControlMapping::buildTransforms()
+{
+	EndTransforms.Reserve(NUM_INPUTS);
 	FVector scale(1., 1., 1.);
-	for (int i = 0; i < 2090; i++)
+	for (int i = 0; i < NUM_INPUTS; i++)
 	{
 		FVector loc(endPOS[i][0], endPOS[i][1], endPOS[i][2]);
 		FRotator rot(endROT[i][0], endROT[i][1], endROT[i][2]);
-		FTransform* tempTrans = new FTransform(rot, loc, scale);
-		//UE_LOG(VehicleRunState, Log, TEXT("EndTransform > %s"), *tempTrans->ToHumanReadableString());
-		EndTransforms->Add(*tempTrans);
+		EndTransforms.Add(FTransform(rot, loc, scale));
 	}
 }
 
-void UInputControlMapping::calculateDistances(int metric)
+void FInputControlMapping::calculateDistances(int metric)
 {
-	// TODO calculate and store distances for each end transform 
 	//so to use would first sample uniformly at random from keys in map then if the key (distance) maps to more than one input set, again sample at random for the values
-
-	distanceMappings = *(new TMap<float, TArray<int>>);
-	FQuat startRotation = startTransform->GetRotation();
-	FVector startLocation = startTransform->GetLocation();
+	FQuat startRotation = startTransform.GetRotation();
+	FVector startLocation = startTransform.GetLocation();
 	// loop through array of end transforms and compute distance
-	for (int i = 0; i < 2090; i++)
+	for (int i = 0; i < NUM_INPUTS; i++)
 	{
-		FTransform endTransform = EndTransforms->operator[](i);
+		const FTransform& endTransform = EndTransforms[i];
 		float distance;
 		if (metric == 1)
 		{
 			distance = FVector::DistSquaredXY(startLocation, endTransform.GetLocation());
 			// bucket distances rounded to 1 decimal place
-			//distance = FMath::Round(distance * 100.f)/100.f;
 			distance = FMath::Round(distance * 100.f);
 		}
 		else if (metric == 2)
@@ -78,21 +94,7 @@ void UInputControlMapping::calculateDistances(int metric)
 			return;
 		}
 
-		// if distance is not in map already, add
-		if (distanceMappings.Contains(distance))
-		{
-			TArray<int> newArray;
-			distanceMappings.RemoveAndCopyValue(distance, newArray);
-			newArray.Add(i);
-			distanceMappings.Add(distance, newArray);
-		}
-		// else (if distance in map) append index to controls OR controls <-- decide this) to map
-		else
-		{
-			TArray<int> newArray = *(new TArray<int>());
-			newArray.Add(i);
-			distanceMappings.Add(distance, newArray);
-		}
+		// add index to the bucket for this distance (new bucket if first)
+		distanceMappings.FindOrAdd(distance).Add(i);
 	}
-
-}
\ No newline at end of file
+}
@@ -0,0 +1,137 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "LandmarkSensor.h"
+#include "Landmark.h"
+#include "Engine/World.h"
+#include "Kismet/GameplayStatics.h"
+
+namespace
+{
+	/** one sensor per world (PIE sessions, the prediction world...), stale worlds are dropped on the next Get */
+	TMap<TWeakObjectPtr<UWorld>, TSharedPtr<FLandmarkSensor>> WorldSensors;
+}
+
+const FLandmarkSensor& FLandmarkSensor::Get(UWorld* world)
+{
+	check(IsInGameThread());
+	if (TSharedPtr<FLandmarkSensor>* found = WorldSensors.Find(world))
+	{
+		return **found;
+	}
+
+	for (auto it = WorldSensors.CreateIterator(); it; ++it)
+	{
+		if (!it.Key().IsValid())
+		{
+			it.RemoveCurrent();
+		}
+	}
+
+	TArray<AActor*> foundActors;
+	UGameplayStatics::GetAllActorsOfClass(world, ALandmark::StaticClass(), foundActors);
+	TSharedPtr<FLandmarkSensor> sensor = MakeShareable(new FLandmarkSensor());
+	TArray<FVector> locations;
+	TArray<bool> onLeft;
+	for (AActor* actor : foundActors)
+	{
+		ALandmark* landmark = CastChecked<ALandmark>(actor);
+		locations.Add(landmark->GetActorLocation());
+		onLeft.Add(landmark->IsOnLeft());
+		sensor->Actors.Add(landmark);
+	}
+	sensor->Build(locations, onLeft);
+	WorldSensors.Add(world, sensor);
+	return *sensor;
+}
+
+void FLandmarkSensor::Build(const TArray<FVector>& locations, const TArray<bool>& onLeft, float cellSize)
+{
+	check(locations.Num() == onLeft.Num());
+	Locations = locations;
+	bOnLeft = onLeft;
+	Actors.SetNum(Locations.Num());
+
+	CellSize = FMath::Max(cellSize, 1.f);
+	FBox2D bounds(ForceInit);
+	for (const FVector& location : Locations)
+	{
+		bounds += FVector2D(location);
+	}
+	GridOrigin = bounds.bIsValid ? bounds.Min : FVector2D::ZeroVector;
+	GridX = bounds.bIsValid ? FMath::FloorToInt((bounds.Max.X - bounds.Min.X) / CellSize) + 1 : 0;
+	GridY = bounds.bIsValid ? FMath::FloorToInt((bounds.Max.Y - bounds.Min.Y) / CellSize) + 1 : 0;
+
+	// counting sort of ids into cells
+	TArray<int32> cellOf;
+	cellOf.SetNumUninitialized(Locations.Num());
+	CellStart.Reset();
+	CellStart.SetNumZeroed(GridX * GridY + 1);
+	for (int32 id = 0; id < Locations.Num(); id++)
+	{
+		const int32 x = FMath::Min(FMath::FloorToInt((Locations[id].X - GridOrigin.X) / CellSize), GridX - 1);
+		const int32 y = FMath::Min(FMath::FloorToInt((Locations[id].Y - GridOrigin.Y) / CellSize), GridY - 1);
+		cellOf[id] = x * GridY + y;
+		CellStart[cellOf[id] + 1]++;
+	}
+	for (int32 cell = 0; cell < GridX * GridY; cell++)
+	{
+		CellStart[cell + 1] += CellStart[cell];
+	}
+	CellIds.SetNumUninitialized(Locations.Num());
+	TArray<int32> fill(CellStart.GetData(), FMath::Max(GridX * GridY, 0));
+	for (int32 id = 0; id < Locations.Num(); id++)
+	{
+		CellIds[fill[cellOf[id]]++] = id;
+	}
+}
+
+ALandmark* FLandmarkSensor::GetLandmark(int32 id) const
+{
+	return Actors.IsValidIndex(id) ? Actors[id].Get() : nullptr;
+}
+
+void FLandmarkSensor::Query(const FTransform& pose, const FLandmarkSensorSettings& settings, TArray<int32>& outIds) const
+{
+	outIds.Reset();
+	if (Locations.Num() == 0)
+	{
+		return;
+	}
+
+	const FQuat rotation = pose.GetRotation();
+	const FVector origin = pose.GetLocation() + FVector(0.f, 0.f, settings.MountHeight);
+	const FVector forward = rotation.GetForwardVector();
+	const FVector right = rotation.GetRightVector();
+	const FVector up = rotation.GetUpVector();
+	const float tanHalfH = FMath::Tan(FMath::DegreesToRadians(settings.HorizontalFOV * 0.5f));
+	const float tanHalfV = FMath::Tan(FMath::DegreesToRadians(settings.VerticalFOV * 0.5f));
+	const float rangeSquared = settings.Range * settings.Range;
+
+	// cells overlapping the square around the camera that holds the whole frustum
+	const int32 minX = FMath::Max(FMath::FloorToInt((origin.X - settings.Range - GridOrigin.X) / CellSize), 0);
+	const int32 maxX = FMath::Min(FMath::FloorToInt((origin.X + settings.Range - GridOrigin.X) / CellSize), GridX - 1);
+	const int32 minY = FMath::Max(FMath::FloorToInt((origin.Y - settings.Range - GridOrigin.Y) / CellSize), 0);
+	const int32 maxY = FMath::Min(FMath::FloorToInt((origin.Y + settings.Range - GridOrigin.Y) / CellSize), GridY - 1);
+	for (int32 x = minX; x <= maxX; x++)
+	{
+		for (int32 y = minY; y <= maxY; y++)
+		{
+			const int32 cell = x * GridY + y;
+			for (int32 i = CellStart[cell]; i < CellStart[cell + 1]; i++)
+			{
+				const int32 id = CellIds[i];
+				const FVector toLandmark = Locations[id] - origin;
+				const float depth = FVector::DotProduct(toLandmark, forward);
+				if (depth <= 0.f || toLandmark.SizeSquared() > rangeSquared)
+				{
+					continue;
+				}
+				if (FMath::Abs(FVector::DotProduct(toLandmark, right)) <= depth * tanHalfH && FMath::Abs(FVector::DotProduct(toLandmark, up)) <= depth * tanHalfV)
+				{
+					outIds.Add(id);
+				}
+			}
+		}
+	}
+	outIds.Sort();
+}
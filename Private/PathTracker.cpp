@@ -0,0 +1,118 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "PathTracker.h"
+
+void FPathTracker::SetSettings(const FPathTrackerSettings& newSettings)
+{
+	Settings = newSettings;
+}
+
+void FPathTracker::Begin(const TArray<FTransform>& path, const TArray<FVector>& velocities)
+{
+	Reset();
+	const int32 num = FMath::Min(path.Num(), velocities.Num());
+	if (!Settings.bEnabled || num < 2)
+	{
+		return;
+	}
+
+	TSharedRef<FPath, ESPMode::ThreadSafe> newPath = MakeShareable(new FPath());
+	newPath->Locations.Reserve(num);
+	newPath->Speeds.Reserve(num);
+	newPath->Distances.Reserve(num);
+	float distance = 0.f;
+	for (int32 i = 0; i < num; i++)
+	{
+		const FVector location = path[i].GetLocation();
+		if (i > 0)
+		{
+			distance += FVector::DistXY(newPath->Locations.Last(), location);
+		}
+		newPath->Locations.Add(location);
+		newPath->Speeds.Add(FVector::DotProduct(velocities[i], path[i].GetRotation().GetForwardVector()));
+		newPath->Distances.Add(distance);
+	}
+	Path = newPath;
+}
+
+void FPathTracker::Reset()
+{
+	Path.Reset();
+	Cursor = 0;
+	Lookahead = 0;
+	SpeedIntegral = 0.f;
+}
+
+bool FPathTracker::IsActive() const
+{
+	return Path.IsValid() && Cursor < Path->Locations.Num() - 1;
+}
+
+int32 FPathTracker::FindClosest(const FTransform& pose, float& outCrossTrackError) const
+{
+	outCrossTrackError = 0.f;
+	if (!Path.IsValid() || Path->Locations.Num() == 0)
+	{
+		return INDEX_NONE;
+	}
+	const FPath& path = *Path;
+
+	// closest target sample in the window around the cursor
+	const FVector location = pose.GetLocation();
+	const int32 lo = FMath::Max(0, Cursor - Settings.SearchBehind);
+	const int32 hi = FMath::Min(path.Locations.Num() - 1, Cursor + Settings.SearchAhead);
+	float nearest = MAX_flt;
+	int32 closest = lo;
+	for (int32 i = lo; i <= hi; i++)
+	{
+		const float distance = FVector::DistSquaredXY(location, path.Locations[i]);
+		if (distance < nearest)
+		{
+			nearest = distance;
+			closest = i;
+		}
+	}
+	const FVector local = pose.InverseTransformPositionNoScale(path.Locations[closest]);
+	outCrossTrackError = FMath::Sign(-local.Y) * FMath::Sqrt(nearest);
+	return closest;
+}
+
+FPathTrackerCommand FPathTracker::Update(const FTransform& pose, const FVector& velocity, float deltaSeconds, float nominalThrottle)
+{
+	FPathTrackerCommand command;
+	command.Throttle = nominalThrottle;
+	if (!IsActive())
+	{
+		return command;
+	}
+	const FPath& path = *Path;
+	const int32 last = path.Locations.Num() - 1;
+	Cursor = FindClosest(pose, command.CrossTrackError);
+
+	// look-ahead point: first sample that far along the path past the cursor, only ever moves forward
+	const float forwardSpeed = FVector::DotProduct(velocity, pose.GetRotation().GetForwardVector());
+	const float lookaheadDistance = Settings.LookaheadDistance + Settings.LookaheadTime * FMath::Abs(forwardSpeed);
+	Lookahead = FMath::Max(Lookahead, Cursor);
+	while (Lookahead < last && path.Distances[Lookahead] - path.Distances[Cursor] < lookaheadDistance)
+	{
+		Lookahead++;
+	}
+
+	// pure pursuit: arc through the look-ahead point, curvature 2 sin(alpha) / distance, bicycle steering angle for it
+	const FVector target = pose.InverseTransformPositionNoScale(path.Locations[Lookahead]);
+	const float targetDistance = FMath::Max(target.Size2D(), 1.f);
+	const float alpha = FMath::Atan2(target.Y, target.X);
+	const float curvature = 2.f * FMath::Sin(alpha) / targetDistance;
+	const float steerAngle = FMath::RadiansToDegrees(FMath::Atan(Settings.WheelBase * curvature));
+	command.Steer = FMath::Clamp(steerAngle / Settings.MaxSteerAngle, -1.f, 1.f);
+
+	// PI on the target run's speed where the car is now, on top of the throttle the target run was driven with
+	const float speedError = path.Speeds[Cursor] - forwardSpeed;
+	if (Settings.SpeedI > 0.f)
+	{
+		const float maxIntegral = Settings.MaxIntegralThrottle / Settings.SpeedI;
+		SpeedIntegral = FMath::Clamp(SpeedIntegral + speedError * deltaSeconds, -maxIntegral, maxIntegral);
+	}
+	command.Throttle = FMath::Clamp(nominalThrottle + Settings.SpeedP * speedError + Settings.SpeedI * SpeedIntegral, -1.f, 1.f);
+	return command;
+}
@@ -0,0 +1,148 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "PredictionCache.h"
+
+FPredictionCache::FPredictionCache()
+{
+	UseCounter = 0;
+	Hits = 0;
+	Misses = 0;
+	NumValidations = 0;
+	SumValidationError = 0.f;
+	MaxValidationError = 0.f;
+}
+
+void FPredictionCache::SetSettings(const FPredictionCacheSettings& newSettings)
+{
+	Settings = newSettings;
+	while (Entries.Num() > FMath::Max(1, Settings.Capacity))
+	{
+		EvictLeastRecentlyUsed();
+	}
+}
+
+FPredictionCacheKey FPredictionCache::MakeKey(const FTransform& pose, const FVector& linearVelocity, const FVector& angularVelocity, int32 gear, float rpm, float throttle, float steer,
+	int32 trackerCursor, float crossTrackError) const
+{
+	const FQuat rotation = pose.GetRotation();
+	FPredictionCacheKey key;
+	key.ForwardSpeed = FMath::RoundToInt(FVector::DotProduct(linearVelocity, rotation.GetForwardVector()) / Settings.SpeedStep);
+	key.LateralSpeed = FMath::RoundToInt(FVector::DotProduct(linearVelocity, rotation.GetRightVector()) / Settings.SpeedStep);
+	key.YawRate = FMath::RoundToInt(FVector::DotProduct(angularVelocity, rotation.GetUpVector()) / Settings.YawRateStep);
+	key.Gear = gear;
+	key.RPM = FMath::RoundToInt(rpm / Settings.RPMStep);
+	key.Throttle = FMath::RoundToInt(throttle / Settings.InputStep);
+	key.Steer = FMath::RoundToInt(steer / Settings.InputStep);
+	key.TrackerCursor = trackerCursor != INDEX_NONE ? trackerCursor / FMath::Max(Settings.TrackerCursorStep, 1) : INDEX_NONE;
+	key.CrossTrackError = trackerCursor != INDEX_NONE ? FMath::RoundToInt(crossTrackError / Settings.CrossTrackStep) : 0;
+	return key;
+}
+
+bool FPredictionCache::Find(const FPredictionCacheKey& key, const FTransform& currentPose, TArray<FTransform>& outPath, TArray<FVector>& outVelocities, TArray<float>& outRPMs, FTransform& outFinal, int32& outGear)
+{
+	FEntry* entry = Entries.Find(key);
+	if (!entry)
+	{
+		Misses++;
+		return false;
+	}
+	Hits++;
+	entry->LastUsed = ++UseCounter;
+
+	// only keep the pose's position and heading (scale is always 1 for the car)
+	const FTransform start(currentPose.GetRotation(), currentPose.GetLocation());
+	const int32 num = entry->LocalRun.Num();
+	outPath.Reset(num);
+	outVelocities.Reset(num);
+	outRPMs.Reset(num);
+	for (int32 i = 0; i < num; i++)
+	{
+		outPath.Add(entry->LocalRun.GetTransform(i) * start);
+		outVelocities.Add(start.TransformVectorNoScale(entry->LocalRun.GetVelocity(i)));
+		outRPMs.Add(entry->LocalRun.GetRPM(i));
+	}
+	outFinal = entry->LocalFinal * start;
+	outGear = entry->FinalGear;
+	return true;
+}
+
+void FPredictionCache::Add(const FPredictionCacheKey& key, const FTransform& startPose, const TArray<FTransform>& path, const TArray<FVector>& velocities, const TArray<float>& rpms, const FTransform& finalTransform, int32 finalGear)
+{
+	if (!Entries.Contains(key) && Entries.Num() >= FMath::Max(1, Settings.Capacity))
+	{
+		EvictLeastRecentlyUsed();
+	}
+
+	const FTransform start(startPose.GetRotation(), startPose.GetLocation());
+	TArray<FTransform> localPath;
+	TArray<FVector> localVelocities;
+	localPath.Reserve(path.Num());
+	localVelocities.Reserve(velocities.Num());
+	for (const FTransform& sample : path)
+	{
+		localPath.Add(sample.GetRelativeTransform(start));
+	}
+	for (const FVector& velocity : velocities)
+	{
+		localVelocities.Add(start.InverseTransformVectorNoScale(velocity));
+	}
+
+	FEntry& entry = Entries.FindOrAdd(key);
+	entry.LocalRun.Encode(localPath, localVelocities, rpms);
+	entry.LocalFinal = finalTransform.GetRelativeTransform(start);
+	entry.FinalGear = finalGear;
+	entry.LastUsed = ++UseCounter;
+}
+
+bool FPredictionCache::ShouldValidateHit() const
+{
+	return Settings.ValidateEveryNthHit > 0 && (Hits % Settings.ValidateEveryNthHit) == 0;
+}
+
+float FPredictionCache::RecordValidation(const TArray<FTransform>& cachedPath, const TArray<FTransform>& freshPath)
+{
+	const int32 num = FMath::Min(cachedPath.Num(), freshPath.Num());
+	float maxError = 0.f;
+	for (int32 i = 0; i < num; i++)
+	{
+		maxError = FMath::Max(maxError, FVector::Dist(cachedPath[i].GetLocation(), freshPath[i].GetLocation()));
+	}
+	NumValidations++;
+	SumValidationError += maxError;
+	MaxValidationError = FMath::Max(MaxValidationError, maxError);
+	return maxError;
+}
+
+void FPredictionCache::Empty()
+{
+	Entries.Empty();
+}
+
+SIZE_T FPredictionCache::GetAllocatedSize() const
+{
+	SIZE_T size = Entries.GetAllocatedSize();
+	for (const TPair<FPredictionCacheKey, FEntry>& pair : Entries)
+	{
+		size += pair.Value.LocalRun.GetAllocatedSize();
+	}
+	return size;
+}
+
+void FPredictionCache::EvictLeastRecentlyUsed()
+{
+	const FPredictionCacheKey* oldestKey = nullptr;
+	uint64 oldest = MAX_uint64;
+	for (const TPair<FPredictionCacheKey, FEntry>& pair : Entries)
+	{
+		if (pair.Value.LastUsed < oldest)
+		{
+			oldest = pair.Value.LastUsed;
+			oldestKey = &pair.Key;
+		}
+	}
+	if (oldestKey)
+	{
+		const FPredictionCacheKey key = *oldestKey;
+		Entries.Remove(key);
+	}
+}
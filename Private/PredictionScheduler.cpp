@@ -0,0 +1,75 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "PredictionScheduler.h"
+
+FPredictionScheduler::FPredictionScheduler()
+{
+	SetSettings(FPredictionSchedulerSettings());
+}
+
+void FPredictionScheduler::SetSettings(const FPredictionSchedulerSettings& settings)
+{
+	Settings = settings;
+	Settings.MaxHorizon = FMath::Max(Settings.MaxHorizon, Settings.MinHorizon);
+	Settings.MaxInterval = FMath::Max(Settings.MaxInterval, Settings.MinInterval);
+	ErrorAverage = 0.f;
+	SpeedAverage = 0.f;
+	LastFaultTime = -1.0;
+	IdleFrameSeconds = -1.0;
+	RolloutFrameSeconds = -1.0;
+	Horizon = Settings.DefaultHorizon;
+	Interval = 2.f * Settings.DefaultHorizon;
+	Risk = 0.f;
+}
+
+void FPredictionScheduler::ObserveTick(float locationError, float speed)
+{
+	ErrorAverage = FMath::Lerp(ErrorAverage, locationError, Settings.Smoothing);
+	SpeedAverage = FMath::Lerp(SpeedAverage, FMath::Abs(speed), Settings.Smoothing);
+}
+
+void FPredictionScheduler::NotifyFault(double now)
+{
+	LastFaultTime = now;
+}
+
+void FPredictionScheduler::ObserveFrameTime(double seconds, bool bRolloutActive)
+{
+	double& average = bRolloutActive ? RolloutFrameSeconds : IdleFrameSeconds;
+	average = average < 0.0 ? seconds : FMath::Lerp(average, seconds, double(Settings.Smoothing));
+}
+
+double FPredictionScheduler::GetRolloutFrameCost() const
+{
+	if (IdleFrameSeconds < 0.0 || RolloutFrameSeconds < 0.0)
+	{
+		return 0.0;
+	}
+	return FMath::Max(0.0, RolloutFrameSeconds - IdleFrameSeconds);
+}
+
+void FPredictionScheduler::Update(double now)
+{
+	if (!Settings.bAdaptive)
+	{
+		Horizon = Settings.DefaultHorizon;
+		Interval = 2.f * Settings.DefaultHorizon;
+		Risk = 0.f;
+		return;
+	}
+
+	const bool bRecentFault = LastFaultTime >= 0.0 && now - LastFaultTime < Settings.FaultHoldSeconds;
+	const float errorRisk = FMath::Clamp(ErrorAverage / Settings.ErrorScale, 0.f, 1.f);
+	const float speedRisk = FMath::Clamp(0.5f * SpeedAverage / Settings.SpeedScale, 0.f, 0.5f);
+	Risk = bRecentFault ? 1.f : FMath::Max(errorRisk, speedRisk);
+
+	Horizon = FMath::RoundToInt(FMath::Lerp(float(Settings.MaxHorizon), float(Settings.MinHorizon), Risk));
+	Interval = FMath::Lerp(Settings.MaxInterval, Settings.MinInterval, Risk);
+
+	// a rollout runs for Horizon out of every Interval seconds: keep its average cost per frame within budget
+	const double budget = Settings.FrameBudgetMs * 0.001;
+	Interval = FMath::Max(Interval, float(Horizon * GetRolloutFrameCost() / budget));
+
+	// the next prediction can't start before this one is done
+	Interval = FMath::Max(Interval, float(Horizon + 1));
+}
@@ -0,0 +1,112 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "PredictionWorld.h"
+#include "CustomRamp.h"
+#include "Goal.h"
+#include "VehicleAdv3.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/StaticMesh.h"
+#include "Components/StaticMeshComponent.h"
+#include "GameFramework/WorldSettings.h"
+#include "EngineUtils.h"
+
+FPredictionWorld::FPredictionWorld(UWorld* source, ECollisionChannel rampIgnoredChannel)
+	: Source(source)
+	, World(nullptr)
+	, NumCopiedActors(0)
+{
+	check(IsInGameThread());
+
+	// physics and traces only: no navigation, AI, audio or hit proxies
+	World = NewObject<UWorld>(GetTransientPackage(), MakeUniqueObjectName(GetTransientPackage(), UWorld::StaticClass(), TEXT("PredictionWorld")));
+	World->WorldType = EWorldType::GamePreview;
+	World->AddToRoot();
+	World->InitializeNewWorld(UWorld::InitializationValues()
+		.ShouldSimulatePhysics(true)
+		.EnableTraceCollision(true)
+		.CreateNavigation(false)
+		.CreateAISystem(false)
+		.AllowAudioPlayback(false)
+		.RequiresHitProxies(false)
+		.SetTransactional(false));
+	FWorldContext& context = GEngine->CreateNewWorldContext(EWorldType::GamePreview);
+	context.SetCurrentWorld(World);
+	World->InitializeActorsForPlay(FURL());
+
+	// static copy of the level's collision, templated on the originals so meshes, materials and profiles match
+	for (TActorIterator<AActor> it(source); it; ++it)
+	{
+		AActor* original = *it;
+		const bool bStaticMesh = original->IsA<AStaticMeshActor>();
+		const bool bRamp = original->IsA<ACustomRamp>();
+		const bool bGoal = original->IsA<AGoal>();
+		if (!bStaticMesh && !bRamp && !bGoal)
+		{
+			continue;
+		}
+		UStaticMeshComponent* originalMesh = original->FindComponentByClass<UStaticMeshComponent>();
+		if (!originalMesh || !originalMesh->IsCollisionEnabled())
+		{
+			continue;
+		}
+
+		FActorSpawnParameters params;
+		params.Template = original;
+		params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		AActor* copy = World->SpawnActor<AActor>(original->GetClass(), original->GetActorTransform(), params);
+		if (!copy)
+		{
+			continue;
+		}
+		copy->SetActorTickEnabled(false);
+		copy->SetActorHiddenInGame(true);
+		if (bRamp)
+		{
+			if (UStaticMeshComponent* mesh = copy->FindComponentByClass<UStaticMeshComponent>())
+			{
+				mesh->SetCollisionResponseToChannel(rampIgnoredChannel, ECR_Ignore);
+			}
+		}
+		NumCopiedActors++;
+	}
+
+	// no game mode here: start play directly, so clones get BeginPlay as they're spawned
+	World->GetWorldSettings()->NotifyBeginPlay();
+
+	TickerHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FPredictionWorld::HandleTicker));
+	UE_LOG(VehicleRunState, Log, TEXT("Prediction world with %d collision actors copied from %s"), NumCopiedActors, *source->GetName());
+}
+
+FPredictionWorld::~FPredictionWorld()
+{
+	FTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	if (World)
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+		World->RemoveFromRoot();
+		World = nullptr;
+	}
+}
+
+bool FPredictionWorld::HandleTicker(float deltaTime)
+{
+	UWorld* source = Source.Get();
+	if (!source || !World)
+	{
+		return true;
+	}
+	if (source->IsPaused())
+	{
+		return true;
+	}
+
+	// level's (dilated, clamped) delta, not wall time, so a clone tick is as long as a primary tick
+	UWorld* previousWorld = GWorld;
+	GWorld = World;
+	World->Tick(LEVELTICK_All, source->GetDeltaSeconds());
+	GWorld = previousWorld;
+	return true;
+}
@@ -0,0 +1,105 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "RunCostAccumulator.h"
+
+FRunCostAccumulator::FRunCostAccumulator(int32 searchBehind, int32 searchAhead)
+	: SearchBehind(FMath::Max(searchBehind, 0))
+	, SearchAhead(FMath::Max(searchAhead, 1))
+{
+}
+
+void FRunCostAccumulator::Begin(const TArray<FTransform>& targetPath, float targetRunTime)
+{
+	Target = targetPath;
+	TargetRunTime = targetRunTime;
+	RunPath.Reset();
+	RunPath.Reserve(Target.Num() + Target.Num() / 4);
+	ClosestLocation.Init(MAX_flt, Target.Num());
+	ClosestRotation.Init(MAX_flt, Target.Num());
+	Cursor = 0;
+	Folded = 0;
+	FoldedLocation = 0.f;
+	FoldedRotation = 0.f;
+	LastRunSeconds = 0.f;
+}
+
+void FRunCostAccumulator::Reset()
+{
+	Target.Empty();
+	RunPath.Empty();
+	ClosestLocation.Empty();
+	ClosestRotation.Empty();
+	Cursor = 0;
+	Folded = 0;
+	FoldedLocation = 0.f;
+	FoldedRotation = 0.f;
+	LastRunSeconds = 0.f;
+}
+
+void FRunCostAccumulator::AddSample(const FTransform& sample, float runSeconds)
+{
+	if (Target.Num() == 0)
+	{
+		return;
+	}
+	RunPath.Add(sample);
+	LastRunSeconds = runSeconds;
+
+	// compare with the window around the cursor, and move the cursor to the closest target sample in it
+	const FVector location = sample.GetLocation();
+	const FQuat rotation = sample.GetRotation();
+	const int32 lo = FMath::Max(Folded, Cursor - SearchBehind);
+	const int32 hi = FMath::Min(Target.Num() - 1, Cursor + SearchAhead);
+	float nearest = MAX_flt;
+	int32 nearestIndex = Cursor;
+	for (int32 j = lo; j <= hi; j++)
+	{
+		const float distance = FVector::DistSquaredXY(location, Target[j].GetLocation());
+		ClosestLocation[j] = FMath::Min(ClosestLocation[j], distance);
+		ClosestRotation[j] = FMath::Min(ClosestRotation[j], rotation.AngularDistance(Target[j].GetRotation()));
+		if (distance < nearest)
+		{
+			nearest = distance;
+			nearestIndex = j;
+		}
+	}
+	Cursor = nearestIndex;
+
+	// target samples that dropped out of reach behind the cursor are final
+	const int32 newFolded = FMath::Max(Folded, Cursor - SearchBehind);
+	for (; Folded < newFolded; Folded++)
+	{
+		if (ClosestLocation[Folded] != MAX_flt)
+		{
+			FoldedLocation = FMath::Max(FoldedLocation, ClosestLocation[Folded]);
+			FoldedRotation = FMath::Max(FoldedRotation, ClosestRotation[Folded]);
+		}
+	}
+}
+
+FRunCostTerms FRunCostAccumulator::GetCost() const
+{
+	FRunCostTerms terms;
+	if (Target.Num() == 0 || RunPath.Num() == 0)
+	{
+		return terms;
+	}
+
+	float location = FoldedLocation;
+	float rotation = FoldedRotation;
+	for (int32 j = Folded; j <= Cursor; j++)
+	{
+		if (ClosestLocation[j] != MAX_flt)
+		{
+			location = FMath::Max(location, ClosestLocation[j]);
+			rotation = FMath::Max(rotation, ClosestRotation[j]);
+		}
+	}
+
+	// the target got to the cursor's sample this far into its run (samples are one per tick, so spread evenly enough)
+	const float targetSeconds = Target.Num() > 1 ? TargetRunTime * float(Cursor) / float(Target.Num() - 1) : TargetRunTime;
+	terms.RunTime = FMath::Square(targetSeconds - LastRunSeconds);
+	terms.Location = FMath::Square(location);
+	terms.Rotation = FMath::Square(rotation);
+	return terms;
+}
@@ -0,0 +1,191 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "RunRecorder.h"
+#include "VehicleAdv3.h"
+#include "Misc/Paths.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+void FRunRecorder::Begin(const FString& filename, const RunFile::FRunFileHeader& header)
+{
+	Filename = ResolveFilename(filename);
+	Header = header;
+	Header.Magic = RunFile::MAGIC;
+	Header.Version = RunFile::VERSION;
+	Header.FrameSize = sizeof(RunFile::FRunFrame);
+	Frames.Reset();
+	Events.Reset();
+	EventData.Reset();
+	// ~10 minutes at 60 Hz up front so recording doesn't reallocate mid-run
+	Frames.Reserve(36000);
+	bRecording = true;
+	UE_LOG(VehicleRunState, Log, TEXT("Recording run to %s"), *Filename);
+}
+
+void FRunRecorder::AddFrame(const RunFile::FRunFrame& frame)
+{
+	if (bRecording)
+	{
+		Frames.Add(frame);
+	}
+}
+
+void FRunRecorder::AddFreeze(float worldSeconds)
+{
+	AddEvent(RunFile::EVENT_FREEZE, worldSeconds, nullptr);
+}
+
+void FRunRecorder::AddResume(float worldSeconds, const FVehicleStateSnapshot& state)
+{
+	AddEvent(RunFile::EVENT_RESUME, worldSeconds, &state);
+}
+
+void FRunRecorder::AddEvent(uint8 type, float worldSeconds, const FVehicleStateSnapshot* state)
+{
+	if (!bRecording)
+	{
+		return;
+	}
+	RunFile::FRunEvent event;
+	FMemory::Memzero(event);
+	event.Frame = uint32(Frames.Num());
+	event.Type = type;
+	event.WorldSeconds = worldSeconds;
+	event.DataOffset = uint32(EventData.Num());
+	if (state)
+	{
+		FVehicleStateSnapshot saved = *state;
+		FMemoryWriter writer(EventData, false, true);
+		saved.Serialize(writer);
+	}
+	event.DataSize = uint32(EventData.Num()) - event.DataOffset;
+	Events.Add(event);
+}
+
+bool FRunRecorder::Save()
+{
+	if (!bRecording)
+	{
+		return false;
+	}
+	Header.NumFrames = uint32(Frames.Num());
+	Header.NumEvents = uint32(Events.Num());
+	Header.EventDataSize = uint32(EventData.Num());
+
+	TArray<uint8> contents;
+	contents.SetNumUninitialized(int32(RunFile::GetFileSize(Header)));
+	uint8* at = contents.GetData();
+	FMemory::Memcpy(at, &Header, sizeof(Header));
+	at += sizeof(Header);
+	FMemory::Memcpy(at, Frames.GetData(), Frames.Num() * sizeof(RunFile::FRunFrame));
+	at += Frames.Num() * sizeof(RunFile::FRunFrame);
+	FMemory::Memcpy(at, Events.GetData(), Events.Num() * sizeof(RunFile::FRunEvent));
+	at += Events.Num() * sizeof(RunFile::FRunEvent);
+	FMemory::Memcpy(at, EventData.GetData(), EventData.Num());
+
+	const bool bSaved = FFileHelper::SaveArrayToFile(contents, *Filename);
+	UE_LOG(VehicleRunState, Log, TEXT("Run recording %s: %s (%d frames, %d bytes)"), bSaved ? TEXT("saved") : TEXT("failed to save"), *Filename, Frames.Num(), contents.Num());
+	return bSaved;
+}
+
+void FRunRecorder::End()
+{
+	Save();
+	bRecording = false;
+	Frames.Empty();
+	Events.Empty();
+	EventData.Empty();
+}
+
+FString FRunRecorder::ResolveFilename(const FString& filename)
+{
+	if (FPaths::IsRelative(filename))
+	{
+		return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Runs"), filename);
+	}
+	return filename;
+}
+
+bool FRunReplay::Load(const FString& filename)
+{
+	const FString path = FRunRecorder::ResolveFilename(filename);
+	TArray<uint8> contents;
+	if (!FFileHelper::LoadFileToArray(contents, *path))
+	{
+		UE_LOG(VehicleRunState, Warning, TEXT("Couldn't read run file %s"), *path);
+		return false;
+	}
+	if (contents.Num() < int32(sizeof(Header)))
+	{
+		UE_LOG(VehicleRunState, Warning, TEXT("Run file %s is truncated"), *path);
+		return false;
+	}
+	FMemory::Memcpy(&Header, contents.GetData(), sizeof(Header));
+	const int64 expectedSize = int64(RunFile::GetFileSize(Header));
+	if (Header.Magic != RunFile::MAGIC || Header.Version != RunFile::VERSION || Header.FrameSize != sizeof(RunFile::FRunFrame) || contents.Num() != expectedSize)
+	{
+		UE_LOG(VehicleRunState, Warning, TEXT("Run file %s has wrong format (version %u, %d bytes)"), *path, Header.Version, contents.Num());
+		return false;
+	}
+
+	const uint8* at = contents.GetData() + sizeof(Header);
+	Frames.SetNumUninitialized(Header.NumFrames);
+	FMemory::Memcpy(Frames.GetData(), at, Header.NumFrames * sizeof(RunFile::FRunFrame));
+	at += Header.NumFrames * sizeof(RunFile::FRunFrame);
+	Events.SetNumUninitialized(Header.NumEvents);
+	FMemory::Memcpy(Events.GetData(), at, Header.NumEvents * sizeof(RunFile::FRunEvent));
+	at += Header.NumEvents * sizeof(RunFile::FRunEvent);
+	EventData.SetNumUninitialized(Header.EventDataSize);
+	FMemory::Memcpy(EventData.GetData(), at, Header.EventDataSize);
+
+	// events in order, with their state inside the event data
+	for (int32 i = 0; i < Events.Num(); i++)
+	{
+		const RunFile::FRunEvent& event = Events[i];
+		if ((i > 0 && event.Frame < Events[i - 1].Frame) || uint64(event.DataOffset) + event.DataSize > Header.EventDataSize)
+		{
+			UE_LOG(VehicleRunState, Warning, TEXT("Run file %s has a bad event %d"), *path, i);
+			Frames.Empty();
+			Events.Empty();
+			EventData.Empty();
+			return false;
+		}
+	}
+	MaxLocationError = 0.f;
+	MaxRotationError = 0.f;
+	MaxRPMError = 0.f;
+	FirstDivergentFrame = INDEX_NONE;
+	UE_LOG(VehicleRunState, Log, TEXT("Replaying %s (%d frames, %d events, seed %llu)"), *path, Frames.Num(), Events.Num(), Header.SessionSeed);
+	return Frames.Num() > 0;
+}
+
+float FRunReplay::CheckDivergence(int32 index, const FTransform& transform, float rpm, float tolerance)
+{
+	const RunFile::FRunFrame& frame = Frames[index];
+	const float locationError = FVector::Dist(transform.GetLocation(), ToVector(frame.Location));
+	const float rotationError = transform.GetRotation().AngularDistance(ToQuat(frame.Rotation));
+	const float rpmError = FMath::Abs(rpm - frame.RPM);
+	MaxLocationError = FMath::Max(MaxLocationError, locationError);
+	MaxRotationError = FMath::Max(MaxRotationError, rotationError);
+	MaxRPMError = FMath::Max(MaxRPMError, rpmError);
+	if (FirstDivergentFrame == INDEX_NONE && locationError > tolerance)
+	{
+		FirstDivergentFrame = index;
+		UE_LOG(VehicleRunState, Warning, TEXT("Replay diverged at frame %d: %f cm, %f rad, %f rpm off"), index, locationError, rotationError, rpmError);
+	}
+	return locationError;
+}
+
+bool FRunReplay::GetEventState(int32 index, FVehicleStateSnapshot& outState) const
+{
+	const RunFile::FRunEvent& event = Events[index];
+	if (event.DataSize == 0)
+	{
+		return false;
+	}
+	TArray<uint8> data(EventData.GetData() + event.DataOffset, event.DataSize);
+	FMemoryReader reader(data, true);
+	outState.Serialize(reader);
+	return !reader.IsError() && outState.IsValid();
+}
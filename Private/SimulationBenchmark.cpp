@@ -0,0 +1,108 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SimulationBenchmark.h"
+#include "VehicleAdv3.h"
+#include "Misc/Paths.h"
+#include "Misc/FileHelper.h"
+#include "Misc/App.h"
+
+void FSimulationBenchmark::AddCase(const FString& name, TFunction<void(TArray<float>& outputs)> body)
+{
+	FCase& benchCase = Cases[Cases.AddDefaulted()];
+	benchCase.Name = name;
+	benchCase.Body = MoveTemp(body);
+}
+
+void FSimulationBenchmark::Run(int32 repetitions, int32 warmup)
+{
+	TArray<float> outputs;
+	for (FCase& benchCase : Cases)
+	{
+		benchCase.Samples.Reset(repetitions);
+		benchCase.bNondeterministic = false;
+		for (int32 rep = -warmup; rep < repetitions; rep++)
+		{
+			outputs.Reset();
+			const double start = FPlatformTime::Seconds();
+			benchCase.Body(outputs);
+			const double seconds = FPlatformTime::Seconds() - start;
+
+			const uint32 checksum = FCrc::MemCrc32(outputs.GetData(), outputs.Num() * sizeof(float));
+			if (rep == -warmup)
+			{
+				benchCase.Checksum = checksum;
+			}
+			else if (checksum != benchCase.Checksum)
+			{
+				benchCase.bNondeterministic = true;
+			}
+			if (rep >= 0)
+			{
+				benchCase.Samples.Add(seconds);
+			}
+		}
+		if (benchCase.bNondeterministic)
+		{
+			UE_LOG(VehicleRunState, Warning, TEXT("Benchmark %s gave different results between repetitions, its checksum means nothing"), *benchCase.Name);
+		}
+	}
+}
+
+uint32 FSimulationBenchmark::GetChecksum() const
+{
+	uint32 checksum = 0;
+	for (const FCase& benchCase : Cases)
+	{
+		checksum = FCrc::MemCrc32(&benchCase.Checksum, sizeof(benchCase.Checksum), checksum);
+	}
+	return checksum;
+}
+
+bool FSimulationBenchmark::Write(const FString& filename, const FString& label) const
+{
+	const FString path = FPaths::IsRelative(filename) ? FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Benchmarks"), filename) : filename;
+
+	FString json = TEXT("{\n");
+	json += FString::Printf(TEXT("\t\"schema\": %d,\n"), SCHEMA);
+	json += FString::Printf(TEXT("\t\"label\": \"%s\",\n"), *label.ReplaceCharWithEscapedChar());
+	json += FString::Printf(TEXT("\t\"platform\": \"%s\",\n"), ANSI_TO_TCHAR(FPlatformProperties::PlatformName()));
+	json += FString::Printf(TEXT("\t\"cpu\": \"%s\",\n"), *FPlatformMisc::GetCPUBrand().ReplaceCharWithEscapedChar());
+	json += FString::Printf(TEXT("\t\"build\": \"%s\",\n"), EBuildConfigurations::ToString(FApp::GetBuildConfiguration()));
+	json += FString::Printf(TEXT("\t\"checksum\": \"%08x\",\n"), GetChecksum());
+	json += TEXT("\t\"cases\": {\n");
+	for (int32 i = 0; i < Cases.Num(); i++)
+	{
+		const FCase& benchCase = Cases[i];
+		json += FString::Printf(TEXT("\t\t\"%s\": {\n"), *benchCase.Name);
+		json += FString::Printf(TEXT("\t\t\t\"checksum\": \"%08x\",\n"), benchCase.Checksum);
+		json += FString::Printf(TEXT("\t\t\t\"deterministic\": %s,\n"), benchCase.bNondeterministic ? TEXT("false") : TEXT("true"));
+		json += TEXT("\t\t\t\"seconds\": [");
+		for (int32 s = 0; s < benchCase.Samples.Num(); s++)
+		{
+			json += FString::Printf(TEXT("%s%.9g"), s > 0 ? TEXT(", ") : TEXT(""), benchCase.Samples[s]);
+		}
+		json += FString::Printf(TEXT("]\n\t\t}%s\n"), i + 1 < Cases.Num() ? TEXT(",") : TEXT(""));
+	}
+	json += TEXT("\t}\n}\n");
+
+	const bool bSaved = FFileHelper::SaveStringToFile(json, *path);
+	UE_LOG(VehicleRunState, Log, TEXT("Benchmark results %s: %s"), bSaved ? TEXT("saved") : TEXT("failed to save"), *path);
+	return bSaved;
+}
+
+void FSimulationBenchmark::LogSummary() const
+{
+	for (const FCase& benchCase : Cases)
+	{
+		double total = 0.0;
+		double fastest = MAX_dbl;
+		for (double seconds : benchCase.Samples)
+		{
+			total += seconds;
+			fastest = FMath::Min(fastest, seconds);
+		}
+		const double mean = benchCase.Samples.Num() > 0 ? total / benchCase.Samples.Num() : 0.0;
+		UE_LOG(VehicleRunState, Log, TEXT("Benchmark %s: mean %f ms, min %f ms over %d runs (checksum %08x)"), *benchCase.Name, mean * 1000.0, fastest * 1000.0, benchCase.Samples.Num(), benchCase.Checksum);
+	}
+	UE_LOG(VehicleRunState, Log, TEXT("Benchmark golden checksum %08x"), GetChecksum());
+}
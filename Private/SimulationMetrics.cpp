@@ -0,0 +1,261 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SimulationMetrics.h"
+#include "VehicleAdv3.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ScopeLock.h"
+#include "HAL/FileManager.h"
+#include "Common/TcpListener.h"
+#include "Interfaces/IPv4/IPv4Endpoint.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+
+FLatencyHistogram::FLatencyHistogram()
+	: Count(0)
+	, Sum(0.0)
+{
+	FMemory::Memzero(Counts);
+}
+
+int32 FLatencyHistogram::GetBucket(uint64 micros)
+{
+	// first 2*SUB_BUCKETS values get a bucket each, above that every power of two is split into SUB_BUCKETS
+	if (micros < 2 * SUB_BUCKETS)
+	{
+		return int32(micros);
+	}
+	micros = FMath::Min<uint64>(micros, (uint64(1) << 41) - 1);
+	const int32 shift = int32(FMath::FloorLog2_64(micros)) - 4;
+	return shift * SUB_BUCKETS + int32(micros >> shift);
+}
+
+double FLatencyHistogram::GetBucketUpperBound(int32 bucket)
+{
+	const int32 shift = FMath::Max(0, bucket / SUB_BUCKETS - 1);
+	const uint64 subBucket = uint64(bucket - shift * SUB_BUCKETS);
+	return double((subBucket + 1) << shift) * 1e-6;
+}
+
+void FLatencyHistogram::Record(double seconds)
+{
+	const uint64 micros = uint64(FMath::Max(0.0, seconds) * 1e6);
+	Counts[GetBucket(micros)]++;
+	Count++;
+	Sum += seconds;
+}
+
+double FLatencyHistogram::GetQuantile(double q) const
+{
+	if (Count == 0)
+	{
+		return 0.0;
+	}
+	const uint64 rank = FMath::Max<uint64>(1, uint64(FMath::CeilToDouble(FMath::Clamp(q, 0.0, 1.0) * double(Count))));
+	uint64 seen = 0;
+	for (int32 bucket = 0; bucket < NUM_BUCKETS; bucket++)
+	{
+		seen += Counts[bucket];
+		if (seen >= rank)
+		{
+			return GetBucketUpperBound(bucket);
+		}
+	}
+	return GetBucketUpperBound(NUM_BUCKETS - 1);
+}
+
+FSimulationMetrics& FSimulationMetrics::Get()
+{
+	static FSimulationMetrics metrics;
+	return metrics;
+}
+
+FSimulationMetrics::FSimulationMetrics()
+{
+	Describe(SimulationMetric::PredictionSeconds, EMetricType::Histogram, TEXT("Wall time from starting a prediction to having it as the expected future."));
+	Describe(SimulationMetric::PredictionsTotal, EMetricType::Counter, TEXT("Predictions made, by how (rollout with primary frozen, shadow rollout, cache)."));
+	Describe(SimulationMetric::FrozenSeconds, EMetricType::Histogram, TEXT("Wall time the primary car was frozen for a target run or prediction rollout."));
+	Describe(SimulationMetric::DiagnosticCycleSeconds, EMetricType::Histogram, TEXT("Wall time from first diagnostic candidate to applying the best one."));
+	Describe(SimulationMetric::TriageTotal, EMetricType::Counter, TEXT("Error triages started, by error type found."));
+	Describe(SimulationMetric::TickComparisonSeconds, EMetricType::Histogram, TEXT("Cost of comparing actual to expected state in one monitoring step."));
+	Describe(SimulationMetric::LiveClones, EMetricType::Gauge, TEXT("Target, prediction and test clones currently spawned."));
+	Describe(SimulationMetric::TrajectoryBytes, EMetricType::Gauge, TEXT("Bytes held by run records, recording buffers and the prediction cache."));
+	Describe(SimulationMetric::RunCost, EMetricType::Gauge, TEXT("CalculateTotalRunCost of the last finished run."));
+	Describe(SimulationMetric::RunSeconds, EMetricType::Gauge, TEXT("Run time of the last finished run."));
+	Describe(SimulationMetric::RunsTotal, EMetricType::Counter, TEXT("Runs that reached the goal."));
+	Describe(SimulationMetric::PartialRunCost, EMetricType::Gauge, TEXT("Run time, location and rotation cost of the current run so far."));
+	Describe(SimulationMetric::PredictionHorizon, EMetricType::Gauge, TEXT("Seconds the scheduler currently predicts ahead."));
+	Describe(SimulationMetric::PredictionInterval, EMetricType::Gauge, TEXT("Seconds the scheduler currently waits between predictions."));
+	Describe(SimulationMetric::PredictionRisk, EMetricType::Gauge, TEXT("Risk (0..1) from prediction error, speed and recent faults that set horizon and interval."));
+	Describe(SimulationMetric::RolloutFrameCost, EMetricType::Gauge, TEXT("Extra frame time while a rollout runs."));
+	Describe(SimulationMetric::AnalyticPredictionError, EMetricType::Gauge, TEXT("Running max path error (cm) of the analytic model against physics rollouts."));
+}
+
+FSimulationMetrics::~FSimulationMetrics()
+{
+	StopExport();
+}
+
+void FSimulationMetrics::Describe(const TCHAR* name, EMetricType type, const TCHAR* help)
+{
+	FMetricFamily& family = Families.FindOrAdd(name);
+	family.Type = type;
+	family.Help = help;
+}
+
+void FSimulationMetrics::Increment(const TCHAR* name, const FString& labels, double amount)
+{
+	FScopeLock scopeLock(&Lock);
+	if (FMetricFamily* family = Families.Find(name))
+	{
+		family->Values.FindOrAdd(labels) += amount;
+	}
+}
+
+void FSimulationMetrics::SetGauge(const TCHAR* name, double value, const FString& labels)
+{
+	FScopeLock scopeLock(&Lock);
+	if (FMetricFamily* family = Families.Find(name))
+	{
+		family->Values.FindOrAdd(labels) = value;
+	}
+}
+
+void FSimulationMetrics::AddGauge(const TCHAR* name, double delta, const FString& labels)
+{
+	Increment(name, labels, delta);
+}
+
+void FSimulationMetrics::Observe(const TCHAR* name, double seconds)
+{
+	FScopeLock scopeLock(&Lock);
+	if (FMetricFamily* family = Families.Find(name))
+	{
+		family->Histogram.Record(seconds);
+	}
+}
+
+FString FSimulationMetrics::Render() const
+{
+	FScopeLock scopeLock(&Lock);
+	FString text;
+	for (const TPair<FString, FMetricFamily>& pair : Families)
+	{
+		const FString& name = pair.Key;
+		const FMetricFamily& family = pair.Value;
+		const TCHAR* type = family.Type == EMetricType::Counter ? TEXT("counter") : (family.Type == EMetricType::Gauge ? TEXT("gauge") : TEXT("histogram"));
+		text += FString::Printf(TEXT("# HELP %s %s\n# TYPE %s %s\n"), *name, *family.Help, *name, type);
+
+		if (family.Type != EMetricType::Histogram)
+		{
+			for (const TPair<FString, double>& value : family.Values)
+			{
+				text += value.Key.IsEmpty() ? FString::Printf(TEXT("%s %.17g\n"), *name, value.Value) : FString::Printf(TEXT("%s{%s} %.17g\n"), *name, *value.Key, value.Value);
+			}
+			continue;
+		}
+
+		// cumulative buckets, only where something was recorded (bounds never move, so series stay comparable)
+		const FLatencyHistogram& histogram = family.Histogram;
+		uint64 cumulative = 0;
+		for (int32 bucket = 0; bucket < FLatencyHistogram::NUM_BUCKETS; bucket++)
+		{
+			if (histogram.GetBucketCount(bucket) == 0)
+			{
+				continue;
+			}
+			cumulative += histogram.GetBucketCount(bucket);
+			text += FString::Printf(TEXT("%s_bucket{le=\"%.9g\"} %llu\n"), *name, FLatencyHistogram::GetBucketUpperBound(bucket), cumulative);
+		}
+		text += FString::Printf(TEXT("%s_bucket{le=\"+Inf\"} %llu\n%s_sum %.17g\n%s_count %llu\n"), *name, histogram.GetCount(), *name, histogram.GetSum(), *name, histogram.GetCount());
+	}
+	return text;
+}
+
+bool FSimulationMetrics::WriteFile() const
+{
+	if (Filename.IsEmpty())
+	{
+		return false;
+	}
+	// write next to the target and move over it, so a collector never reads half a file
+	const FString tempFilename = Filename + TEXT(".tmp");
+	if (!FFileHelper::SaveStringToFile(Render(), *tempFilename))
+	{
+		UE_LOG(VehicleRunState, Warning, TEXT("Couldn't write metrics to %s"), *tempFilename);
+		return false;
+	}
+	return IFileManager::Get().Move(*Filename, *tempFilename, true, true);
+}
+
+void FSimulationMetrics::StartExport()
+{
+	FString file;
+	if (TickerHandle.IsValid() == false && FParse::Value(FCommandLine::Get(), TEXT("MetricsFile="), file))
+	{
+		Filename = FPaths::IsRelative(file) ? FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Metrics"), file) : file;
+		float interval = 10.f;
+		FParse::Value(FCommandLine::Get(), TEXT("MetricsInterval="), interval);
+		TickerHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FSimulationMetrics::HandleTicker), FMath::Max(interval, 0.1f));
+		UE_LOG(VehicleRunState, Log, TEXT("Writing metrics to %s every %f s"), *Filename, interval);
+	}
+
+	int32 port = 0;
+	if (!Listener && FParse::Value(FCommandLine::Get(), TEXT("MetricsPort="), port) && port > 0)
+	{
+		// localhost only, scrape through a local agent/ssh tunnel
+		const FIPv4Endpoint endpoint(FIPv4Address(127, 0, 0, 1), uint16(port));
+		Listener = new FTcpListener(endpoint);
+		Listener->OnConnectionAccepted().BindRaw(this, &FSimulationMetrics::HandleConnection);
+		UE_LOG(VehicleRunState, Log, TEXT("Serving metrics on http://%s/metrics"), *endpoint.ToString());
+	}
+}
+
+void FSimulationMetrics::StopExport()
+{
+	if (Listener)
+	{
+		delete Listener;
+		Listener = nullptr;
+	}
+	if (TickerHandle.IsValid())
+	{
+		FTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+		WriteFile();
+	}
+}
+
+bool FSimulationMetrics::HandleTicker(float deltaTime)
+{
+	WriteFile();
+	return true;
+}
+
+bool FSimulationMetrics::HandleConnection(FSocket* socket, const FIPv4Endpoint& endpoint)
+{
+	// any request gets the metrics (listener thread, doesn't touch the game thread)
+	if (socket->Wait(ESocketWaitConditions::WaitForRead, FTimespan::FromMilliseconds(500)))
+	{
+		uint8 request[1024];
+		int32 bytesRead = 0;
+		socket->Recv(request, sizeof(request), bytesRead);
+	}
+
+	const FTCHARToUTF8 body(*Render());
+	const FString header = FString::Printf(TEXT("HTTP/1.0 200 OK\r\nContent-Type: text/plain; version=0.0.4\r\nContent-Length: %d\r\nConnection: close\r\n\r\n"), body.Length());
+	const FTCHARToUTF8 headerUtf8(*header);
+
+	int32 bytesSent = 0;
+	socket->Send((const uint8*)headerUtf8.Get(), headerUtf8.Length(), bytesSent);
+	int32 offset = 0;
+	while (offset < body.Length() && socket->Send((const uint8*)body.Get() + offset, body.Length() - offset, bytesSent) && bytesSent > 0)
+	{
+		offset += bytesSent;
+	}
+	socket->Close();
+	ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(socket);
+	return true;
+}
@@ -0,0 +1,30 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SimulationVehicleMovementComponent.h"
+
+void USimulationVehicleMovementComponent::UpdateState(float DeltaTime)
+{
+	if (!bDriveWithoutController)
+	{
+		Super::UpdateState(DeltaTime);
+		return;
+	}
+
+	// the locally controlled path of the stock component, minus the server update
+	if (bReverseAsBrake && FMath::Abs(GetForwardSpeed()) < WrongDirectionThreshold)
+	{
+		// shift between reverse and first only when slow enough
+		if (RawThrottleInput < -KINDA_SMALL_NUMBER && GetCurrentGear() >= 0 && GetTargetGear() >= 0)
+		{
+			SetTargetGear(-1, true);
+		}
+		else if (RawThrottleInput > KINDA_SMALL_NUMBER && GetCurrentGear() <= 0 && GetTargetGear() <= 0)
+		{
+			SetTargetGear(1, true);
+		}
+	}
+	SteeringInput = SteeringInputRate.InterpInputValue(DeltaTime, SteeringInput, CalcSteeringInput());
+	ThrottleInput = ThrottleInputRate.InterpInputValue(DeltaTime, ThrottleInput, CalcThrottleInput());
+	BrakeInput = BrakeInputRate.InterpInputValue(DeltaTime, BrakeInput, CalcBrakeInput());
+	HandbrakeInput = HandbrakeInputRate.InterpInputValue(DeltaTime, HandbrakeInput, CalcHandbrakeInput());
+}
@@ -0,0 +1,29 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SimulationVehiclePawn.h"
+#include "Components/SkeletalMeshComponent.h"
+
+ASimulationVehiclePawn::ASimulationVehiclePawn(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer
+		.DoNotCreateDefaultSubobject(TEXT("SpringArm"))
+		.DoNotCreateDefaultSubobject(TEXT("ChaseCamera"))
+		.DoNotCreateDefaultSubobject(TEXT("InternalCameraBase"))
+		.DoNotCreateDefaultSubobject(TEXT("InternalCamera"))
+		.DoNotCreateDefaultSubobject(TEXT("IncarSpeed"))
+		.DoNotCreateDefaultSubobject(TEXT("IncarGear"))
+		.DoNotCreateDefaultSubobject(TEXT("EngineSound")))
+{
+	// wheels are driven by PhysX, the animation blueprint only moves them visually
+	USkeletalMeshComponent* mesh = GetMesh();
+	mesh->SetAnimInstanceClass(nullptr);
+	mesh->MeshComponentUpdateFlag = EMeshComponentUpdateFlag::OnlyTickPoseWhenRendered;
+
+	// hidden primitives never get a scene proxy
+	mesh->SetVisibility(false);
+	mesh->SetHiddenInGame(true);
+	mesh->CastShadow = false;
+	bHidden = true;
+
+	// never the primary (SpawnSimulationVehicle sets the actual role before BeginPlay)
+	vehicleType = ECarType::ECT_prediction;
+}
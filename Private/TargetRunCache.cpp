@@ -0,0 +1,189 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "TargetRunCache.h"
+#include "SimulationData.h"
+#include "VehicleAdv3.h"
+#include "WheeledVehicleMovementComponent4W.h"
+#include "Engine/World.h"
+#include "Misc/Paths.h"
+#include "Misc/FileHelper.h"
+#include "HAL/PlatformFilemanager.h"
+#include "Serialization/BufferReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+	/** 'VTRC' */
+	const uint32 CACHE_MAGIC = 0x56545243;
+
+	void HashBytes(uint32& crc, const void* data, int32 size)
+	{
+		crc = FCrc::MemCrc32(data, size, crc);
+	}
+
+	void HashFloat(uint32& crc, float value)
+	{
+		HashBytes(crc, &value, sizeof(value));
+	}
+
+	void HashVector(uint32& crc, const FVector& value)
+	{
+		HashFloat(crc, value.X);
+		HashFloat(crc, value.Y);
+		HashFloat(crc, value.Z);
+	}
+
+	void HashCurve(uint32& crc, const FRuntimeFloatCurve& curve)
+	{
+		for (const FRichCurveKey& key : curve.GetRichCurveConst()->GetConstRefOfKeys())
+		{
+			HashFloat(crc, key.Time);
+			HashFloat(crc, key.Value);
+		}
+	}
+
+	/** read header and run from an already mapped/loaded buffer */
+	bool ReadCacheBuffer(const uint8* data, int64 size, uint32 key, FSimulationData& outData)
+	{
+		FBufferReader reader((void*)data, size, false);
+		uint32 magic = 0;
+		uint32 version = 0;
+		uint32 storedKey = 0;
+		reader << magic << version << storedKey;
+		if (reader.IsError() || magic != CACHE_MAGIC || version != FTargetRunCache::VERSION || storedKey != key)
+		{
+			UE_LOG(VehicleRunState, Log, TEXT("Target run cache stale (version %u, key %08x)"), version, storedKey);
+			return false;
+		}
+		outData.LoadRun(reader);
+		return !reader.IsError() && outData.bIsReady && outData.GetNumTicks() > 0;
+	}
+}
+
+uint32 FTargetRunCache::ComputeKey(const UWorld* world, const FTransform& start, const UWheeledVehicleMovementComponent4W* movement)
+{
+	uint32 crc = VERSION;
+
+	// level (strip PIE prefix so editor and packaged runs share entries)
+	if (world)
+	{
+		const FString levelName = UWorld::RemovePIEPrefix(world->GetOutermost()->GetName());
+		crc = FCrc::StrCrc32(*levelName, crc);
+	}
+
+	// start transform
+	HashVector(crc, start.GetLocation());
+	const FQuat rotation = start.GetRotation();
+	HashFloat(crc, rotation.X);
+	HashFloat(crc, rotation.Y);
+	HashFloat(crc, rotation.Z);
+	HashFloat(crc, rotation.W);
+
+	// vehicle movement setup
+	if (movement)
+	{
+		HashFloat(crc, movement->Mass);
+		HashFloat(crc, movement->DragCoefficient);
+		HashFloat(crc, movement->ChassisWidth);
+		HashFloat(crc, movement->ChassisHeight);
+		HashFloat(crc, movement->MaxEngineRPM);
+		HashVector(crc, movement->InertiaTensorScale);
+		HashFloat(crc, movement->MinNormalizedTireLoad);
+		HashFloat(crc, movement->MinNormalizedTireLoadFiltered);
+		HashFloat(crc, movement->MaxNormalizedTireLoad);
+		HashFloat(crc, movement->MaxNormalizedTireLoadFiltered);
+
+		for (const FWheelSetup& wheel : movement->WheelSetups)
+		{
+			if (wheel.WheelClass)
+			{
+				crc = FCrc::StrCrc32(*wheel.WheelClass->GetPathName(), crc);
+			}
+			crc = FCrc::StrCrc32(*wheel.BoneName.ToString(), crc);
+			HashVector(crc, wheel.AdditionalOffset);
+		}
+
+		HashCurve(crc, movement->EngineSetup.TorqueCurve);
+		HashFloat(crc, movement->EngineSetup.MaxRPM);
+		HashFloat(crc, movement->EngineSetup.MOI);
+		HashCurve(crc, movement->SteeringCurve);
+
+		const uint8 differential = uint8(movement->DifferentialSetup.DifferentialType);
+		HashBytes(crc, &differential, sizeof(differential));
+		HashFloat(crc, movement->DifferentialSetup.FrontRearSplit);
+
+		const uint8 autoBox = movement->TransmissionSetup.bUseGearAutoBox ? 1 : 0;
+		HashBytes(crc, &autoBox, sizeof(autoBox));
+		HashFloat(crc, movement->TransmissionSetup.GearSwitchTime);
+		HashFloat(crc, movement->TransmissionSetup.GearAutoBoxLatency);
+		HashFloat(crc, movement->TransmissionSetup.FinalRatio);
+		for (const FVehicleGearData& gearData : movement->TransmissionSetup.ForwardGears)
+		{
+			HashFloat(crc, gearData.Ratio);
+			HashFloat(crc, gearData.DownRatio);
+			HashFloat(crc, gearData.UpRatio);
+		}
+	}
+	return crc;
+}
+
+bool FTargetRunCache::Load(uint32 key, FSimulationData& outData)
+{
+	const FString filename = GetCacheFilename(key);
+	IPlatformFile& platformFile = FPlatformFileManager::Get().GetPlatformFile();
+	if (!platformFile.FileExists(*filename))
+	{
+		return false;
+	}
+
+	// map file where the platform supports it (read straight from the page cache)
+	bool bLoaded = false;
+	bool bMapped = false;
+	if (IMappedFileHandle* mappedFile = platformFile.OpenMapped(*filename))
+	{
+		if (IMappedFileRegion* region = mappedFile->MapRegion())
+		{
+			bMapped = true;
+			bLoaded = ReadCacheBuffer(region->GetMappedPtr(), region->GetMappedSize(), key, outData);
+			delete region;
+		}
+		delete mappedFile;
+	}
+	// otherwise fall back to a single read
+	if (!bMapped)
+	{
+		TArray<uint8> contents;
+		if (FFileHelper::LoadFileToArray(contents, *filename))
+		{
+			bLoaded = ReadCacheBuffer(contents.GetData(), contents.Num(), key, outData);
+		}
+	}
+
+	UE_LOG(VehicleRunState, Log, TEXT("Target run cache %s: %s"), bLoaded ? TEXT("hit") : TEXT("invalid"), *filename);
+	return bLoaded;
+}
+
+bool FTargetRunCache::Save(uint32 key, const FSimulationData& data)
+{
+	if (!data.bIsReady)
+	{
+		return false;
+	}
+
+	TArray<uint8> contents;
+	FMemoryWriter writer(contents);
+	uint32 magic = CACHE_MAGIC;
+	uint32 version = VERSION;
+	writer << magic << version << key;
+	data.SaveRun(writer);
+
+	const FString filename = GetCacheFilename(key);
+	const bool bSaved = FFileHelper::SaveArrayToFile(contents, *filename);
+	UE_LOG(VehicleRunState, Log, TEXT("Target run cache %s: %s (%d bytes)"), bSaved ? TEXT("saved") : TEXT("failed to save"), *filename, contents.Num());
+	return bSaved;
+}
+
+FString FTargetRunCache::GetCacheFilename(uint32 key)
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("TargetRunCache"), FString::Printf(TEXT("%08x.bin"), key));
+}
@@ -2,64 +2,47 @@
 
 #include "TestRunData.h"
 
-UTestRunData::UTestRunData()
+FTestRunData::FTestRunData()
 {
 	this->steeringChange = 0.f;
 	this->throttleChange = 0.f;
+	this->finalTransform = FTransform::Identity;
+	this->finalRPM = 0.f;
+	this->hitgoal = false;
 }
 
-UTestRunData* UTestRunData::MAKE(float steering, float throttle)
-{
-	UTestRunData* datum = NewObject<UTestRunData>();
-	datum->steeringChange = steering;
-	datum->throttleChange = throttle;
-	return datum;
-}
-
-UTestRunData* UTestRunData::MAKE(float steering, float throttle, FVector & end)
-{	
-	TSharedPtr<UTestRunData> newtrdata(NewObject<UTestRunData>());
-	//UTestRunData* datum = NewObject<UTestRunData>();
-	newtrdata->steeringChange = steering;
-	newtrdata->throttleChange = throttle;
-	return newtrdata.Get();
-}
-
-UTestRunData::~UTestRunData()
-{
-}
-
-void UTestRunData::Initialize(float steering, float throttle)
+void FTestRunData::Initialize(float steering, float throttle)
 {
 	steeringChange = steering;
 	throttleChange = throttle;
-
+	hitgoal = false;
 }
 
-void UTestRunData::Initialize(float steering, float throttle, FTransform & finalTransform, float finialRPM)
+void FTestRunData::Initialize(float steering, float throttle, const FTransform& finalTransform, float finalRPM)
 {
 	steeringChange = steering;
 	throttleChange = throttle;
-	finalTransform = finalTransform;
-	finalRPM = finalRPM;
+	this->finalTransform = finalTransform;
+	this->finalRPM = finalRPM;
+	hitgoal = false;
 }
 
-float UTestRunData::GetSteeringChange()
+float FTestRunData::GetSteeringChange() const
 {
 	return steeringChange;
 }
 
-float UTestRunData::GetThrottleChange()
+float FTestRunData::GetThrottleChange() const
 {
 	return throttleChange;
 }
 
-FTransform UTestRunData::GetFinalTransform()
+FTransform FTestRunData::GetFinalTransform() const
 {
 	return finalTransform;
 }
 
-float UTestRunData::GetFinalRPM()
+float FTestRunData::GetFinalRPM() const
 {
 	return finalRPM;
 }
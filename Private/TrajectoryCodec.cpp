@@ -0,0 +1,389 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "TrajectoryCodec.h"
+
+namespace
+{
+	/** largest magnitude of the three smallest quaternion components is 1/sqrt(2) */
+	const float SMALLEST_THREE_RANGE = 0.707106781f;
+	const uint32 SMALLEST_THREE_MAX = 1023;
+
+	/** bytes assembled explicitly so the packing doesn't depend on the platform's byte order */
+	uint32 ReadBits(const TArray<uint8>& packed, int32 bitOffset, uint8 bits)
+	{
+		if (bits == 0)
+		{
+			return 0;
+		}
+		const uint8* bytes = packed.GetData() + (bitOffset >> 3);
+		const uint32 word = uint32(bytes[0]) | (uint32(bytes[1]) << 8) | (uint32(bytes[2]) << 16) | (uint32(bytes[3]) << 24);
+		return (word >> (bitOffset & 7)) & ((1u << bits) - 1u);
+	}
+
+	void WriteBits(TArray<uint8>& packed, int32 bitOffset, uint8 bits, uint32 value)
+	{
+		for (int32 b = 0; b < bits; b++)
+		{
+			if (value & (1u << b))
+			{
+				packed[(bitOffset + b) >> 3] |= uint8(1u << ((bitOffset + b) & 7));
+			}
+		}
+	}
+
+	float GetComponent(const FTransform& transform, const FVector& velocity, float rpm, int32 component)
+	{
+		return component < 3 ? transform.GetLocation()[component] : component < 6 ? velocity[component - 3] : rpm;
+	}
+
+	/** same layout as TArray's operator<<, element by element so the array can stay const */
+	template<typename ElementType>
+	void SaveArray(FArchive& Ar, const TArray<ElementType>& array)
+	{
+		int32 num = array.Num();
+		Ar << num;
+		for (ElementType element : array)
+		{
+			Ar << element;
+		}
+	}
+}
+
+FCompressedTrajectory::FCompressedTrajectory()
+{
+	NumSamples = 0;
+}
+
+void FCompressedTrajectory::Encode(const TArray<FTransform>& path, const TArray<FVector>& velocities, const TArray<float>& rpms, const FTrajectoryCodecSettings& settings)
+{
+	Empty();
+	Settings = settings;
+	Settings.KeyframeInterval = FMath::Max(1, Settings.KeyframeInterval);
+
+	NumSamples = FMath::Min3(path.Num(), velocities.Num(), rpms.Num());
+	if (NumSamples == 0)
+	{
+		return;
+	}
+
+	const int32 interval = Settings.KeyframeInterval;
+	Blocks.Reserve(FMath::DivideAndRoundUp(NumSamples, interval));
+	PackedRotations.SetNumUninitialized(NumSamples);
+
+	TArray<uint32> steps;
+	steps.SetNumUninitialized(interval * NUM_COMPONENTS);
+	int32 bitOffset = 0;
+
+	for (int32 blockStart = 0; blockStart < NumSamples; blockStart += interval)
+	{
+		const int32 blockEnd = FMath::Min(NumSamples, blockStart + interval);
+		const int32 blockLength = blockEnd - blockStart;
+
+		FBlock block;
+		block.BitOffset = bitOffset;
+		block.RawOffset = RawValues.Num();
+		int32 sampleBits = 0;
+
+		for (int32 c = 0; c < NUM_COMPONENTS; c++)
+		{
+			float minValue = MAX_flt;
+			float maxValue = -MAX_flt;
+			bool bFinite = true;
+			for (int32 i = blockStart; i < blockEnd; i++)
+			{
+				const float value = GetComponent(path[i], velocities[i], rpms[i], c);
+				bFinite = bFinite && FMath::IsFinite(value);
+				minValue = FMath::Min(minValue, value);
+				maxValue = FMath::Max(maxValue, value);
+			}
+			const float quantum = GetQuantum(c);
+			const uint32 maxSteps = (1u << MAX_COMPONENT_BITS) - 1u;
+			block.Base[c] = minValue;
+
+			// span too wide to pack (e.g. a teleport at low quantum), keep just this component exact
+			if (!bFinite || (maxValue - minValue) / quantum > maxSteps - 1u)
+			{
+				block.Bits[c] = RAW_COMPONENT;
+				block.Base[c] = 0.f;
+				for (int32 i = blockStart; i < blockEnd; i++)
+				{
+					RawValues.Add(GetComponent(path[i], velocities[i], rpms[i], c));
+				}
+				continue;
+			}
+
+			uint32 largest = 0;
+			for (int32 i = blockStart; i < blockEnd; i++)
+			{
+				const float value = GetComponent(path[i], velocities[i], rpms[i], c);
+				const uint32 step = uint32(FMath::Clamp(FMath::RoundToInt((value - minValue) / quantum), 0, int32(maxSteps)));
+				steps[(i - blockStart) * NUM_COMPONENTS + c] = step;
+				largest = FMath::Max(largest, step);
+			}
+			block.Bits[c] = uint8(FMath::CeilLogTwo(largest + 1u));
+			sampleBits += block.Bits[c];
+		}
+
+		bitOffset += sampleBits * blockLength;
+		PackedSteps.SetNumZeroed(FMath::DivideAndRoundUp(bitOffset, 8) + PACKED_PADDING);
+		int32 at = block.BitOffset;
+		for (int32 i = 0; i < blockLength; i++)
+		{
+			for (int32 c = 0; c < NUM_COMPONENTS; c++)
+			{
+				if (block.Bits[c] != RAW_COMPONENT)
+				{
+					WriteBits(PackedSteps, at, block.Bits[c], steps[i * NUM_COMPONENTS + c]);
+					at += block.Bits[c];
+				}
+			}
+		}
+
+		for (int32 i = blockStart; i < blockEnd; i++)
+		{
+			PackedRotations[i] = PackRotation(path[i].GetRotation());
+		}
+		Blocks.Add(block);
+	}
+
+	PackedSteps.Shrink();
+	RawValues.Shrink();
+}
+
+void FCompressedTrajectory::Empty()
+{
+	NumSamples = 0;
+	Blocks.Empty();
+	PackedSteps.Empty();
+	PackedRotations.Empty();
+	RawValues.Empty();
+}
+
+float FCompressedTrajectory::GetQuantum(int32 component) const
+{
+	return component < 3 ? Settings.PositionQuantum : component < 6 ? Settings.VelocityQuantum : Settings.RPMQuantum;
+}
+
+float FCompressedTrajectory::DecodeComponent(int32 index, int32 component) const
+{
+	const int32 interval = Settings.KeyframeInterval;
+	const FBlock& block = Blocks[index / interval];
+	const int32 inBlock = index % interval;
+
+	int32 sampleBits = 0;
+	int32 componentBit = 0;
+	int32 rawBefore = 0;
+	for (int32 c = 0; c < NUM_COMPONENTS; c++)
+	{
+		const bool bRaw = block.Bits[c] == RAW_COMPONENT;
+		if (c < component)
+		{
+			rawBefore += bRaw ? 1 : 0;
+			componentBit += bRaw ? 0 : block.Bits[c];
+		}
+		sampleBits += bRaw ? 0 : block.Bits[c];
+	}
+
+	if (block.Bits[component] == RAW_COMPONENT)
+	{
+		const int32 blockLength = FMath::Min(interval, NumSamples - index / interval * interval);
+		return RawValues[block.RawOffset + rawBefore * blockLength + inBlock];
+	}
+	const uint32 step = ReadBits(PackedSteps, block.BitOffset + inBlock * sampleBits + componentBit, block.Bits[component]);
+	return block.Base[component] + step * GetQuantum(component);
+}
+
+FVector FCompressedTrajectory::GetLocation(int32 index) const
+{
+	check(IsValidIndex(index));
+	return FVector(DecodeComponent(index, 0), DecodeComponent(index, 1), DecodeComponent(index, 2));
+}
+
+FQuat FCompressedTrajectory::GetRotation(int32 index) const
+{
+	check(IsValidIndex(index));
+	return UnpackRotation(PackedRotations[index]);
+}
+
+FTransform FCompressedTrajectory::GetTransform(int32 index) const
+{
+	return FTransform(GetRotation(index), GetLocation(index));
+}
+
+FVector FCompressedTrajectory::GetVelocity(int32 index) const
+{
+	check(IsValidIndex(index));
+	return FVector(DecodeComponent(index, 3), DecodeComponent(index, 4), DecodeComponent(index, 5));
+}
+
+float FCompressedTrajectory::GetRPM(int32 index) const
+{
+	check(IsValidIndex(index));
+	return DecodeComponent(index, 6);
+}
+
+void FCompressedTrajectory::DecodePath(TArray<FTransform>& outPath) const
+{
+	outPath.Reset(NumSamples);
+	for (int32 i = 0; i < NumSamples; i++)
+	{
+		outPath.Add(GetTransform(i));
+	}
+}
+
+void FCompressedTrajectory::DecodeVelocities(TArray<FVector>& outVelocities) const
+{
+	outVelocities.Reset(NumSamples);
+	for (int32 i = 0; i < NumSamples; i++)
+	{
+		outVelocities.Add(GetVelocity(i));
+	}
+}
+
+void FCompressedTrajectory::DecodeRPMs(TArray<float>& outRPMs) const
+{
+	outRPMs.Reset(NumSamples);
+	for (int32 i = 0; i < NumSamples; i++)
+	{
+		outRPMs.Add(GetRPM(i));
+	}
+}
+
+SIZE_T FCompressedTrajectory::GetAllocatedSize() const
+{
+	return Blocks.GetAllocatedSize()
+		+ PackedSteps.GetAllocatedSize()
+		+ PackedRotations.GetAllocatedSize()
+		+ RawValues.GetAllocatedSize();
+}
+
+void FCompressedTrajectory::Save(FArchive& Ar) const
+{
+	check(Ar.IsSaving());
+	FTrajectoryCodecSettings settings = Settings;
+	int32 numSamples = NumSamples;
+	Ar << settings.KeyframeInterval;
+	Ar << settings.PositionQuantum;
+	Ar << settings.VelocityQuantum;
+	Ar << settings.RPMQuantum;
+	Ar << numSamples;
+	SaveArray(Ar, Blocks);
+	SaveArray(Ar, PackedSteps);
+	SaveArray(Ar, PackedRotations);
+	SaveArray(Ar, RawValues);
+}
+
+FArchive& operator<<(FArchive& Ar, FCompressedTrajectory& trajectory)
+{
+	if (Ar.IsSaving())
+	{
+		trajectory.Save(Ar);
+		return Ar;
+	}
+
+	Ar << trajectory.Settings.KeyframeInterval;
+	Ar << trajectory.Settings.PositionQuantum;
+	Ar << trajectory.Settings.VelocityQuantum;
+	Ar << trajectory.Settings.RPMQuantum;
+	Ar << trajectory.NumSamples;
+	Ar << trajectory.Blocks;
+	Ar << trajectory.PackedSteps;
+	Ar << trajectory.PackedRotations;
+	Ar << trajectory.RawValues;
+
+	// reject anything that would make the O(1) accessors read out of bounds
+	const FTrajectoryCodecSettings& settings = trajectory.Settings;
+	const int32 interval = settings.KeyframeInterval;
+	bool bConsistent = interval > 0
+		&& settings.PositionQuantum > 0.f && settings.VelocityQuantum > 0.f && settings.RPMQuantum > 0.f
+		&& trajectory.NumSamples >= 0
+		&& trajectory.Blocks.Num() == FMath::DivideAndRoundUp(trajectory.NumSamples, FMath::Max(1, interval))
+		&& trajectory.PackedRotations.Num() == trajectory.NumSamples;
+
+	int64 bitOffset = 0;
+	int64 rawOffset = 0;
+	for (int32 b = 0; b < trajectory.Blocks.Num() && bConsistent; b++)
+	{
+		const FCompressedTrajectory::FBlock& block = trajectory.Blocks[b];
+		const int32 blockLength = FMath::Min(interval, trajectory.NumSamples - b * interval);
+		bConsistent = block.BitOffset == bitOffset && block.RawOffset == rawOffset;
+		for (int32 c = 0; c < FCompressedTrajectory::NUM_COMPONENTS && bConsistent; c++)
+		{
+			if (block.Bits[c] == FCompressedTrajectory::RAW_COMPONENT)
+			{
+				rawOffset += blockLength;
+			}
+			else
+			{
+				bConsistent = block.Bits[c] <= FCompressedTrajectory::MAX_COMPONENT_BITS;
+				bitOffset += int64(block.Bits[c]) * blockLength;
+			}
+		}
+		bConsistent = bConsistent && bitOffset <= MAX_int32 && rawOffset <= MAX_int32;
+	}
+	bConsistent = bConsistent
+		&& trajectory.RawValues.Num() == rawOffset
+		&& (trajectory.NumSamples == 0 || trajectory.PackedSteps.Num() == (bitOffset + 7) / 8 + FCompressedTrajectory::PACKED_PADDING);
+	if (!bConsistent)
+	{
+		Ar.SetError();
+		trajectory.Empty();
+	}
+	return Ar;
+}
+
+uint32 FCompressedTrajectory::PackRotation(const FQuat& rotation)
+{
+	FQuat q = rotation.GetNormalized();
+	const float components[4] = { q.X, q.Y, q.Z, q.W };
+
+	int32 largest = 0;
+	for (int32 i = 1; i < 4; i++)
+	{
+		if (FMath::Abs(components[i]) > FMath::Abs(components[largest]))
+		{
+			largest = i;
+		}
+	}
+	// q and -q are the same rotation, so flip to make the dropped component positive
+	const float sign = components[largest] < 0.f ? -1.f : 1.f;
+
+	uint32 packed = uint32(largest) << 30;
+	int32 shift = 20;
+	for (int32 i = 0; i < 4; i++)
+	{
+		if (i == largest)
+		{
+			continue;
+		}
+		const float normalized = (components[i] * sign / SMALLEST_THREE_RANGE) * 0.5f + 0.5f;
+		const uint32 bits = uint32(FMath::Clamp(FMath::RoundToInt(normalized * SMALLEST_THREE_MAX), 0, int32(SMALLEST_THREE_MAX)));
+		packed |= bits << shift;
+		shift -= 10;
+	}
+	return packed;
+}
+
+FQuat FCompressedTrajectory::UnpackRotation(uint32 packed)
+{
+	const int32 largest = int32(packed >> 30);
+	float components[4];
+	float sumSquares = 0.f;
+	int32 shift = 20;
+	for (int32 i = 0; i < 4; i++)
+	{
+		if (i == largest)
+		{
+			continue;
+		}
+		const uint32 bits = (packed >> shift) & SMALLEST_THREE_MAX;
+		components[i] = ((float(bits) / SMALLEST_THREE_MAX) * 2.f - 1.f) * SMALLEST_THREE_RANGE;
+		sumSquares += components[i] * components[i];
+		shift -= 10;
+	}
+	components[largest] = FMath::Sqrt(FMath::Max(0.f, 1.f - sumSquares));
+
+	FQuat q(components[0], components[1], components[2], components[3]);
+	q.Normalize();
+	return q;
+}
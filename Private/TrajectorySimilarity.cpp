@@ -0,0 +1,145 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "TrajectorySimilarity.h"
+#include "Async/ParallelFor.h"
+
+namespace
+{
+	/** columns of b inside the band for row i (band is centred on the diagonal from (0,0) to (n-1,m-1)) */
+	void GetRowRange(int32 i, int32 n, int32 m, int32 band, int32& outLo, int32& outHi)
+	{
+		const int32 center = n > 1 ? FMath::RoundToInt(float(i) * float(m - 1) / float(n - 1)) : 0;
+		outLo = FMath::Max(0, center - band);
+		outHi = FMath::Min(m - 1, center + band);
+	}
+
+	/**
+	 * fill the banded alignment table row by row, only keeping the previous row
+	 * accumulate(bestPredecessor, sampleDistance) gives the value of a cell
+	 * @return value of the last cell (n-1, m-1)
+	 */
+	template <typename AccumulateType>
+	float BandedAlignment(const TArray<FTransform>& a, const TArray<FTransform>& b, const FTrajectorySimilaritySettings& settings, AccumulateType accumulate)
+	{
+		const int32 n = a.Num();
+		const int32 m = b.Num();
+		if (n == 0 || m == 0)
+		{
+			return 0.f;
+		}
+
+		const int32 band = FTrajectorySimilarity::GetBandWidth(n, m, settings);
+		const int32 width = FMath::Min(m, 2 * band + 1);
+		TArray<float> prev;
+		TArray<float> curr;
+		prev.SetNumUninitialized(width);
+		curr.SetNumUninitialized(width);
+
+		int32 prevLo = 0;
+		int32 prevHi = -1;
+		for (int32 i = 0; i < n; i++)
+		{
+			int32 lo, hi;
+			GetRowRange(i, n, m, band, lo, hi);
+			for (int32 j = lo; j <= hi; j++)
+			{
+				float best = (i == 0 && j == 0) ? 0.f : MAX_flt;
+				if (j > lo)
+				{
+					best = FMath::Min(best, curr[j - 1 - lo]);
+				}
+				if (j >= prevLo && j <= prevHi)
+				{
+					best = FMath::Min(best, prev[j - prevLo]);
+				}
+				if (j - 1 >= prevLo && j - 1 <= prevHi)
+				{
+					best = FMath::Min(best, prev[j - 1 - prevLo]);
+				}
+				curr[j - lo] = best == MAX_flt ? MAX_flt : accumulate(best, FTrajectorySimilarity::SampleDistance(a[i], b[j], settings.RotationWeight));
+			}
+			Swap(prev, curr);
+			prevLo = lo;
+			prevHi = hi;
+		}
+		return prev[(m - 1) - prevLo];
+	}
+}
+
+float FBandedDTWMetric::Evaluate(const TArray<FTransform>& a, const TArray<FTransform>& b, const FTrajectorySimilaritySettings& settings) const
+{
+	const float total = BandedAlignment(a, b, settings, [](float best, float dist) { return best + dist; });
+	// normalize by the longer run so long courses aren't penalized for their length
+	return total / FMath::Max(1, FMath::Max(a.Num(), b.Num()));
+}
+
+float FDiscreteFrechetMetric::Evaluate(const TArray<FTransform>& a, const TArray<FTransform>& b, const FTrajectorySimilaritySettings& settings) const
+{
+	return BandedAlignment(a, b, settings, [](float best, float dist) { return FMath::Max(best, dist); });
+}
+
+FTrajectorySimilarity::FTrajectorySimilarity()
+{
+	SetSettings(FTrajectorySimilaritySettings());
+}
+
+void FTrajectorySimilarity::SetSettings(const FTrajectorySimilaritySettings& newSettings)
+{
+	Settings = newSettings;
+
+	TArray<FWeightedMetric> custom;
+	for (const FWeightedMetric& entry : Metrics)
+	{
+		if (!entry.bBuiltIn)
+		{
+			custom.Add(entry);
+		}
+	}
+	Metrics.Reset();
+	if (Settings.bUseDTW)
+	{
+		Metrics.Add({ MakeShared<FBandedDTWMetric, ESPMode::ThreadSafe>(), Settings.DTWWeight, true });
+	}
+	if (Settings.bUseFrechet)
+	{
+		Metrics.Add({ MakeShared<FDiscreteFrechetMetric, ESPMode::ThreadSafe>(), Settings.FrechetWeight, true });
+	}
+	Metrics.Append(custom);
+}
+
+void FTrajectorySimilarity::AddMetric(const TSharedRef<ITrajectoryMetric, ESPMode::ThreadSafe>& metric, float weight)
+{
+	Metrics.Add({ metric, weight, false });
+}
+
+void FTrajectorySimilarity::Evaluate(const TArray<FTransform>& a, const TArray<FTransform>& b, TArray<FTrajectoryMetricResult>& outResults) const
+{
+	outResults.SetNum(Metrics.Num());
+	ParallelFor(Metrics.Num(), [&](int32 index)
+	{
+		const FWeightedMetric& entry = Metrics[index];
+		FTrajectoryMetricResult& result = outResults[index];
+		result.Name = entry.Metric->GetName();
+		result.Value = entry.Metric->Evaluate(a, b, Settings);
+		result.Weight = entry.Weight;
+	}, Metrics.Num() < 2);
+}
+
+int32 FTrajectorySimilarity::GetBandWidth(int32 n, int32 m, const FTrajectorySimilaritySettings& settings)
+{
+	if (n < 2 || m < 2)
+	{
+		// a single sample aligns with every sample of the other run
+		return FMath::Max(n, m);
+	}
+	const int32 longest = FMath::Max(n, m);
+	int32 band = FMath::Clamp(FMath::CeilToInt(settings.BandFraction * longest), settings.MinBand, FMath::Max(settings.MinBand, settings.MaxBand));
+	// consecutive rows' centres can be up to (m-1)/(n-1) columns apart, band has to overlap them
+	const int32 step = FMath::CeilToInt(float(m - 1) / float(n - 1));
+	return FMath::Max(band, step + 1);
+}
+
+float FTrajectorySimilarity::SampleDistance(const FTransform& a, const FTransform& b, float rotationWeight)
+{
+	return FVector::Dist(a.GetLocation(), b.GetLocation()) + rotationWeight * a.GetRotation().AngularDistance(b.GetRotation());
+}
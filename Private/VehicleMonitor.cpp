@@ -0,0 +1,17 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "VehicleMonitor.h"
+#include "VehicleAdv3Pawn.h"
+
+void FVehicleMonitorTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Target && !Target->IsPendingKillOrUnreachable() && TickType != LEVELTICK_ViewportsOnly)
+	{
+		Target->TickMonitor(DeltaTime);
+	}
+}
+
+FString FVehicleMonitorTickFunction::DiagnosticMessage()
+{
+	return Target ? Target->GetFullName() + TEXT("[TickMonitor]") : TEXT("<none>[TickMonitor]");
+}
@@ -0,0 +1,281 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "VehicleStateSnapshot.h"
+#include "WheeledVehicle.h"
+#include "WheeledVehicleMovementComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "PhysicsEngine/BodyInstance.h"
+#include "UObject/UnrealType.h"
+#if WITH_PHYSX
+#include "PhysXPublic.h"
+#endif
+
+namespace
+{
+	/** smoothed/raw inputs are protected on the movement component, reach them through reflection (looked up once) */
+	struct FMovementInputProperties
+	{
+		UFloatProperty* RawThrottle;
+		UFloatProperty* RawSteering;
+		UFloatProperty* RawBrake;
+		UBoolProperty* RawHandbrake;
+		UFloatProperty* Throttle;
+		UFloatProperty* Steering;
+		UFloatProperty* Brake;
+		UFloatProperty* Handbrake;
+
+		FMovementInputProperties()
+		{
+			UClass* movementClass = UWheeledVehicleMovementComponent::StaticClass();
+			RawThrottle = FindField<UFloatProperty>(movementClass, TEXT("RawThrottleInput"));
+			RawSteering = FindField<UFloatProperty>(movementClass, TEXT("RawSteeringInput"));
+			RawBrake = FindField<UFloatProperty>(movementClass, TEXT("RawBrakeInput"));
+			RawHandbrake = FindField<UBoolProperty>(movementClass, TEXT("bRawHandbrakeInput"));
+			Throttle = FindField<UFloatProperty>(movementClass, TEXT("ThrottleInput"));
+			Steering = FindField<UFloatProperty>(movementClass, TEXT("SteeringInput"));
+			Brake = FindField<UFloatProperty>(movementClass, TEXT("BrakeInput"));
+			Handbrake = FindField<UFloatProperty>(movementClass, TEXT("HandbrakeInput"));
+		}
+
+		static const FMovementInputProperties& Get()
+		{
+			static const FMovementInputProperties properties;
+			return properties;
+		}
+	};
+
+	float GetFloat(const UFloatProperty* property, const UObject* object)
+	{
+		return property ? property->GetPropertyValue_InContainer(object) : 0.f;
+	}
+
+	void SetFloat(const UFloatProperty* property, UObject* object, float value)
+	{
+		if (property)
+		{
+			property->SetPropertyValue_InContainer(object, value);
+		}
+	}
+
+	const float RPM_TO_OMEGA = PI / 30.f;
+}
+
+FVehicleStateSnapshot::FVehicleStateSnapshot()
+{
+	Reset();
+}
+
+void FVehicleStateSnapshot::Reset()
+{
+	Transform = FTransform::Identity;
+	Bodies.Reset();
+	Wheels.Reset();
+	AnalogInputs.Reset();
+	EngineSpeed = 0.f;
+	GearSwitchTime = 0.f;
+	AutoBoxSwitchTime = 0.f;
+	CurrentGear = 1;
+	TargetGear = 1;
+	bUseAutoGears = true;
+	bGearUp = false;
+	bGearDown = false;
+	RawThrottle = 0.f;
+	RawSteering = 0.f;
+	RawBrake = 0.f;
+	Throttle = 0.f;
+	Steering = 0.f;
+	Brake = 0.f;
+	Handbrake = 0.f;
+	bRawHandbrake = false;
+	bIsValid = false;
+}
+
+void FVehicleStateSnapshot::Capture(const AWheeledVehicle* vehicle)
+{
+	Reset();
+	if (!vehicle)
+	{
+		return;
+	}
+	Transform = vehicle->GetActorTransform();
+
+	// bodies (index matches mesh->Bodies so restore doesn't have to match names)
+	const USkeletalMeshComponent* mesh = vehicle->GetMesh();
+	const FTransform componentTransform = mesh->GetComponentTransform();
+	for (const FBodyInstance* body : mesh->Bodies)
+	{
+		FBodyState& state = Bodies[Bodies.AddZeroed()];
+		state.RelativeTransform = FTransform::Identity;
+		if (body && body->IsValidBodyInstance())
+		{
+			state.RelativeTransform = body->GetUnrealWorldTransform().GetRelativeTransform(componentTransform);
+			state.LinearVelocity = body->GetUnrealWorldVelocity();
+			state.AngularVelocity = body->GetUnrealWorldAngularVelocityInRadians();
+		}
+	}
+
+	// inputs
+	const UWheeledVehicleMovementComponent* movement = vehicle->GetVehicleMovementComponent();
+	const FMovementInputProperties& inputs = FMovementInputProperties::Get();
+	RawThrottle = GetFloat(inputs.RawThrottle, movement);
+	RawSteering = GetFloat(inputs.RawSteering, movement);
+	RawBrake = GetFloat(inputs.RawBrake, movement);
+	bRawHandbrake = inputs.RawHandbrake ? inputs.RawHandbrake->GetPropertyValue_InContainer(movement) : false;
+	Throttle = GetFloat(inputs.Throttle, movement);
+	Steering = GetFloat(inputs.Steering, movement);
+	Brake = GetFloat(inputs.Brake, movement);
+	Handbrake = GetFloat(inputs.Handbrake, movement);
+
+	// drive and wheels (PhysX gears: 0 reverse, 1 neutral)
+	CurrentGear = uint8(movement->GetCurrentGear() + 1);
+	TargetGear = uint8(movement->GetTargetGear() + 1);
+	EngineSpeed = movement->GetEngineRotationSpeed() * RPM_TO_OMEGA;
+	bUseAutoGears = movement->GetUseAutoGears();
+#if WITH_PHYSX
+	if (movement->PVehicle && movement->PVehicleDrive)
+	{
+		mesh->GetBodyInstance()->ExecuteOnPhysicsReadOnly([&]()
+		{
+			const physx::PxVehicleDriveDynData& drive = movement->PVehicleDrive->mDriveDynData;
+			for (physx::PxU32 i = 0; i < drive.getNbAnalogInput(); i++)
+			{
+				AnalogInputs.Add(drive.getAnalogInput(i));
+			}
+			EngineSpeed = drive.getEngineRotationSpeed();
+			GearSwitchTime = drive.getGearSwitchTime();
+			AutoBoxSwitchTime = drive.getAutoBoxSwitchTime();
+			CurrentGear = uint8(drive.getCurrentGear());
+			TargetGear = uint8(drive.getTargetGear());
+			bUseAutoGears = drive.getUseAutoGears();
+			bGearUp = drive.getGearUp();
+			bGearDown = drive.getGearDown();
+
+			const physx::PxVehicleWheelsDynData& wheels = movement->PVehicle->mWheelsDynData;
+			const physx::PxU32 numWheels = movement->PVehicle->mWheelsSimData.getNbWheels();
+			for (physx::PxU32 i = 0; i < numWheels; i++)
+			{
+				FWheelState& wheel = Wheels[Wheels.AddUninitialized()];
+				wheel.RotationSpeed = wheels.getWheelRotationSpeed(i);
+				wheel.RotationAngle = wheels.getWheelRotationAngle(i);
+			}
+		});
+	}
+#endif
+	bIsValid = true;
+}
+
+void FVehicleStateSnapshot::Restore(AWheeledVehicle* vehicle, bool bTeleport) const
+{
+	if (!bIsValid || !vehicle)
+	{
+		return;
+	}
+	if (bTeleport)
+	{
+		vehicle->SetActorTransform(Transform, false, nullptr, ETeleportType::TeleportPhysics);
+	}
+
+	// velocities are stored in world space, turn them with the vehicle if it isn't at the captured heading
+	const FQuat turn = vehicle->GetActorQuat() * Transform.GetRotation().Inverse();
+	USkeletalMeshComponent* mesh = vehicle->GetMesh();
+	const FTransform componentTransform = mesh->GetComponentTransform();
+	const int32 numBodies = FMath::Min(Bodies.Num(), mesh->Bodies.Num());
+	for (int32 i = 0; i < numBodies; i++)
+	{
+		FBodyInstance* body = mesh->Bodies[i];
+		if (!body || !body->IsValidBodyInstance())
+		{
+			continue;
+		}
+		const FBodyState& state = Bodies[i];
+		if (numBodies > 1)
+		{
+			body->SetBodyTransform(state.RelativeTransform * componentTransform, ETeleportType::TeleportPhysics);
+		}
+		body->SetLinearVelocity(turn.RotateVector(state.LinearVelocity), false);
+		body->SetAngularVelocityInRadians(turn.RotateVector(state.AngularVelocity), false);
+	}
+
+	UWheeledVehicleMovementComponent* movement = vehicle->GetVehicleMovementComponent();
+	movement->SetThrottleInput(RawThrottle);
+	movement->SetSteeringInput(RawSteering);
+	movement->SetBrakeInput(RawBrake);
+	movement->SetHandbrakeInput(bRawHandbrake);
+	const FMovementInputProperties& inputs = FMovementInputProperties::Get();
+	SetFloat(inputs.Throttle, movement, Throttle);
+	SetFloat(inputs.Steering, movement, Steering);
+	SetFloat(inputs.Brake, movement, Brake);
+	SetFloat(inputs.Handbrake, movement, Handbrake);
+
+#if WITH_PHYSX
+	if (movement->PVehicle && movement->PVehicleDrive)
+	{
+		mesh->GetBodyInstance()->ExecuteOnPhysicsReadWrite([&]()
+		{
+			physx::PxVehicleDriveDynData& drive = movement->PVehicleDrive->mDriveDynData;
+			const int32 numInputs = FMath::Min(AnalogInputs.Num(), int32(drive.getNbAnalogInput()));
+			for (int32 i = 0; i < numInputs; i++)
+			{
+				drive.setAnalogInput(i, AnalogInputs[i]);
+			}
+			drive.setEngineRotationSpeed(EngineSpeed);
+			drive.setUseAutoGears(bUseAutoGears);
+			drive.setGearUp(bGearUp);
+			drive.setGearDown(bGearDown);
+			drive.setCurrentGear(CurrentGear);
+			drive.setTargetGear(TargetGear);
+			drive.mGearSwitchTime = GearSwitchTime;
+			drive.mAutoBoxSwitchTime = AutoBoxSwitchTime;
+
+			physx::PxVehicleWheelsDynData& wheels = movement->PVehicle->mWheelsDynData;
+			const int32 numWheels = FMath::Min(Wheels.Num(), int32(movement->PVehicle->mWheelsSimData.getNbWheels()));
+			for (int32 i = 0; i < numWheels; i++)
+			{
+				wheels.setWheelRotationSpeed(i, Wheels[i].RotationSpeed);
+				wheels.setWheelRotationAngle(i, Wheels[i].RotationAngle);
+			}
+		});
+		return;
+	}
+#endif
+	// no drive to write to directly
+	movement->SetTargetGear(GetGear(), true);
+	movement->SetEngineRotationSpeed(GetRPM());
+}
+
+void FVehicleStateSnapshot::Serialize(FArchive& Ar)
+{
+	Ar << Transform;
+	Ar << Bodies;
+	Ar << Wheels;
+	Ar << AnalogInputs;
+	Ar << EngineSpeed << GearSwitchTime << AutoBoxSwitchTime;
+	Ar << CurrentGear << TargetGear << bUseAutoGears << bGearUp << bGearDown;
+	Ar << RawThrottle << RawSteering << RawBrake;
+	Ar << Throttle << Steering << Brake << Handbrake << bRawHandbrake;
+	Ar << bIsValid;
+	if (Ar.IsLoading() && Ar.IsError())
+	{
+		Reset();
+	}
+}
+
+FVector FVehicleStateSnapshot::GetLinearVelocity() const
+{
+	return Bodies.Num() > 0 ? Bodies[0].LinearVelocity : FVector::ZeroVector;
+}
+
+FVector FVehicleStateSnapshot::GetAngularVelocity() const
+{
+	return Bodies.Num() > 0 ? FMath::RadiansToDegrees(Bodies[0].AngularVelocity) : FVector::ZeroVector;
+}
+
+int32 FVehicleStateSnapshot::GetGear() const
+{
+	return int32(CurrentGear) - 1;
+}
+
+float FVehicleStateSnapshot::GetRPM() const
+{
+	return EngineSpeed / RPM_TO_OMEGA;
+}
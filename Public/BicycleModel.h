@@ -0,0 +1,145 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ErrorDetectionCore.h"
+#include "PathTracker.h"
+#include "BicycleModel.generated.h"
+
+/** when the analytic model may stand in for a physics rollout */
+USTRUCT(BlueprintType)
+struct VEHICLEADV3_API FBicycleModelSettings
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, Category = AnalyticPrediction)
+	bool bEnabled = true;
+
+	/** largest average path error (cm, max over a horizon) against physics rollouts that still counts as validated */
+	UPROPERTY(EditAnywhere, Category = AnalyticPrediction, meta = (ClampMin = "0"))
+	float MaxValidatedError = 150.f;
+
+	/** largest heading and rpm error against physics rollouts (max over a horizon), as a fraction of the error
+	  * detection thresholds, that still counts as validated: an analytic future mustn't raise errors a rollout wouldn't */
+	UPROPERTY(EditAnywhere, Category = AnalyticPrediction, meta = (ClampMin = "0", ClampMax = "1"))
+	float MaxValidatedThresholdFraction = 0.5f;
+
+	/** rollouts the model has to be checked against before it's used */
+	UPROPERTY(EditAnywhere, Category = AnalyticPrediction, meta = (ClampMin = "1"))
+	int32 MinValidations = 3;
+
+	/** once validated, every Nth prediction is still a physics rollout to keep checking (and fitting) the model */
+	UPROPERTY(EditAnywhere, Category = AnalyticPrediction, meta = (ClampMin = "1"))
+	int32 ValidateEveryNth = 4;
+
+	/** weight of the newest validation in the running error */
+	UPROPERTY(EditAnywhere, Category = AnalyticPrediction, meta = (ClampMin = "0.01", ClampMax = "1"))
+	float ErrorSmoothing = 0.3f;
+};
+
+/** identified parameters, starting from rough values for the template vehicle */
+struct FBicycleModelParameters
+{
+	/** longitudinal: dv/dt = Drive * throttle - Drag * v|v| - Rolling * v (cm/s^2) */
+	float Drive = 500.f;
+	float Drag = 1e-5f;
+	float Rolling = 0.1f;
+
+	/** steady-state path curvature (1/cm) = SteerGain * steer / (1 + Understeer * v^2) */
+	float SteerGain = 0.0023f;
+	float Understeer = 0.f;
+
+	/** yaw rate approaches the steady-state value with this time constant (s) */
+	float YawLag = 0.2f;
+
+	/** engine rpm = IdleRPM + RPMPerSpeed * |v| */
+	float IdleRPM = 1000.f;
+	float RPMPerSpeed = 0.2f;
+};
+
+/**
+ * dynamic bicycle model with engine/drag terms, fitted by least squares to the vehicle's own clean runs (the target
+ * run and every physics rollout), that predicts a horizon by integrating a handful of floats per tick
+ * it stands in for a physics rollout once its error against rollouts from the same start has been validated
+ * a car following the target run is modelled with a copy of its path tracker choosing the inputs every tick, like a clone
+ * planar: height, pitch and roll stay as they were at the start, so ramps show up as validation error
+ */
+class VEHICLEADV3_API FBicycleModel
+{
+public:
+
+	FBicycleModel();
+
+	void SetSettings(const FBicycleModelSettings& newSettings);
+	const FBicycleModelSettings& GetSettings() const { return Settings; }
+
+	/** add a clean run sampled every tickSeconds, driven with constant throttle/steer, and refit */
+	void AddRun(const TArray<FTransform>& path, const TArray<FVector>& velocities, const TArray<float>& rpms, float tickSeconds, float throttle, float steer);
+
+	/** add a clean run driven by tracker (as it was when the run started) and refit, the inputs are worked out again
+	  * by running a copy of the tracker along the recorded path (arguments as for Predict) */
+	void AddTrackedRun(const TArray<FTransform>& path, const TArray<FVector>& velocities, const TArray<float>& rpms, float tickSeconds, const FPathTracker& tracker,
+		float throttle, float throttleBias, float steer);
+
+	/**
+	 * integrate horizonSeconds from start pose/velocity (cm/s)/angular velocity (deg/s), one sample per tickSeconds
+	 * like a rollout records them
+	 * inputs are throttle + throttleBias and steer, constant, or with an active tracker a copy of it drives
+	 * (throttle is its feed-forward throttle) and throttleBias and steer are added to its inputs, as on the car
+	 */
+	void Predict(const FTransform& start, const FVector& linearVelocity, const FVector& angularVelocity, float horizonSeconds, float tickSeconds, float throttle, float throttleBias, float steer,
+		TArray<FTransform>& outPath, TArray<FVector>& outVelocities, TArray<float>& outRPMs, const FPathTracker* tracker = nullptr) const;
+
+	/** record error of a prediction against the physics rollout from the same start and inputs
+	 * @param thresholds error detection thresholds, heading and rpm error are measured as a fraction of them
+	 * @return max distance (cm) between the two paths */
+	float RecordValidation(const TArray<FTransform>& predictedPath, const TArray<float>& predictedRPMs, const TArray<FTransform>& rolloutPath, const TArray<float>& rolloutRPMs,
+		const DetectionCore::FThresholds& thresholds);
+
+	/** @returns true if this (validated) prediction should be checked against a physics rollout instead of used */
+	bool ShouldValidate();
+
+	bool IsFitted() const { return NumRuns > 0; }
+
+	/** fitted and recently close enough to physics rollouts to be used */
+	bool IsValidated() const;
+
+	const FBicycleModelParameters& GetParameters() const { return Parameters; }
+	int32 GetNumValidations() const { return NumValidations; }
+	float GetValidationError() const { return ValidationError; }
+	float GetValidationThresholdFraction() const { return ValidationThresholdFraction; }
+
+private:
+
+	/** normal equations of a small least-squares problem, ridge-regularized towards the prior parameters */
+	template <int32 N>
+	struct TNormalEquations
+	{
+		double XtX[N][N];
+		double Xty[N];
+		TNormalEquations() { FMemory::Memzero(XtX); FMemory::Memzero(Xty); }
+		void Add(const double (&x)[N], double y);
+		void Solve(const double (&prior)[N], double (&outSolution)[N]) const;
+	};
+
+	FBicycleModelSettings Settings;
+	FBicycleModelParameters Parameters;
+
+	TNormalEquations<3> Longitudinal;
+	TNormalEquations<2> Lateral;
+	TNormalEquations<1> YawResponse;
+	TNormalEquations<2> Engine;
+	int32 NumRuns;
+
+	int32 NumValidations;
+	float ValidationError;
+	float ValidationThresholdFraction;
+	int32 ValidatedUses;
+
+	/** steady-state yaw rate (rad/s) at forward speed v */
+	float GetSteadyYawRate(float v, float steer) const;
+
+	/** AddRun with the throttle and steer of every tick */
+	void AddRunWithInputs(const TArray<FTransform>& path, const TArray<FVector>& velocities, const TArray<float>& rpms, float tickSeconds, const TArray<float>& throttles, const TArray<float>& steers);
+};
@@ -0,0 +1,124 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ControlResponseIndex.generated.h"
+
+/** how recorded input responses are compared with a wanted correction */
+USTRUCT(BlueprintType)
+struct VEHICLEADV3_API FControlResponseSettings
+{
+	GENERATED_BODY()
+
+	/** pick diagnostic inputs by the response they produced (off: random distance bucket) */
+	UPROPERTY(EditAnywhere, Category = ControlResponse)
+	bool bEnabled = true;
+
+	/** compare full poses (SE(3): position + rotation vector) instead of planar ones (SE(2): x, y, yaw) */
+	UPROPERTY(EditAnywhere, Category = ControlResponse)
+	bool bFullPose = false;
+
+	/** weight of orientation against position, both measured in spreads of the recorded responses */
+	UPROPERTY(EditAnywhere, Category = ControlResponse, meta = (ClampMin = "0"))
+	float RotationWeight = 1.f;
+
+	/** size of the wanted correction, in spreads of the recorded responses around the no-adjustment response */
+	UPROPERTY(EditAnywhere, Category = ControlResponse, meta = (ClampMin = "0"))
+	float CorrectionSize = 1.f;
+
+	/** inputs returned per query (diagnostic candidates take one each) */
+	UPROPERTY(EditAnywhere, Category = ControlResponse, meta = (ClampMin = "1"))
+	int32 NumNearest = 4;
+};
+
+/**
+ * kd-tree over the end poses recorded for each input set, relative to the pose they started from
+ * inverse lookup: given the correction the car needs (faster/slower, left/right), returns the inputs whose
+ * recorded responses came closest to it
+ * responses are measured from the no-adjustment response and scaled by their spread, so the metric doesn't depend on
+ * the units the mapping was recorded in
+ * which way more throttle or more steering moves the response is fitted to the recorded data (least squares), not
+ * assumed from the start heading: the mapping's frame needn't line up with it
+ */
+class VEHICLEADV3_API FControlResponseIndex
+{
+public:
+
+	static const int32 MAX_DIMENSIONS = 6;
+
+	FControlResponseIndex();
+
+	/**
+	 * index end poses of input sets driven from start
+	 * @param adjustments throttle (X) and steer (Y) adjustment each input set was driven with
+	 * @param neutral input set without any adjustment, corrections are measured from its response
+	 */
+	void Build(const FTransform& start, const TArray<FTransform>& ends, const TArray<FVector2D>& adjustments, int32 neutral, const FControlResponseSettings& newSettings);
+
+	bool IsBuilt() const { return Points.Num() > 0; }
+
+	/**
+	 * inputs whose responses best match a correction relative to the no-adjustment response, nearest first
+	 * @param forward wanted change in speed (+ faster, - slower), -1..1: along the fitted throttle response
+	 * @param lateral wanted change across the path (+ right, - left), -1..1: along the fitted steer response, and only
+	 *        inputs steering that way are returned; ignored if steering showed no consistent response (IsSteerUsable)
+	 */
+	void FindCorrection(float forward, float lateral, TArray<int32>& outIndices) const;
+
+	/** recorded steering moved the response enough, and steer-positive inputs ended up right of steer-negative ones */
+	bool IsSteerUsable() const { return bSteerUsable; }
+
+	/** k input sets nearest to point (scaled response coordinates, GetNumDimensions() of them), nearest first */
+	void FindNearest(const float* point, int32 k, TArray<int32>& outIndices) const;
+
+	int32 GetNumDimensions() const { return Settings.bFullPose ? 6 : 3; }
+	const FControlResponseSettings& GetSettings() const { return Settings; }
+
+private:
+
+	struct FPoint
+	{
+		float X[MAX_DIMENSIONS];
+	};
+
+	/** k best so far, sorted by distance */
+	struct FNearest
+	{
+		TArray<TPair<float, int32>, TInlineAllocator<16>> Best;
+		int32 K;
+		float Worst() const { return Best.Num() < K ? MAX_flt : Best.Last().Key; }
+		void Add(float distance, int32 index);
+	};
+
+	FControlResponseSettings Settings;
+
+	/** scaled response per input set */
+	TArray<FPoint> Points;
+
+	/** throttle (X) and steer (Y) adjustment per input set */
+	TArray<FVector2D> Adjustments;
+
+	/** unit direction the scaled response moves in with more throttle/steer */
+	FPoint ThrottleDirection;
+	FPoint SteerDirection;
+	bool bSteerUsable;
+
+	/** input sets in tree order: node of range [lo, hi) is Order[(lo + hi) / 2], children are the halves around it */
+	TArray<int32> Order;
+
+	/** split axis of the node at each tree position */
+	TArray<uint8> SplitAxis;
+
+	int32 Neutral;
+
+	/** position and orientation spread the coordinates are divided by */
+	float PositionScale;
+	float RotationScale;
+
+	void ToCoordinates(const FTransform& relative, float* outX) const;
+	void FitResponseDirections();
+	void BuildRange(int32 lo, int32 hi);
+	void SearchRange(int32 lo, int32 hi, const float* point, FNearest& nearest) const;
+	float DistSquared(const float* a, const float* b) const;
+};
@@ -3,50 +3,39 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "UObject/NoExportTypes.h"
-#include "CopyVehicleData.generated.h"
+#include "VehicleStateSnapshot.h"
+
+class AWheeledVehicle;
 
 /**
- * TODO wtf is the point of this class?
+ * state of the primary vehicle at the moment a copy is spawned (value type, owned by the pawn)
  */
-UCLASS()
-class VEHICLEADV3_API UCopyVehicleData : public UObject
+struct VEHICLEADV3_API FCopyVehicleData
 {
-	GENERATED_BODY()
-
-		//NTODO: pointers?
-	FVector linearVelocity;
-	FVector angularVelocity;
-	FTransform startPosition;
-	int32 gear;
-	float rpm;
+private:
+	FVehicleStateSnapshot vehicleState;
 
 public:
 
-	UCopyVehicleData();
-	
-	static UCopyVehicleData* MAKE(FVector linear, FVector angular);
-	static UCopyVehicleData* MAKE(FVector linear, FVector angular, FTransform & start, int32 currentGear, float rpm);
-
-	~UCopyVehicleData();
+	/* capture full state of vehicle (what a normal constructor would do) */
+	void Capture(const AWheeledVehicle* vehicle);
 
-	/* init method (what a normal constructor would do) */
-	void Initialize(FVector linear, FVector angular, FTransform start, int32 currentGear, float rpm);
+	/** @returns captured state, restore it onto a copy (or the primary vehicle when resuming) */
+	const FVehicleStateSnapshot& GetVehicleState() const;
 
-	//NTODO: ptrs?
 	/** @returns linearVelocity */
-	FVector GetLinearVelocity();
+	FVector GetLinearVelocity() const;
 
 	/** @returns angularVelocity */
-	FVector GetAngularVelocity();
+	FVector GetAngularVelocity() const;
 
 	/** @returns startPosition */
-	FTransform GetStartPosition();
+	FTransform GetStartPosition() const;
 
 	/** @returns gear */
-	int32 GetGear();
+	int32 GetGear() const;
 
 	/** @returns rpm */
-	float GetRpm();
+	float GetRpm() const;
 	
 };
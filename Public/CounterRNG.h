@@ -0,0 +1,96 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * counter-based random stream (Philox4x32-10, Salmon et al. 2011)
+ * every value is a pure function of (session seed, vehicle id, cycle, candidate, draw index), so
+ * - streams share no state: candidates can be sampled on any thread, in any order, without locks
+ * - a run is reproduced bit for bit by reusing its session seed
+ */
+class FCounterRNG
+{
+public:
+
+	FCounterRNG(uint64 sessionSeed, uint32 vehicleId, uint32 cycle, uint32 candidate)
+		: Draw(0)
+		, Used(4)
+	{
+		Key[0] = uint32(sessionSeed);
+		Key[1] = vehicleId;
+		Counter[0] = 0;
+		Counter[1] = candidate;
+		Counter[2] = cycle;
+		Counter[3] = uint32(sessionSeed >> 32);
+	}
+
+	/** @returns next 32 random bits */
+	uint32 GetUnsignedInt()
+	{
+		if (Used == 4)
+		{
+			Counter[0] = Draw++;
+			Philox4x32_10(Counter, Key, Block);
+			Used = 0;
+		}
+		return Block[Used++];
+	}
+
+	/** @returns uniform float in [0, 1) */
+	float GetFraction()
+	{
+		// top 24 bits fill the float mantissa exactly
+		return float(GetUnsignedInt() >> 8) * (1.f / 16777216.f);
+	}
+
+	/** @returns integer in [min, max] (inclusive, like FMath::RandRange) */
+	int32 RandRange(int32 min, int32 max)
+	{
+		if (max <= min)
+		{
+			return min;
+		}
+		const uint64 range = uint64(int64(max) - int64(min)) + 1;
+		return int32(int64(min) + int64((uint64(GetUnsignedInt()) * range) >> 32));
+	}
+
+	/** @returns float in [min, max) */
+	float FRandRange(float min, float max)
+	{
+		return min + (max - min) * GetFraction();
+	}
+
+	/** one Philox4x32 block: 10 rounds over counter with key */
+	static void Philox4x32_10(const uint32 counter[4], const uint32 key[2], uint32 out[4])
+	{
+		uint32 c0 = counter[0], c1 = counter[1], c2 = counter[2], c3 = counter[3];
+		uint32 k0 = key[0], k1 = key[1];
+		for (int32 round = 0; round < 10; round++)
+		{
+			const uint64 product0 = uint64(0xD2511F53u) * c0;
+			const uint64 product1 = uint64(0xCD9E8D57u) * c2;
+			const uint32 hi0 = uint32(product0 >> 32), lo0 = uint32(product0);
+			const uint32 hi1 = uint32(product1 >> 32), lo1 = uint32(product1);
+			c0 = hi1 ^ c1 ^ k0;
+			c1 = lo1;
+			c2 = hi0 ^ c3 ^ k1;
+			c3 = lo0;
+			k0 += 0x9E3779B9u;
+			k1 += 0xBB67AE85u;
+		}
+		out[0] = c0;
+		out[1] = c1;
+		out[2] = c2;
+		out[3] = c3;
+	}
+
+private:
+
+	uint32 Key[2];
+	uint32 Counter[4];
+	uint32 Block[4];
+	uint32 Draw;
+	int32 Used;
+};
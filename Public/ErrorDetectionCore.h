@@ -0,0 +1,197 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+// error detection and triage rules used by the vehicle pawn and by the offline evaluator (Tools/ErrorEvaluator)
+// plain types and no engine headers, so both run exactly the same arithmetic on the same inputs
+
+#include <cmath>
+#include <cstdint>
+#include "RunRecordFormat.h"
+
+namespace DetectionCore
+{
+	struct FVec3
+	{
+		float X, Y, Z;
+	};
+
+	/** quaternion, xyzw like FQuat */
+	struct FQuat4
+	{
+		float X, Y, Z, W;
+	};
+
+	/** limits past which actual state counts as an error */
+	struct FThresholds
+	{
+		/** cm in the ground plane (phone gps is good to ~4.9 m, https://www.gps.gov/systems/gps/performance/accuracy/) */
+		float Location = 800.f;
+		/** radians between actual and expected heading */
+		float Rotation = 0.2f;
+		/** set empirically */
+		float RPM = 90.f;
+	};
+
+	/** how far actual state is from expected state */
+	struct FStateError
+	{
+		float Location;
+		float Rotation;
+		float RPM;
+	};
+
+	/** left/right drift as stored in triage results */
+	static const int LEFT = -1;
+	static const int RIGHT = 1;
+
+	/** what triage concluded (matches SDiagnostics) */
+	struct FTriage
+	{
+		bool bTryThrottle = false;
+		bool bTrySteer = false;
+		int Drift = 0;
+		int SpeedDiff = 0;
+	};
+
+	/** landmarks missed/unexpectedly seen on each side by the last camera sweep */
+	struct FCameraMisses
+	{
+		int MissingRight;
+		int MissingLeft;
+		int ExtraRight;
+		int ExtraLeft;
+	};
+
+	inline float DistSquaredXY(const FVec3& a, const FVec3& b)
+	{
+		return (b.X - a.X) * (b.X - a.X) + (b.Y - a.Y) * (b.Y - a.Y);
+	}
+
+	/** @returns actual vs expected errors (location in the ground plane, FQuat::AngularDistance, absolute rpm) */
+	inline FStateError Measure(const FVec3& actualLocation, const FQuat4& actualRotation, float actualRPM, const FVec3& expectedLocation, const FQuat4& expectedRotation, float expectedRPM)
+	{
+		FStateError error;
+		error.Location = std::sqrt(DistSquaredXY(expectedLocation, actualLocation));
+		const float innerProduct = actualRotation.X * expectedRotation.X + actualRotation.Y * expectedRotation.Y + actualRotation.Z * expectedRotation.Z + actualRotation.W * expectedRotation.W;
+		const float cosine = 2.f * innerProduct * innerProduct - 1.f;
+		error.Rotation = std::acos(cosine > 1.f ? 1.f : (cosine < -1.f ? -1.f : cosine));
+		error.RPM = std::fabs(expectedRPM - actualRPM);
+		return error;
+	}
+
+	/** @returns RunFile::EErrorFlags (location/rotation/rpm) for errors over threshold */
+	inline uint8_t Classify(const FStateError& error, const FThresholds& thresholds)
+	{
+		uint8_t errors = 0;
+		if (error.Location > thresholds.Location)
+		{
+			errors |= RunFile::ERROR_LOCATION;
+		}
+		if (error.Rotation > thresholds.Rotation)
+		{
+			errors |= RunFile::ERROR_ROTATION;
+		}
+		if (error.RPM > thresholds.RPM)
+		{
+			errors |= RunFile::ERROR_RPM;
+		}
+		return errors;
+	}
+
+	inline uint8_t ToErrorFlags(bool bCamera, bool bRotation, bool bRpm, bool bLocation)
+	{
+		return uint8_t((bCamera ? RunFile::ERROR_CAMERA : 0) | (bRotation ? RunFile::ERROR_ROTATION : 0) | (bRpm ? RunFile::ERROR_RPM : 0) | (bLocation ? RunFile::ERROR_LOCATION : 0));
+	}
+
+	/** location error on its own doesn't start triage (gps alone is too coarse) */
+	inline bool ShouldTriage(uint8_t errors)
+	{
+		return (errors & (RunFile::ERROR_CAMERA | RunFile::ERROR_ROTATION | RunFile::ERROR_RPM)) != 0;
+	}
+
+	/** @return -1 if m is to the left of line a->b, 0 if on it, 1 if on the right */
+	inline int SideOfLine(const FVec3& a, const FVec3& b, const FVec3& m)
+	{
+		const float side = (b.X - a.X) * (m.Y - a.Y) - (b.Y - a.Y) * (m.X - a.X);
+		return side > 0.f ? 1 : (side < 0.f ? -1 : 0);
+	}
+
+	/** best guess if car at m is too fast or slow compared to expected location on the way start->goal
+	 * @return -2 if reversed, -1 if too slow, 0 if correct speed or inconclusive, 1 if too fast */
+	inline int FastOrSlow(const FVec3& start, const FVec3& goal, const FVec3& expected, const FVec3& m)
+	{
+		const float dstartM = DistSquaredXY(start, m);
+		const float dstartE = DistSquaredXY(start, expected);
+		const float dgoalM = DistSquaredXY(goal, m);
+		const float dgoalE = DistSquaredXY(goal, expected);
+		const float dstartGoal = DistSquaredXY(start, goal);
+
+		// if start is closer to goal than m then could be reversed
+		if (dstartGoal < DistSquaredXY(m, goal))
+		{
+			return -2;
+		}
+		// if goal is closer to start than m probably too fast
+		if (dstartGoal < DistSquaredXY(m, start))
+		{
+			return 1;
+		}
+		// if m is closer to start than expected then too slow
+		if (dstartM < dstartE)
+		{
+			return -1;
+		}
+		// if m is closer to goal than expected then too fast
+		if (dgoalM < dgoalE)
+		{
+			return 1;
+		}
+		return 0;
+	}
+
+	/** decide if error is likely throttle fixable or steering fixable
+	 * @param camera landmark misses for a camera error, nullptr if not known (camera error then only asks for both fixes)
+	 * @param bHaveExpected start/goal/expected are set (a prediction is being compared)
+	 * @param start prediction start, goal prediction's final location, expected expected location at the error tick, actual car location */
+	inline FTriage Triage(uint8_t errors, const FCameraMisses* camera, bool bHaveExpected, const FVec3& start, const FVec3& goal, const FVec3& expected, const FVec3& actual)
+	{
+		FTriage result;
+		if (errors & RunFile::ERROR_CAMERA)
+		{
+			if (camera)
+			{
+				if (camera->MissingRight < camera->MissingLeft || camera->ExtraRight < camera->ExtraLeft)
+				{
+					result.Drift = RIGHT;
+				}
+				if (camera->MissingRight > camera->MissingLeft || camera->ExtraRight > camera->ExtraLeft)
+				{
+					result.Drift = LEFT;
+				}
+			}
+			result.bTryThrottle = true;
+			result.bTrySteer = true;
+		}
+		if (errors & RunFile::ERROR_ROTATION)
+		{
+			// TODO do more with angle difference etc.
+			result.bTrySteer = true;
+		}
+		if ((errors & RunFile::ERROR_LOCATION) && bHaveExpected)
+		{
+			result.bTryThrottle = true;
+			result.bTrySteer = true;
+			// TODO what to do if drift already defined and disagree...
+			result.Drift = SideOfLine(start, expected, actual);
+			result.SpeedDiff = FastOrSlow(start, goal, expected, actual);
+		}
+		if ((errors & RunFile::ERROR_RPM) && bHaveExpected)
+		{
+			result.bTryThrottle = true;
+			result.SpeedDiff = FastOrSlow(start, goal, expected, actual);
+			result.Drift = SideOfLine(start, expected, actual);
+		}
+		return result;
+	}
+}
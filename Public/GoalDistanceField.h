@@ -0,0 +1,54 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UWorld;
+
+/**
+ * driving distance (cm) to the nearest goal, sampled on a uniform xy grid over the level and built once per world
+ * cells are drivable where a downward trace hits static geometry that isn't too steep; distances come from a
+ * multi-source Dijkstra pass out from every AGoal over 8-connected cells, so walls and ramps are driven around/up
+ * rather than through, and a lookup is a bilinear blend of the four nearest cell centres
+ */
+class VEHICLEADV3_API FGoalDistanceField
+{
+public:
+
+	/** height of cells a car can't be on */
+	static const float UNDRIVABLE;
+
+	/** @returns field for world, rasterized from its static geometry and AGoal actors the first time it's asked for */
+	static const FGoalDistanceField& Get(UWorld* world);
+
+	/**
+	 * (re)build from surface heights (x-major, gridX * gridY, UNDRIVABLE where there's no road) and goal locations
+	 * maxGrade: steepest climb (rise/run) between neighbouring cells; drops of any height are allowed (ramp jumps)
+	 */
+	void Build(const FVector2D& origin, float cellSize, int32 gridX, int32 gridY, const TArray<float>& heights, const TArray<FVector>& goals, float maxGrade = 0.6f);
+
+	/** @returns driving distance from location to the nearest goal, straight-line distance if it's off the field */
+	float GetDistance(const FVector& location) const;
+
+	/** @returns whether any cell can reach a goal */
+	bool IsValid() const { return ReachableCells > 0; }
+
+	int32 GetReachableCells() const { return ReachableCells; }
+
+private:
+
+	float GetStraightLineDistance(const FVector& location) const;
+
+	FVector2D GridOrigin = FVector2D::ZeroVector;
+	float CellSize = 100.f;
+	int32 GridX = 0;
+	int32 GridY = 0;
+
+	/** per cell, x-major: surface height and distance to goal (MAX_flt if unreachable) */
+	TArray<float> Heights;
+	TArray<float> Distances;
+	int32 ReachableCells = 0;
+
+	TArray<FVector> Goals;
+};
@@ -0,0 +1,68 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class ALandmark;
+class UWorld;
+
+/** view of the landmark 'camera' mounted on the car */
+struct FLandmarkSensorSettings
+{
+	/** full horizontal field of view (degrees) */
+	float HorizontalFOV = 90.f;
+
+	/** full vertical field of view (degrees) */
+	float VerticalFOV = 60.f;
+
+	/** furthest a landmark can be and still be seen (cm) */
+	float Range = 1500.f;
+
+	/** camera height above the vehicle origin (cm) */
+	float MountHeight = 10.f;
+};
+
+/**
+ * static uniform grid (xy) over the level's landmarks, built once per world
+ * answers "which landmarks are visible from this pose" by frustum culling the grid cells in range, without touching
+ * the physics scene, so the expected view from any predicted pose can be computed as cheaply as the actual one
+ * landmarks get dense ids 0..Num()-1 and queries return them in ascending order (two views compare with ==)
+ */
+class VEHICLEADV3_API FLandmarkSensor
+{
+public:
+
+	/** @returns sensor for world, built from its ALandmark actors the first time it's asked for */
+	static const FLandmarkSensor& Get(UWorld* world);
+
+	/** (re)build grid over landmark locations/sides (id = index), cellSize in cm */
+	void Build(const TArray<FVector>& locations, const TArray<bool>& onLeft, float cellSize = 1000.f);
+
+	/** dense ids, ascending, of landmarks inside the view frustum of a camera on a car at pose */
+	void Query(const FTransform& pose, const FLandmarkSensorSettings& settings, TArray<int32>& outIds) const;
+
+	int32 Num() const { return Locations.Num(); }
+
+	FVector GetLocation(int32 id) const { return Locations[id]; }
+
+	bool IsOnLeft(int32 id) const { return bOnLeft[id]; }
+
+	/** @returns landmark actor for id (null if it has been destroyed or the grid wasn't built from a world) */
+	ALandmark* GetLandmark(int32 id) const;
+
+private:
+
+	/** per dense id */
+	TArray<FVector> Locations;
+	TArray<bool> bOnLeft;
+	TArray<TWeakObjectPtr<ALandmark>> Actors;
+
+	/** grid cells, x-major; ids of cell c are CellIds[CellStart[c]..CellStart[c+1]) */
+	FVector2D GridOrigin = FVector2D::ZeroVector;
+	float CellSize = 1000.f;
+	int32 GridX = 0;
+	int32 GridY = 0;
+	TArray<int32> CellStart;
+	TArray<int32> CellIds;
+};
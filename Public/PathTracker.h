@@ -0,0 +1,112 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PathTracker.generated.h"
+
+/** gains and geometry of the path tracking controller */
+USTRUCT(BlueprintType)
+struct VEHICLEADV3_API FPathTrackerSettings
+{
+	GENERATED_BODY()
+
+	/** steer and throttle to follow the target run (-OpenLoop turns it off: constant inputs plus adjustments) */
+	UPROPERTY(EditAnywhere, Category = PathTracking)
+	bool bEnabled = true;
+
+	/** pure pursuit look-ahead (cm) = LookaheadDistance + LookaheadTime * speed */
+	UPROPERTY(EditAnywhere, Category = PathTracking, meta = (ClampMin = "50"))
+	float LookaheadDistance = 600.f;
+
+	UPROPERTY(EditAnywhere, Category = PathTracking, meta = (ClampMin = "0"))
+	float LookaheadTime = 0.4f;
+
+	/** front to rear axle (cm) */
+	UPROPERTY(EditAnywhere, Category = PathTracking, meta = (ClampMin = "1"))
+	float WheelBase = 270.f;
+
+	/** front wheel angle at full steering input (deg) */
+	UPROPERTY(EditAnywhere, Category = PathTracking, meta = (ClampMin = "1"))
+	float MaxSteerAngle = 40.f;
+
+	/** throttle per cm/s below the target run's speed at the same point */
+	UPROPERTY(EditAnywhere, Category = PathTracking, meta = (ClampMin = "0"))
+	float SpeedP = 0.001f;
+
+	/** throttle per cm of accumulated speed error */
+	UPROPERTY(EditAnywhere, Category = PathTracking, meta = (ClampMin = "0"))
+	float SpeedI = 0.0005f;
+
+	/** largest throttle the integral term may add or take away */
+	UPROPERTY(EditAnywhere, Category = PathTracking, meta = (ClampMin = "0"))
+	float MaxIntegralThrottle = 0.4f;
+
+	/** target samples behind/ahead of the cursor searched for the closest one each tick */
+	UPROPERTY(EditAnywhere, Category = PathTracking, meta = (ClampMin = "0"))
+	int32 SearchBehind = 8;
+
+	UPROPERTY(EditAnywhere, Category = PathTracking, meta = (ClampMin = "1"))
+	int32 SearchAhead = 64;
+};
+
+/** inputs for one tick */
+struct FPathTrackerCommand
+{
+	float Steer = 0.f;
+	float Throttle = 0.f;
+
+	/** distance from the closest target sample (cm, + right of it) */
+	float CrossTrackError = 0.f;
+};
+
+/**
+ * feedback controller following a recorded run: pure pursuit for steering, PI on the run's speed profile for throttle
+ * a cursor moves along the target path with the car (closest sample in a fixed window around it, like
+ * FRunCostAccumulator) and the look-ahead point only moves forward from it, so a tick costs the same anywhere on the path
+ * copies share the target path: a clone gets the primary's controller state with a plain assignment
+ */
+class VEHICLEADV3_API FPathTracker
+{
+public:
+
+	void SetSettings(const FPathTrackerSettings& newSettings);
+	const FPathTrackerSettings& GetSettings() const { return Settings; }
+
+	/** start following path (one sample per tick, with the velocity at each) from its first sample */
+	void Begin(const TArray<FTransform>& path, const TArray<FVector>& velocities);
+
+	void Reset();
+
+	/** following a path, and not past its end yet */
+	bool IsActive() const;
+
+	/**
+	 * move the cursor up to pose and compute inputs for the next tick
+	 * @param nominalThrottle feed-forward throttle (what the target run was driven with)
+	 */
+	FPathTrackerCommand Update(const FTransform& pose, const FVector& velocity, float deltaSeconds, float nominalThrottle);
+
+	int32 GetCursor() const { return Cursor; }
+
+	/** closest target sample to pose (searched around the cursor, which stays where it is)
+	 * @param outCrossTrackError distance from it (cm, + right of it) */
+	int32 FindClosest(const FTransform& pose, float& outCrossTrackError) const;
+
+private:
+
+	struct FPath
+	{
+		TArray<FVector> Locations;
+		TArray<float> Speeds;
+
+		/** distance along the path to each sample (cm) */
+		TArray<float> Distances;
+	};
+
+	FPathTrackerSettings Settings;
+	TSharedPtr<const FPath, ESPMode::ThreadSafe> Path;
+	int32 Cursor = 0;
+	int32 Lookahead = 0;
+	float SpeedIntegral = 0.f;
+};
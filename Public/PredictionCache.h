@@ -0,0 +1,153 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TrajectoryCodec.h"
+#include "PredictionCache.generated.h"
+
+/** bucket sizes used to decide that two vehicle states will produce the same prediction */
+USTRUCT(BlueprintType)
+struct VEHICLEADV3_API FPredictionCacheSettings
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, Category = PredictionCache)
+	bool bEnabled = true;
+
+	/** body-frame speed bucket in cm/s */
+	UPROPERTY(EditAnywhere, Category = PredictionCache, meta = (ClampMin = "1"))
+	float SpeedStep = 50.f;
+
+	/** yaw rate bucket in deg/s */
+	UPROPERTY(EditAnywhere, Category = PredictionCache, meta = (ClampMin = "0.01"))
+	float YawRateStep = 2.f;
+
+	/** engine rpm bucket */
+	UPROPERTY(EditAnywhere, Category = PredictionCache, meta = (ClampMin = "1"))
+	float RPMStep = 100.f;
+
+	/** throttle/steering input bucket */
+	UPROPERTY(EditAnywhere, Category = PredictionCache, meta = (ClampMin = "0.0001"))
+	float InputStep = 0.01f;
+
+	/** when following the target run: bucket of the closest target run sample (samples) and of the distance from it (cm) */
+	UPROPERTY(EditAnywhere, Category = PredictionCache, meta = (ClampMin = "1"))
+	int32 TrackerCursorStep = 15;
+
+	UPROPERTY(EditAnywhere, Category = PredictionCache, meta = (ClampMin = "1"))
+	float CrossTrackStep = 25.f;
+
+	/** max stored predictions (least recently used is evicted) */
+	UPROPERTY(EditAnywhere, Category = PredictionCache, meta = (ClampMin = "1"))
+	int32 Capacity = 64;
+
+	/** every Nth hit still does a real rollout to measure the cache's error (0 = never) */
+	UPROPERTY(EditAnywhere, Category = PredictionCache, meta = (ClampMin = "0"))
+	int32 ValidateEveryNthHit = 8;
+};
+
+/** quantized body-frame vehicle state, and where the car is on the target run when following it (INDEX_NONE otherwise) */
+struct VEHICLEADV3_API FPredictionCacheKey
+{
+	int32 ForwardSpeed;
+	int32 LateralSpeed;
+	int32 YawRate;
+	int32 Gear;
+	int32 RPM;
+	int32 Throttle;
+	int32 Steer;
+	int32 TrackerCursor;
+	int32 CrossTrackError;
+
+	bool operator==(const FPredictionCacheKey& other) const
+	{
+		return ForwardSpeed == other.ForwardSpeed && LateralSpeed == other.LateralSpeed && YawRate == other.YawRate
+			&& Gear == other.Gear && RPM == other.RPM && Throttle == other.Throttle && Steer == other.Steer
+			&& TrackerCursor == other.TrackerCursor && CrossTrackError == other.CrossTrackError;
+	}
+
+	friend uint32 GetTypeHash(const FPredictionCacheKey& key)
+	{
+		uint32 hash = GetTypeHash(key.ForwardSpeed);
+		hash = HashCombine(hash, GetTypeHash(key.LateralSpeed));
+		hash = HashCombine(hash, GetTypeHash(key.YawRate));
+		hash = HashCombine(hash, GetTypeHash(key.Gear));
+		hash = HashCombine(hash, GetTypeHash(key.RPM));
+		hash = HashCombine(hash, GetTypeHash(key.Throttle));
+		hash = HashCombine(hash, GetTypeHash(key.Steer));
+		hash = HashCombine(hash, GetTypeHash(key.TrackerCursor));
+		return HashCombine(hash, GetTypeHash(key.CrossTrackError));
+	}
+};
+
+/**
+ * cache of expected trajectories keyed by dynamic state
+ * trajectories are stored relative to the pose they started from, so a hit can be replayed from any pose
+ */
+class VEHICLEADV3_API FPredictionCache
+{
+public:
+
+	FPredictionCache();
+
+	void SetSettings(const FPredictionCacheSettings& newSettings);
+	const FPredictionCacheSettings& GetSettings() const { return Settings; }
+
+	/** quantize vehicle state into a cache key
+	 * @param linearVelocity world velocity in cm/s
+	 * @param angularVelocity world angular velocity in deg/s
+	 * @param trackerCursor closest target run sample when following it (a closed-loop rollout depends on it), INDEX_NONE if not
+	 * @param crossTrackError distance from that sample (cm, + right of it) */
+	FPredictionCacheKey MakeKey(const FTransform& pose, const FVector& linearVelocity, const FVector& angularVelocity, int32 gear, float rpm, float throttle, float steer,
+		int32 trackerCursor = INDEX_NONE, float crossTrackError = 0.f) const;
+
+	/** look up key and, on a hit, re-transform the stored run to start at currentPose
+	 * @return true on hit */
+	bool Find(const FPredictionCacheKey& key, const FTransform& currentPose, TArray<FTransform>& outPath, TArray<FVector>& outVelocities, TArray<float>& outRPMs, FTransform& outFinal, int32& outGear);
+
+	/** store a fresh rollout that started at startPose */
+	void Add(const FPredictionCacheKey& key, const FTransform& startPose, const TArray<FTransform>& path, const TArray<FVector>& velocities, const TArray<float>& rpms, const FTransform& finalTransform, int32 finalGear);
+
+	/** @returns true if this hit should be checked against a real rollout instead of used */
+	bool ShouldValidateHit() const;
+
+	/** record error of a cached prediction against a fresh rollout from the same state
+	 * @return max distance (cm) between the two paths */
+	float RecordValidation(const TArray<FTransform>& cachedPath, const TArray<FTransform>& freshPath);
+
+	void Empty();
+
+	/** metrics */
+	int32 GetHits() const { return Hits; }
+	int32 GetMisses() const { return Misses; }
+	float GetHitRate() const { return (Hits + Misses) > 0 ? float(Hits) / float(Hits + Misses) : 0.f; }
+	int32 GetNumValidations() const { return NumValidations; }
+	float GetMeanValidationError() const { return NumValidations > 0 ? SumValidationError / NumValidations : 0.f; }
+	float GetMaxValidationError() const { return MaxValidationError; }
+	int32 Num() const { return Entries.Num(); }
+	SIZE_T GetAllocatedSize() const;
+
+private:
+
+	struct FEntry
+	{
+		/** path, velocities and rpm in the frame of the start pose */
+		FCompressedTrajectory LocalRun;
+		FTransform LocalFinal;
+		int32 FinalGear;
+		uint64 LastUsed;
+	};
+
+	FPredictionCacheSettings Settings;
+	TMap<FPredictionCacheKey, FEntry> Entries;
+	uint64 UseCounter;
+
+	int32 Hits;
+	int32 Misses;
+	int32 NumValidations;
+	float SumValidationError;
+	float MaxValidationError;
+
+	void EvictLeastRecentlyUsed();
+};
@@ -0,0 +1,110 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PredictionScheduler.generated.h"
+
+/** limits for how far ahead and how often the vehicle predicts */
+USTRUCT(BlueprintType)
+struct VEHICLEADV3_API FPredictionSchedulerSettings
+{
+	GENERATED_BODY()
+
+	/** adapt horizon and interval at runtime (off: DefaultHorizon, predicting every 2 * DefaultHorizon seconds) */
+	UPROPERTY(EditAnywhere, Category = PredictionScheduler)
+	bool bAdaptive = true;
+
+	/** seconds simulated per prediction before anything has been observed */
+	UPROPERTY(EditAnywhere, Category = PredictionScheduler, meta = (ClampMin = "1"))
+	int32 DefaultHorizon = 5;
+
+	UPROPERTY(EditAnywhere, Category = PredictionScheduler, meta = (ClampMin = "1"))
+	int32 MinHorizon = 2;
+
+	UPROPERTY(EditAnywhere, Category = PredictionScheduler, meta = (ClampMin = "1"))
+	int32 MaxHorizon = 8;
+
+	/** seconds between predictions at highest risk */
+	UPROPERTY(EditAnywhere, Category = PredictionScheduler, meta = (ClampMin = "1"))
+	float MinInterval = 3.f;
+
+	/** seconds between predictions at lowest risk */
+	UPROPERTY(EditAnywhere, Category = PredictionScheduler, meta = (ClampMin = "1"))
+	float MaxInterval = 16.f;
+
+	/** average game-thread time per frame rollouts may add (ms), stretches the interval past MaxInterval if needed */
+	UPROPERTY(EditAnywhere, Category = PredictionScheduler, meta = (ClampMin = "0.01"))
+	float FrameBudgetMs = 2.f;
+
+	/** distance from the expected path (cm) that counts as full risk */
+	UPROPERTY(EditAnywhere, Category = PredictionScheduler, meta = (ClampMin = "1"))
+	float ErrorScale = 800.f;
+
+	/** speed (cm/s) that counts as half risk: faster cars cover more ground per second of horizon */
+	UPROPERTY(EditAnywhere, Category = PredictionScheduler, meta = (ClampMin = "1"))
+	float SpeedScale = 3000.f;
+
+	/** seconds risk stays at maximum after an error is triaged */
+	UPROPERTY(EditAnywhere, Category = PredictionScheduler, meta = (ClampMin = "0"))
+	float FaultHoldSeconds = 10.f;
+
+	/** weight of the newest sample in the running averages */
+	UPROPERTY(EditAnywhere, Category = PredictionScheduler, meta = (ClampMin = "0.01", ClampMax = "1"))
+	float Smoothing = 0.2f;
+};
+
+/**
+ * picks prediction horizon and interval from recent prediction error, speed and what rollouts cost per frame
+ * low risk (on the expected path, slow) gets long horizons predicted rarely; high risk (drifting, fast, just after a
+ * fault) gets short horizons predicted often; the interval never lets rollouts exceed the frame budget on average
+ */
+class VEHICLEADV3_API FPredictionScheduler
+{
+public:
+
+	FPredictionScheduler();
+
+	/** apply settings and go back to the default horizon */
+	void SetSettings(const FPredictionSchedulerSettings& settings);
+
+	/** distance from the expected path (cm) and speed (cm/s) at a compared tick */
+	void ObserveTick(float locationError, float speed);
+
+	/** an error was triaged at time now (seconds) */
+	void NotifyFault(double now);
+
+	/** average wall time of a frame over the last sample period, and whether a rollout was running during it */
+	void ObserveFrameTime(double seconds, bool bRolloutActive);
+
+	/** choose horizon and interval for the next predictions */
+	void Update(double now);
+
+	/** seconds to simulate per prediction */
+	int32 GetHorizon() const { return Horizon; }
+
+	/** seconds between predictions */
+	float GetInterval() const { return Interval; }
+
+	/** 0 (nothing going on) to 1 (just had a fault) */
+	float GetRisk() const { return Risk; }
+
+	/** extra frame time (seconds) while a rollout runs */
+	double GetRolloutFrameCost() const;
+
+private:
+
+	FPredictionSchedulerSettings Settings;
+
+	float ErrorAverage;
+	float SpeedAverage;
+	double LastFaultTime;
+
+	/** running averages of frame time without/with a rollout (< 0 until sampled) */
+	double IdleFrameSeconds;
+	double RolloutFrameSeconds;
+
+	int32 Horizon;
+	float Interval;
+	float Risk;
+};
@@ -0,0 +1,43 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
+#include "Containers/Ticker.h"
+
+class UWorld;
+
+/**
+ * hidden world with its own physics scene holding a static copy of a level's collision (static mesh actors, ramps and
+ * goals), for prediction, test and datagen clones to drive in without touching the level's actors or physics
+ * stepped once per frame (core ticker, outside the level's tick) with the level's delta time, so clone ticks still line
+ * up with the primary's
+ */
+class VEHICLEADV3_API FPredictionWorld
+{
+public:
+
+	/**
+	 * create world and copy source's collision into it
+	 * @param rampIgnoredChannel object channel ramp copies ignore (prediction clones drive through ramps)
+	 */
+	FPredictionWorld(UWorld* source, ECollisionChannel rampIgnoredChannel);
+
+	/** destroys the world and everything still in it */
+	~FPredictionWorld();
+
+	UWorld* GetWorld() const { return World; }
+
+	/** level collision actors copied over */
+	int32 GetNumCopiedActors() const { return NumCopiedActors; }
+
+private:
+
+	bool HandleTicker(float deltaTime);
+
+	TWeakObjectPtr<UWorld> Source;
+	UWorld* World;
+	FDelegateHandle TickerHandle;
+	int32 NumCopiedActors;
+};
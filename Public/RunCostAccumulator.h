@@ -0,0 +1,78 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** terms of a run's cost so far, same scale as the terms CalculateTotalRunCost used to compute at the goal */
+struct FRunCostTerms
+{
+	/** (target time at the matched target sample - run time)^2 */
+	float RunTime = 0.f;
+
+	/** directed Hausdorff (target samples driven past -> run) of squared xy distance, squared */
+	float Location = 0.f;
+
+	/** the same over heading (radians), squared */
+	float Rotation = 0.f;
+
+	float GetTotal() const { return RunTime + Location + Rotation; }
+};
+
+/**
+ * run cost kept up to date as the primary records samples, so it can be read at any time (runs that never reach the
+ * goal still get one) and nothing has to be walked at the goal
+ * each sample is compared to a window of target samples around a cursor that follows the car along the target run,
+ * and each target sample keeps its closest approach; samples that fall behind the window are folded into running
+ * maxima, so a sample costs O(window) and a query O(window) whatever the run length
+ */
+class VEHICLEADV3_API FRunCostAccumulator
+{
+public:
+
+	/** @param searchBehind/searchAhead: target samples either side of the cursor compared with each new sample */
+	FRunCostAccumulator(int32 searchBehind = 8, int32 searchAhead = 64);
+
+	/** start a run against target (its samples and run time), dropping anything accumulated */
+	void Begin(const TArray<FTransform>& targetPath, float targetRunTime);
+
+	/** forget the target run */
+	void Reset();
+
+	bool HasTarget() const { return Target.Num() > 0; }
+
+	/** add the run's next sample, recorded runSeconds into the run */
+	void AddSample(const FTransform& sample, float runSeconds);
+
+	/** @returns cost of the run so far (target samples the car hasn't got to yet don't count) */
+	FRunCostTerms GetCost() const;
+
+	/** every sample added since Begin, for order-aware metrics at the end of the run */
+	const TArray<FTransform>& GetRunPath() const { return RunPath; }
+	const TArray<FTransform>& GetTargetPath() const { return Target; }
+
+	/** index of the target sample the car is at */
+	int32 GetCursor() const { return Cursor; }
+
+private:
+
+	int32 SearchBehind;
+	int32 SearchAhead;
+
+	TArray<FTransform> Target;
+	float TargetRunTime = 0.f;
+	TArray<FTransform> RunPath;
+
+	/** per target sample: closest squared xy distance / heading difference of any run sample compared with it */
+	TArray<float> ClosestLocation;
+	TArray<float> ClosestRotation;
+
+	int32 Cursor = 0;
+
+	/** target samples below Folded can't be compared again, their maxima are in FoldedLocation/FoldedRotation */
+	int32 Folded = 0;
+	float FoldedLocation = 0.f;
+	float FoldedRotation = 0.f;
+
+	float LastRunSeconds = 0.f;
+};
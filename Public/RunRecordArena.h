@@ -0,0 +1,202 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SimulationData.h"
+#include "TestRunData.h"
+
+/**
+ * reference to a record in a TRunRecordPool
+ * a handle goes stale (Get returns nullptr) as soon as its slot is released, even if the slot is reused
+ */
+struct FRunRecordHandle
+{
+	int32 Index = INDEX_NONE;
+	uint32 Generation = 0;
+
+	bool IsSet() const { return Index != INDEX_NONE; }
+	void Invalidate() { Index = INDEX_NONE; }
+};
+
+/**
+ * fixed capacity pool of value records with generation-checked handles
+ * slots are allocated once up front, so records never move and memory stays flat
+ */
+template <typename RecordType>
+class TRunRecordPool
+{
+public:
+
+	explicit TRunRecordPool(int32 inCapacity)
+		: Capacity(FMath::Max(1, inCapacity))
+	{
+		Slots.Reserve(Capacity);
+	}
+
+	/** move record into a free slot
+	 * @return handle to record, unset if pool is full */
+	FRunRecordHandle Allocate(RecordType&& record)
+	{
+		int32 index = INDEX_NONE;
+		if (FreeList.Num() > 0)
+		{
+			index = FreeList.Pop(false);
+		}
+		else if (Slots.Num() < Capacity)
+		{
+			index = Slots.AddDefaulted();
+		}
+		else
+		{
+			return FRunRecordHandle();
+		}
+
+		FSlot& slot = Slots[index];
+		slot.Record = MoveTemp(record);
+		slot.bLive = true;
+
+		FRunRecordHandle handle;
+		handle.Index = index;
+		handle.Generation = slot.Generation;
+		return handle;
+	}
+
+	/** @returns record for handle, nullptr if handle is unset or stale */
+	RecordType* Get(const FRunRecordHandle& handle)
+	{
+		if (!Slots.IsValidIndex(handle.Index))
+		{
+			return nullptr;
+		}
+		FSlot& slot = Slots[handle.Index];
+		return (slot.bLive && slot.Generation == handle.Generation) ? &slot.Record : nullptr;
+	}
+
+	const RecordType* Get(const FRunRecordHandle& handle) const
+	{
+		return const_cast<TRunRecordPool*>(this)->Get(handle);
+	}
+
+	/** free record's memory and invalidate every handle to it */
+	void Release(FRunRecordHandle& handle)
+	{
+		if (Get(handle))
+		{
+			ReleaseSlot(handle.Index);
+		}
+		handle.Invalidate();
+	}
+
+	/** release every live record (e.g. at the start of a new diagnostic cycle) */
+	void ReleaseAll()
+	{
+		for (int32 i = 0; i < Slots.Num(); i++)
+		{
+			if (Slots[i].bLive)
+			{
+				ReleaseSlot(i);
+			}
+		}
+	}
+
+	int32 GetCapacity() const { return Capacity; }
+
+	int32 NumLive() const
+	{
+		int32 live = 0;
+		for (const FSlot& slot : Slots)
+		{
+			live += slot.bLive ? 1 : 0;
+		}
+		return live;
+	}
+
+	/** @returns total releases so far (sum of slot generations) */
+	uint32 GetTotalReleases() const
+	{
+		uint32 releases = 0;
+		for (const FSlot& slot : Slots)
+		{
+			releases += slot.Generation;
+		}
+		return releases;
+	}
+
+	/** @returns slot storage plus heap memory held by live records */
+	SIZE_T GetAllocatedSize() const
+	{
+		SIZE_T size = Slots.GetAllocatedSize() + FreeList.GetAllocatedSize();
+		for (const FSlot& slot : Slots)
+		{
+			if (slot.bLive)
+			{
+				size += slot.Record.GetAllocatedSize();
+			}
+		}
+		return size;
+	}
+
+private:
+
+	struct FSlot
+	{
+		RecordType Record;
+		uint32 Generation = 0;
+		bool bLive = false;
+	};
+
+	void ReleaseSlot(int32 index)
+	{
+		FSlot& slot = Slots[index];
+		slot.Record = RecordType();
+		slot.bLive = false;
+		slot.Generation++;
+		FreeList.Add(index);
+	}
+
+	TArray<FSlot> Slots;
+	TArray<int32> FreeList;
+	int32 Capacity;
+};
+
+/** snapshot of how much memory a vehicle's run records use */
+struct FRunRecordMemoryReport
+{
+	int32 LiveSimulations = 0;
+	int32 SimulationCapacity = 0;
+	SIZE_T SimulationBytes = 0;
+
+	int32 LiveTestRuns = 0;
+	int32 TestRunCapacity = 0;
+	SIZE_T TestRunBytes = 0;
+
+	/** records released so far (each release bumped a slot generation) */
+	uint32 Releases = 0;
+
+	/** per-tick recording buffers (PathLocations etc.) */
+	SIZE_T RecordingBytes = 0;
+
+	/** cached predictions */
+	SIZE_T PredictionCacheBytes = 0;
+
+	SIZE_T GetTotalBytes() const { return SimulationBytes + TestRunBytes + RecordingBytes + PredictionCacheBytes; }
+};
+
+/** per-vehicle storage for simulation and test run records */
+struct FRunRecordArena
+{
+	/** target run, current expected future and room for one being built/validated */
+	static const int32 SIMULATION_CAPACITY = 4;
+	/** one diagnostic cycle's candidates */
+	static const int32 TEST_RUN_CAPACITY = 8;
+
+	TRunRecordPool<FSimulationData> Simulations;
+	TRunRecordPool<FTestRunData> TestRuns;
+
+	FRunRecordArena()
+		: Simulations(SIMULATION_CAPACITY)
+		, TestRuns(TEST_RUN_CAPACITY)
+	{
+	}
+};
@@ -0,0 +1,115 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+// layout of recorded run files (Saved/Runs/*.run), kept free of engine types so tools outside the editor can read them
+// file = FRunFileHeader, then NumFrames * FRunFrame, NumEvents * FRunEvent and EventDataSize bytes of event data,
+// little endian, no padding between records
+
+#include <cstdint>
+
+namespace RunFile
+{
+	/** 'VRUN' */
+	static const uint32_t MAGIC = 0x4E555256;
+	/** bump whenever FRunFileHeader or FRunFrame change */
+	static const uint32_t VERSION = 3;
+
+	/** FRunFrame::Flags: input-side state that changes how the car drives */
+	enum EFrameFlags : uint8_t
+	{
+		FRAME_DRIFT = 1 << 0,			// steering drift bias applied
+		FRAME_LOW_FRICTION = 1 << 1,	// slippery physical material override
+		FRAME_EXPECTED = 1 << 2,		// Expected* fields hold the prediction sample compared this tick
+		FRAME_SHADOW_ROLLOUT = 1 << 3,	// a prediction was being built while this tick ran
+	};
+
+	/** FRunEvent::Type: things done to the car between ticks, outside of its inputs */
+	enum EEventType : uint8_t
+	{
+		EVENT_FREEZE = 1,	// stopped ticking and simulating (frozen prediction, target, diagnostic or datagen run)
+		EVENT_RESUME = 2,	// simulating again, with the event data's vehicle state restored onto it
+	};
+
+	/** FRunFrame::Errors: what error detection reported this tick */
+	enum EErrorFlags : uint8_t
+	{
+		ERROR_CAMERA = 1 << 0,
+		ERROR_ROTATION = 1 << 1,
+		ERROR_RPM = 1 << 2,
+		ERROR_LOCATION = 1 << 3,
+	};
+
+#pragma pack(push, 4)
+	struct FRunFileHeader
+	{
+		uint32_t Magic;
+		uint32_t Version;
+		/** sizeof(FRunFrame) when written */
+		uint32_t FrameSize;
+		uint32_t NumFrames;
+		uint64_t SessionSeed;
+		/** fixed timestep the run was recorded with (0 = variable, replay uses the recorded per-frame delta) */
+		float FixedDeltaSeconds;
+		/** target run the car was compared against */
+		uint32_t TargetRunCacheKey;
+		float StartLocation[3];
+		float StartRotation[4];
+		uint32_t NumEvents;
+		uint32_t EventDataSize;
+	};
+
+	/** one tick of the actual car (cm, cm/s, quaternion xyzw, rpm) */
+	struct FRunFrame
+	{
+		float DeltaSeconds;
+
+		/** inputs as applied this tick */
+		float Throttle;
+		float Steer;
+		float DragCoefficient;
+		uint8_t Flags;
+		uint8_t Errors;
+		uint16_t Reserved;
+
+		/** state at the start of the tick (before this tick's inputs act) */
+		float Location[3];
+		float Rotation[4];
+		float Velocity[3];
+		float RPM;
+
+		/** prediction sample compared this tick (valid with FRAME_EXPECTED) */
+		int32_t ExpectedTick;
+		float ExpectedLocation[3];
+		float ExpectedRotation[4];
+		float ExpectedRPM;
+
+		/** start and final location of the prediction being compared (what triage draws its lines between) */
+		float PredictionStart[3];
+		float PredictionEnd[3];
+	};
+
+	/** something that happened to the car before frame Frame's tick (the frame count so far when it happened) */
+	struct FRunEvent
+	{
+		uint32_t Frame;
+		uint8_t Type;
+		uint8_t Reserved[3];
+		/** game time of the event */
+		float WorldSeconds;
+		/** vehicle state (FVehicleStateSnapshot::Serialize) in the event data, size 0 if none */
+		uint32_t DataOffset;
+		uint32_t DataSize;
+	};
+#pragma pack(pop)
+
+	static_assert(sizeof(FRunFileHeader) == 68, "run file header layout changed, bump VERSION");
+	static_assert(sizeof(FRunFrame) == 124, "run frame layout changed, bump VERSION");
+	static_assert(sizeof(FRunEvent) == 20, "run event layout changed, bump VERSION");
+
+	/** @returns size of a file with this header */
+	inline uint64_t GetFileSize(const FRunFileHeader& header)
+	{
+		return sizeof(FRunFileHeader) + uint64_t(header.NumFrames) * sizeof(FRunFrame) + uint64_t(header.NumEvents) * sizeof(FRunEvent) + header.EventDataSize;
+	}
+}
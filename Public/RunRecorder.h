@@ -0,0 +1,112 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RunRecordFormat.h"
+#include "VehicleStateSnapshot.h"
+
+/**
+ * records the actual car's per-tick inputs, fault toggles, state and compared prediction samples (-RecordRun=<file>)
+ * plus freezes and state restores between ticks, so a replay goes through the same discontinuities
+ * frames are kept in memory and written in one go (~124 bytes per tick, a 10 minute run at 60 Hz is ~4.5 MB)
+ */
+class VEHICLEADV3_API FRunRecorder
+{
+public:
+
+	/** start a new recording, filename relative to Saved/Runs unless absolute */
+	void Begin(const FString& filename, const RunFile::FRunFileHeader& header);
+
+	bool IsRecording() const { return bRecording; }
+
+	void AddFrame(const RunFile::FRunFrame& frame);
+
+	/** car stopped ticking and simulating after the last frame */
+	void AddFreeze(float worldSeconds);
+
+	/** car simulates again, restored to state */
+	void AddResume(float worldSeconds, const FVehicleStateSnapshot& state);
+
+	/** write everything recorded so far (recording continues)
+	 * @return true if file was written */
+	bool Save();
+
+	/** write file and stop recording */
+	void End();
+
+	int32 NumFrames() const { return Frames.Num(); }
+
+	const FString& GetFilename() const { return Filename; }
+
+	/** @returns full path for a run file name given on the command line */
+	static FString ResolveFilename(const FString& filename);
+
+private:
+
+	FString Filename;
+	RunFile::FRunFileHeader Header;
+	TArray<RunFile::FRunFrame> Frames;
+	TArray<RunFile::FRunEvent> Events;
+	TArray<uint8> EventData;
+	bool bRecording = false;
+
+	void AddEvent(uint8 type, float worldSeconds, const FVehicleStateSnapshot* state);
+};
+
+/**
+ * recorded run being re-driven (-ReplayRun=<file>) and how far the replay has drifted from it
+ */
+class VEHICLEADV3_API FRunReplay
+{
+public:
+
+	/** read and validate run file
+	 * @return true if file was loaded */
+	bool Load(const FString& filename);
+
+	bool IsLoaded() const { return Frames.Num() > 0; }
+
+	const RunFile::FRunFileHeader& GetHeader() const { return Header; }
+
+	int32 Num() const { return Frames.Num(); }
+
+	const RunFile::FRunFrame& GetFrame(int32 index) const { return Frames[index]; }
+
+	int32 NumEvents() const { return Events.Num(); }
+
+	const RunFile::FRunEvent& GetEvent(int32 index) const { return Events[index]; }
+
+	/** read the vehicle state stored with an event
+	 * @return false if the event has none */
+	bool GetEventState(int32 index, FVehicleStateSnapshot& outState) const;
+
+	/** compare replayed state to recorded frame, frames further off than tolerance (cm) count as diverged
+	 * @return location error in cm */
+	float CheckDivergence(int32 index, const FTransform& transform, float rpm, float tolerance);
+
+	float GetMaxLocationError() const { return MaxLocationError; }
+	float GetMaxRotationError() const { return MaxRotationError; }
+	float GetMaxRPMError() const { return MaxRPMError; }
+
+	/** @returns first frame further off than tolerance, INDEX_NONE if replay matched */
+	int32 GetFirstDivergentFrame() const { return FirstDivergentFrame; }
+
+	/** helpers to move between engine types and the file's plain arrays */
+	static FVector ToVector(const float v[3]) { return FVector(v[0], v[1], v[2]); }
+	static FQuat ToQuat(const float q[4]) { return FQuat(q[0], q[1], q[2], q[3]); }
+	static void FromVector(const FVector& in, float out[3]) { out[0] = in.X; out[1] = in.Y; out[2] = in.Z; }
+	static void FromQuat(const FQuat& in, float out[4]) { out[0] = in.X; out[1] = in.Y; out[2] = in.Z; out[3] = in.W; }
+
+private:
+
+	RunFile::FRunFileHeader Header;
+	TArray<RunFile::FRunFrame> Frames;
+	TArray<RunFile::FRunEvent> Events;
+	TArray<uint8> EventData;
+
+	float MaxLocationError = 0.f;
+	float MaxRotationError = 0.f;
+	float MaxRPMError = 0.f;
+	int32 FirstDivergentFrame = INDEX_NONE;
+};
@@ -0,0 +1,49 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * repeated timing of named pipeline stages (-RunBenchmarks, compare results with Tools/bench_compare.py)
+ * every case also reports its outputs, which are hashed into a golden checksum so a speedup that changes
+ * results shows up as a checksum mismatch against the baseline
+ */
+class VEHICLEADV3_API FSimulationBenchmark
+{
+public:
+
+	/** bump whenever the results file layout or the golden inputs change (baselines are then re-recorded) */
+	static const int32 SCHEMA = 3;
+
+	/** add case, body runs it once and appends the values it computed to outputs */
+	void AddCase(const FString& name, TFunction<void(TArray<float>& outputs)> body);
+
+	/** time every case (warmup runs are discarded) */
+	void Run(int32 repetitions, int32 warmup);
+
+	/** write results as json, filename relative to Saved/Benchmarks unless absolute
+	  * @return true if file was written */
+	bool Write(const FString& filename, const FString& label) const;
+
+	/** @returns hash of every case's outputs */
+	uint32 GetChecksum() const;
+
+	/** mean/min per case to the log */
+	void LogSummary() const;
+
+private:
+
+	struct FCase
+	{
+		FString Name;
+		TFunction<void(TArray<float>&)> Body;
+		/** seconds per repetition */
+		TArray<double> Samples;
+		uint32 Checksum = 0;
+		/** outputs differed between repetitions */
+		bool bNondeterministic = false;
+	};
+
+	TArray<FCase> Cases;
+};
@@ -0,0 +1,157 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+
+class FTcpListener;
+class FSocket;
+struct FIPv4Endpoint;
+
+/** names of the metrics the vehicles report (help text and type are registered in SimulationMetrics.cpp) */
+namespace SimulationMetric
+{
+	static const TCHAR* const PredictionSeconds = TEXT("vehicle_prediction_seconds");
+	static const TCHAR* const PredictionsTotal = TEXT("vehicle_predictions_total");
+	static const TCHAR* const FrozenSeconds = TEXT("vehicle_frozen_seconds");
+	static const TCHAR* const DiagnosticCycleSeconds = TEXT("vehicle_diagnostic_cycle_seconds");
+	static const TCHAR* const TriageTotal = TEXT("vehicle_triage_total");
+	static const TCHAR* const TickComparisonSeconds = TEXT("vehicle_tick_comparison_seconds");
+	static const TCHAR* const LiveClones = TEXT("vehicle_live_clones");
+	static const TCHAR* const TrajectoryBytes = TEXT("vehicle_trajectory_bytes");
+	static const TCHAR* const RunCost = TEXT("vehicle_run_cost");
+	static const TCHAR* const RunSeconds = TEXT("vehicle_run_seconds");
+	static const TCHAR* const RunsTotal = TEXT("vehicle_runs_total");
+	static const TCHAR* const PartialRunCost = TEXT("vehicle_partial_run_cost");
+	static const TCHAR* const PredictionHorizon = TEXT("vehicle_prediction_horizon_seconds");
+	static const TCHAR* const PredictionInterval = TEXT("vehicle_prediction_interval_seconds");
+	static const TCHAR* const PredictionRisk = TEXT("vehicle_prediction_risk");
+	static const TCHAR* const RolloutFrameCost = TEXT("vehicle_rollout_frame_cost_seconds");
+	static const TCHAR* const AnalyticPredictionError = TEXT("vehicle_analytic_prediction_error");
+}
+
+/**
+ * log-linear latency histogram (HDR style): 16 linear sub-buckets per power of two of microseconds,
+ * so any recorded value is within ~6% of its bucket bound from 1 us to ~12 days with a fixed 5 KB of counts
+ */
+class VEHICLEADV3_API FLatencyHistogram
+{
+public:
+
+	static const int32 SUB_BUCKETS = 16;
+	static const int32 NUM_BUCKETS = 38 * SUB_BUCKETS;
+
+	FLatencyHistogram();
+
+	void Record(double seconds);
+
+	uint64 GetCount() const { return Count; }
+	double GetSum() const { return Sum; }
+
+	/** @returns upper bound (seconds) of the bucket holding quantile q (0..1) */
+	double GetQuantile(double q) const;
+
+	/** @returns bucket for a value in microseconds */
+	static int32 GetBucket(uint64 micros);
+
+	/** @returns exclusive upper bound of bucket in seconds */
+	static double GetBucketUpperBound(int32 bucket);
+
+	uint64 GetBucketCount(int32 bucket) const { return Counts[bucket]; }
+
+private:
+
+	uint64 Counts[NUM_BUCKETS];
+	uint64 Count;
+	double Sum;
+};
+
+/**
+ * process-wide counters, gauges and latency histograms
+ * exported as Prometheus text on http://127.0.0.1:<-MetricsPort=>/metrics and/or written to -MetricsFile= every
+ * -MetricsInterval= seconds (default 10), so fleets of headless runs can be scraped or collected afterwards
+ * updates come from the game thread and ParallelFor workers, exports from the listener thread: everything takes Lock
+ */
+class VEHICLEADV3_API FSimulationMetrics
+{
+public:
+
+	static FSimulationMetrics& Get();
+
+	~FSimulationMetrics();
+
+	void Increment(const TCHAR* name, const FString& labels = FString(), double amount = 1.0);
+	void SetGauge(const TCHAR* name, double value, const FString& labels = FString());
+	void AddGauge(const TCHAR* name, double delta, const FString& labels = FString());
+	void Observe(const TCHAR* name, double seconds);
+
+	/** start endpoint/file export if asked for on the command line (safe to call more than once) */
+	void StartExport();
+
+	/** stop endpoint and ticker, write file a last time */
+	void StopExport();
+
+	/** @returns everything in Prometheus text exposition format */
+	FString Render() const;
+
+	/** write Render() to the metrics file (if one is set)
+	  * @return true if file was written */
+	bool WriteFile() const;
+
+private:
+
+	enum class EMetricType : uint8
+	{
+		Counter,
+		Gauge,
+		Histogram
+	};
+
+	struct FMetricFamily
+	{
+		EMetricType Type;
+		FString Help;
+		/** labels ("error=\"rpm\"") -> value, for counters and gauges */
+		TMap<FString, double> Values;
+		/** histograms are unlabelled */
+		FLatencyHistogram Histogram;
+	};
+
+	FSimulationMetrics();
+
+	void Describe(const TCHAR* name, EMetricType type, const TCHAR* help);
+
+	bool HandleConnection(FSocket* socket, const FIPv4Endpoint& endpoint);
+
+	bool HandleTicker(float deltaTime);
+
+	mutable FCriticalSection Lock;
+	TMap<FString, FMetricFamily> Families;
+
+	FTcpListener* Listener = nullptr;
+	FDelegateHandle TickerHandle;
+	FString Filename;
+};
+
+/** observe wall time of a scope into a histogram */
+class FScopedMetricTimer
+{
+public:
+
+	explicit FScopedMetricTimer(const TCHAR* inName)
+		: Name(inName)
+		, StartCycles(FPlatformTime::Cycles64())
+	{
+	}
+
+	~FScopedMetricTimer()
+	{
+		FSimulationMetrics::Get().Observe(Name, FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles));
+	}
+
+private:
+
+	const TCHAR* Name;
+	uint64 StartCycles;
+};
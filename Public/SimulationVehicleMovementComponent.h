@@ -0,0 +1,28 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "WheeledVehicleMovementComponent4W.h"
+#include "SimulationVehicleMovementComponent.generated.h"
+
+/**
+ * 4W movement that can take its inputs straight from SetThrottleInput/SetSteeringInput without being possessed
+ * (the stock component only applies them for a locally controlled pawn, otherwise it uses the replicated state)
+ * clones are driven this way, so the player controller never leaves the primary
+ */
+UCLASS()
+class VEHICLEADV3_API USimulationVehicleMovementComponent : public UWheeledVehicleMovementComponent4W
+{
+	GENERATED_BODY()
+
+public:
+
+	/** apply raw inputs whether or not there is a (local) controller */
+	UPROPERTY(Transient)
+	bool bDriveWithoutController = false;
+
+protected:
+
+	virtual void UpdateState(float DeltaTime) override;
+};
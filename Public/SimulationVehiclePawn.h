@@ -0,0 +1,23 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VehicleAdv3Pawn.h"
+#include "SimulationVehiclePawn.generated.h"
+
+/**
+ * physics-only vehicle for prediction, diagnostic and datagen runs
+ * same mesh, physics asset and UWheeledVehicleMovementComponent4W setup as the primary, but no cameras, in-car HUD,
+ * engine sound or animation blueprint, and hidden (no render proxies), so a clone costs its physics and nothing else
+ * spawn with AVehicleAdv3Pawn::SpawnSimulationVehicle, which sets the role before BeginPlay
+ */
+UCLASS(NotBlueprintable)
+class VEHICLEADV3_API ASimulationVehiclePawn : public AVehicleAdv3Pawn
+{
+	GENERATED_BODY()
+
+public:
+
+	ASimulationVehiclePawn(const FObjectInitializer& ObjectInitializer);
+};
@@ -0,0 +1,35 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FSimulationData;
+class UWheeledVehicleMovementComponent4W;
+
+/**
+ * on-disk cache of target runs (Saved/TargetRunCache/<key>.bin)
+ * a target run only depends on the level, where the car starts and how the car is set up,
+ * so the key is a hash of exactly those and a cached run can replace driving the target car
+ */
+class VEHICLEADV3_API FTargetRunCache
+{
+public:
+
+	/** bump whenever the file layout or anything that changes the target run (e.g. target car logic) changes */
+	static const uint32 VERSION = 2;
+
+	/** @returns hash of level name, start transform and vehicle movement parameters */
+	static uint32 ComputeKey(const UWorld* world, const FTransform& start, const UWheeledVehicleMovementComponent4W* movement);
+
+	/** map cached file for key and load it into outData
+	  * @return true if a valid (matching magic, version and key) cache entry was loaded */
+	static bool Load(uint32 key, FSimulationData& outData);
+
+	/** write run to cache file for key
+	  * @return true if file was written */
+	static bool Save(uint32 key, const FSimulationData& data);
+
+	/** @returns full path of cache file for key */
+	static FString GetCacheFilename(uint32 key);
+};
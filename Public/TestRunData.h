@@ -3,18 +3,14 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "UObject/NoExportTypes.h"
-#include "TestRunData.generated.h"
 
 /**
- * TODO better describe class
  * store data from test run used to calculate cost and make adjustment
+ * (value type, lives in the owning vehicle's FRunRecordArena)
  */
-UCLASS()
-class VEHICLEADV3_API UTestRunData : public UObject
+struct VEHICLEADV3_API FTestRunData
 {
-	GENERATED_BODY()
-
+private:
 	float steeringChange;
 	float throttleChange;
 	FTransform finalTransform;
@@ -23,26 +19,25 @@ class VEHICLEADV3_API UTestRunData : public UObject
 public:
 	bool hitgoal;
 
-	UTestRunData();
-	static UTestRunData* MAKE(float steering, float throttle);
-	static UTestRunData* MAKE(float steering, float throttle, FVector & end);
-
-	~UTestRunData();
+	FTestRunData();
 
 	void Initialize(float steering, float throttle);
 
-	void Initialize(float steering, float throttle, FTransform & finalTransform, float finialRPM);
+	void Initialize(float steering, float throttle, const FTransform& finalTransform, float finalRPM);
 
 	/** @returns steering change */
-	float GetSteeringChange();
+	float GetSteeringChange() const;
 
 	/** @returns throttle change */
-	float GetThrottleChange();
+	float GetThrottleChange() const;
 
 	/** @returns final transform */
-	FTransform GetFinalTransform();
+	FTransform GetFinalTransform() const;
 
 	/** @returns final rpm */
-	float GetFinalRPM();
+	float GetFinalRPM() const;
+
+	/** @returns heap bytes held (none, kept for FRunRecordArena reporting) */
+	SIZE_T GetAllocatedSize() const { return 0; }
 
 };
@@ -0,0 +1,129 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TrajectoryCodec.generated.h"
+
+/**
+ * precision/size trade-off for FCompressedTrajectory
+ * worst case error per axis is half of the matching quantum
+ */
+USTRUCT(BlueprintType)
+struct VEHICLEADV3_API FTrajectoryCodecSettings
+{
+	GENERATED_BODY()
+
+	/** samples per block (position, velocity and rpm are packed relative to the block's smallest value) */
+	UPROPERTY(EditAnywhere, Category = Compression, meta = (ClampMin = "1", ClampMax = "256"))
+	int32 KeyframeInterval = 32;
+
+	/** position step in cm */
+	UPROPERTY(EditAnywhere, Category = Compression, meta = (ClampMin = "0.01"))
+	float PositionQuantum = 0.5f;
+
+	/** velocity step in cm/s */
+	UPROPERTY(EditAnywhere, Category = Compression, meta = (ClampMin = "0.01"))
+	float VelocityQuantum = 2.f;
+
+	/** engine rpm step */
+	UPROPERTY(EditAnywhere, Category = Compression, meta = (ClampMin = "0.01"))
+	float RPMQuantum = 2.f;
+};
+
+/**
+ * compact storage for a recorded/simulated run (transform, velocity and rpm per tick)
+ * - position, velocity and rpm components: per block, steps of the matching quantum above the block's smallest value,
+ *   bit packed at the width the block's span needs (a straight or slow block costs a few bits, a gear change a few more)
+ * - rotations: smallest-three quaternion packed in 32 bits (~0.0015 rad max error)
+ * - scale is dropped (always 1 for vehicles)
+ * a component whose span in a block doesn't fit MAX_COMPONENT_BITS steps (or isn't finite) is stored raw for that
+ * block only, the other components keep their packing, so error stays bounded
+ * ~10-13 bytes per sample vs 64 for FTransform + FVector + float; any sample decodes in O(1)
+ */
+class VEHICLEADV3_API FCompressedTrajectory
+{
+public:
+
+	FCompressedTrajectory();
+
+	/** replace contents with the given samples (arrays may differ in length, shortest wins) */
+	void Encode(const TArray<FTransform>& path, const TArray<FVector>& velocities, const TArray<float>& rpms, const FTrajectoryCodecSettings& settings = FTrajectoryCodecSettings());
+
+	/** remove all samples */
+	void Empty();
+
+	/** @returns number of stored samples */
+	int32 Num() const { return NumSamples; }
+
+	bool IsValidIndex(int32 index) const { return index >= 0 && index < NumSamples; }
+
+	/** O(1) decode of a single sample */
+	FVector GetLocation(int32 index) const;
+	FQuat GetRotation(int32 index) const;
+	FTransform GetTransform(int32 index) const;
+	FVector GetVelocity(int32 index) const;
+	float GetRPM(int32 index) const;
+
+	/** decode every sample (only for whole-run processing, e.g. cost at goal) */
+	void DecodePath(TArray<FTransform>& outPath) const;
+	void DecodeVelocities(TArray<FVector>& outVelocities) const;
+	void DecodeRPMs(TArray<float>& outRPMs) const;
+
+	/** @returns bytes held by this trajectory */
+	SIZE_T GetAllocatedSize() const;
+
+	const FTrajectoryCodecSettings& GetSettings() const { return Settings; }
+
+	/** binary (de)serialization, e.g. for the on-disk target run cache */
+	friend VEHICLEADV3_API FArchive& operator<<(FArchive& Ar, FCompressedTrajectory& trajectory);
+
+	/** write side of operator<<, for saving from a const trajectory */
+	void Save(FArchive& Ar) const;
+
+	/** smallest-three quaternion packing (2 bit index of dropped component + 3 x 10 bits) */
+	static uint32 PackRotation(const FQuat& rotation);
+	static FQuat UnpackRotation(uint32 packed);
+
+private:
+
+	/** location xyz, velocity xyz, rpm */
+	static const int32 NUM_COMPONENTS = 7;
+	static const uint8 MAX_COMPONENT_BITS = 24;
+	static const uint8 RAW_COMPONENT = 0xff;
+	/** PackedSteps is padded so a read of up to MAX_COMPONENT_BITS never runs off the end */
+	static const int32 PACKED_PADDING = 3;
+
+	/** per block of KeyframeInterval samples */
+	struct FBlock
+	{
+		/** smallest value of each component in the block */
+		float Base[NUM_COMPONENTS];
+		/** bits per step count of each component, RAW_COMPONENT if it is in RawValues */
+		uint8 Bits[NUM_COMPONENTS];
+		/** first bit of the block in PackedSteps (samples one after another, packed components in order) */
+		int32 BitOffset;
+		/** first value of the block in RawValues (raw components one after another, all samples of each) */
+		int32 RawOffset;
+
+		friend FArchive& operator<<(FArchive& Ar, FBlock& block)
+		{
+			for (int32 c = 0; c < NUM_COMPONENTS; c++)
+			{
+				Ar << block.Base[c] << block.Bits[c];
+			}
+			return Ar << block.BitOffset << block.RawOffset;
+		}
+	};
+
+	FTrajectoryCodecSettings Settings;
+	int32 NumSamples;
+
+	TArray<FBlock> Blocks;
+	TArray<uint8> PackedSteps;
+	TArray<uint32> PackedRotations;
+	TArray<float> RawValues;
+
+	float GetQuantum(int32 component) const;
+	float DecodeComponent(int32 index, int32 component) const;
+};
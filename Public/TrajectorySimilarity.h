@@ -0,0 +1,119 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TrajectorySimilarity.generated.h"
+
+/** which order-aware metrics score a run against the target run, and how wide their warping band is */
+USTRUCT(BlueprintType)
+struct VEHICLEADV3_API FTrajectorySimilaritySettings
+{
+	GENERATED_BODY()
+
+	/** banded dynamic time warping (mean per-step distance along the best alignment) */
+	UPROPERTY(EditAnywhere, Category = RunCost)
+	bool bUseDTW = true;
+
+	UPROPERTY(EditAnywhere, Category = RunCost, meta = (ClampMin = "0"))
+	float DTWWeight = 1.f;
+
+	/** discrete Frechet distance (worst distance along the best alignment) */
+	UPROPERTY(EditAnywhere, Category = RunCost)
+	bool bUseFrechet = true;
+
+	UPROPERTY(EditAnywhere, Category = RunCost, meta = (ClampMin = "0"))
+	float FrechetWeight = 1.f;
+
+	/** half width of the warping band as a fraction of the longer run */
+	UPROPERTY(EditAnywhere, Category = RunCost, meta = (ClampMin = "0", ClampMax = "1"))
+	float BandFraction = 0.1f;
+
+	/** band half width limits in samples (the band is always widened enough to join both run ends) */
+	UPROPERTY(EditAnywhere, Category = RunCost, meta = (ClampMin = "1"))
+	int32 MinBand = 8;
+
+	UPROPERTY(EditAnywhere, Category = RunCost, meta = (ClampMin = "1"))
+	int32 MaxBand = 512;
+
+	/** cm of position error equivalent to one radian of heading error */
+	UPROPERTY(EditAnywhere, Category = RunCost, meta = (ClampMin = "0"))
+	float RotationWeight = 100.f;
+};
+
+/** a distance between two runs, evaluated by FTrajectorySimilarity */
+class VEHICLEADV3_API ITrajectoryMetric
+{
+public:
+
+	virtual ~ITrajectoryMetric() {}
+
+	/** name used in logs */
+	virtual const TCHAR* GetName() const = 0;
+
+	/** @returns distance between runs a and b (0 if either is empty), may be called from any thread */
+	virtual float Evaluate(const TArray<FTransform>& a, const TArray<FTransform>& b, const FTrajectorySimilaritySettings& settings) const = 0;
+};
+
+/** Sakoe-Chiba banded dynamic time warping, O(n*w) time and O(w) memory */
+class VEHICLEADV3_API FBandedDTWMetric : public ITrajectoryMetric
+{
+public:
+	virtual const TCHAR* GetName() const override { return TEXT("DTW"); }
+	virtual float Evaluate(const TArray<FTransform>& a, const TArray<FTransform>& b, const FTrajectorySimilaritySettings& settings) const override;
+};
+
+/** discrete Frechet distance restricted to the same band as FBandedDTWMetric */
+class VEHICLEADV3_API FDiscreteFrechetMetric : public ITrajectoryMetric
+{
+public:
+	virtual const TCHAR* GetName() const override { return TEXT("Frechet"); }
+	virtual float Evaluate(const TArray<FTransform>& a, const TArray<FTransform>& b, const FTrajectorySimilaritySettings& settings) const override;
+};
+
+struct FTrajectoryMetricResult
+{
+	const TCHAR* Name;
+	float Value;
+	float Weight;
+};
+
+/**
+ * set of weighted trajectory metrics evaluated in parallel (one task per metric)
+ * unlike Hausdorff these respect the order of samples, so a run that loops or takes the right line late scores worse
+ */
+class VEHICLEADV3_API FTrajectorySimilarity
+{
+public:
+
+	FTrajectorySimilarity();
+
+	/** apply settings and rebuild the built-in metrics (metrics added with AddMetric are kept) */
+	void SetSettings(const FTrajectorySimilaritySettings& newSettings);
+	const FTrajectorySimilaritySettings& GetSettings() const { return Settings; }
+
+	/** plug in another metric */
+	void AddMetric(const TSharedRef<ITrajectoryMetric, ESPMode::ThreadSafe>& metric, float weight);
+
+	/** evaluate every metric on a and b
+	 * @param outResults one result per metric, in the order metrics were added */
+	void Evaluate(const TArray<FTransform>& a, const TArray<FTransform>& b, TArray<FTrajectoryMetricResult>& outResults) const;
+
+	/** @returns half width of the warping band for runs of length n and m */
+	static int32 GetBandWidth(int32 n, int32 m, const FTrajectorySimilaritySettings& settings);
+
+	/** @returns distance between two samples (position in cm plus weighted heading difference) */
+	static float SampleDistance(const FTransform& a, const FTransform& b, float rotationWeight);
+
+private:
+
+	struct FWeightedMetric
+	{
+		TSharedRef<ITrajectoryMetric, ESPMode::ThreadSafe> Metric;
+		float Weight;
+		bool bBuiltIn;
+	};
+
+	FTrajectorySimilaritySettings Settings;
+	TArray<FWeightedMetric> Metrics;
+};
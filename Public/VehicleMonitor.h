@@ -0,0 +1,84 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineBaseTypes.h"
+#include "VehicleMonitor.generated.h"
+
+class AVehicleAdv3Pawn;
+
+/** how often and where the primary's error monitoring runs */
+USTRUCT(BlueprintType)
+struct VEHICLEADV3_API FVehicleMonitorSettings
+{
+	GENERATED_BODY()
+
+	/** monitoring steps per second, whatever the frame rate (-MonitorHz= overrides) */
+	UPROPERTY(EditAnywhere, Category = Monitoring, meta = (ClampMin = "1", ClampMax = "240"))
+	float Frequency = 50.f;
+
+	/** steps a slow frame may catch up on, time owed beyond that is dropped */
+	UPROPERTY(EditAnywhere, Category = Monitoring, meta = (ClampMin = "1"))
+	int32 MaxCatchUpSteps = 4;
+
+	/** run comparisons on a task graph worker, results are applied on the game thread (-MonitorOnWorker turns it on) */
+	UPROPERTY(EditAnywhere, Category = Monitoring)
+	bool bRunOnWorkerThread = false;
+
+	/** expected ticks between camera (landmark) checks */
+	UPROPERTY(EditAnywhere, Category = Monitoring, meta = (ClampMin = "1"))
+	int32 CameraCheckTicks = 400;
+};
+
+/** primary's state as sampled in its actor tick, with the expected state at the same tick */
+struct FVehicleMonitorSample
+{
+	FTransform Transform;
+	float RPM;
+	float ForwardSpeed;
+
+	/** index in the expected future (INDEX_NONE if nothing to compare with) */
+	int32 Tick;
+	FTransform Expected;
+	float ExpectedRPM;
+};
+
+/** what one monitoring step found */
+struct FVehicleMonitorResult
+{
+	/** expected tick compared, and where the car was when it was sampled (triage looks at both, not at the car now) */
+	int32 ComparedTick = INDEX_NONE;
+	FVector Location = FVector::ZeroVector;
+	uint8 Errors = 0;
+	float ExpectedDistance = 0.f;
+	float ForwardSpeed = 0.f;
+
+	/** landmarks in view, if this step was a camera check */
+	bool bCameraChecked = false;
+	TArray<int32> Landmarks;
+};
+
+/**
+ * post-physics tick of the primary's monitoring, registered next to its actor tick
+ * the actor tick only samples, this consumes the samples at a fixed rate (AVehicleAdv3Pawn::TickMonitor)
+ */
+USTRUCT()
+struct FVehicleMonitorTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	AVehicleAdv3Pawn* Target = nullptr;
+
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FVehicleMonitorTickFunction> : public TStructOpsTypeTraitsBase2<FVehicleMonitorTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
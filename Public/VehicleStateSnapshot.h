@@ -0,0 +1,112 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AWheeledVehicle;
+
+/**
+ * complete dynamic state of a wheeled vehicle (value type, no heap use for up to 4 wheels/bodies)
+ * - pose and per-body linear/angular velocity
+ * - drive: engine speed, current/target gear, gear switch and autobox timers, auto gears, analog inputs
+ * - wheels: rotation speed and angle
+ * - movement component inputs: raw and smoothed throttle/steering/brake/handbrake
+ * suspension compression isn't stored, PhysX recomputes it from the body pose on the next update
+ * restoring onto a vehicle at the same pose (e.g. a clone spawned from the snapshot) reproduces the
+ * captured state exactly, so a rollout branches from where the real car is instead of drifting away from it
+ */
+struct VEHICLEADV3_API FVehicleStateSnapshot
+{
+	struct FBodyState
+	{
+		/** body pose relative to the mesh component */
+		FTransform RelativeTransform;
+		/** cm/s */
+		FVector LinearVelocity;
+		/** rad/s */
+		FVector AngularVelocity;
+
+		friend FArchive& operator<<(FArchive& Ar, FBodyState& state)
+		{
+			return Ar << state.RelativeTransform << state.LinearVelocity << state.AngularVelocity;
+		}
+	};
+
+	struct FWheelState
+	{
+		/** rad/s */
+		float RotationSpeed;
+		/** rad */
+		float RotationAngle;
+
+		friend FArchive& operator<<(FArchive& Ar, FWheelState& state)
+		{
+			return Ar << state.RotationSpeed << state.RotationAngle;
+		}
+	};
+
+	FVehicleStateSnapshot();
+
+	/** read state of vehicle's movement component and physics bodies */
+	void Capture(const AWheeledVehicle* vehicle);
+
+	/** write state onto vehicle (any vehicle with the same setup)
+	 * @param bTeleport also move vehicle to the captured pose */
+	void Restore(AWheeledVehicle* vehicle, bool bTeleport = false) const;
+
+	/** remove captured state */
+	void Reset();
+
+	/** binary (de)serialization, e.g. for state restores in run recordings */
+	void Serialize(FArchive& Ar);
+
+	bool IsValid() const { return bIsValid; }
+
+	/** @returns actor transform at capture */
+	const FTransform& GetTransform() const { return Transform; }
+
+	/** @returns root body linear velocity in cm/s */
+	FVector GetLinearVelocity() const;
+
+	/** @returns root body angular velocity in deg/s (same units as GetPhysicsAngularVelocity) */
+	FVector GetAngularVelocity() const;
+
+	/** @returns current gear as reported by the movement component (-1 reverse, 0 neutral) */
+	int32 GetGear() const;
+
+	/** @returns engine speed in rpm */
+	float GetRPM() const;
+
+	/** @returns heap memory used (0 unless the vehicle has more than 4 wheels or bodies) */
+	SIZE_T GetAllocatedSize() const { return Bodies.GetAllocatedSize() + Wheels.GetAllocatedSize() + AnalogInputs.GetAllocatedSize(); }
+
+private:
+
+	FTransform Transform;
+	TArray<FBodyState, TInlineAllocator<4>> Bodies;
+	TArray<FWheelState, TInlineAllocator<4>> Wheels;
+
+	/** drive state, PhysX units (engine speed in rad/s, gears in PhysX numbering where 0 is reverse) */
+	TArray<float, TInlineAllocator<5>> AnalogInputs;
+	float EngineSpeed;
+	float GearSwitchTime;
+	float AutoBoxSwitchTime;
+	uint8 CurrentGear;
+	uint8 TargetGear;
+	bool bUseAutoGears;
+	bool bGearUp;
+	bool bGearDown;
+
+	/** movement component input state (raw is what was requested, smoothed is what the drive sees) */
+	float RawThrottle;
+	float RawSteering;
+	float RawBrake;
+	float Throttle;
+	float Steering;
+	float Brake;
+	float Handbrake;
+	bool bRawHandbrake;
+
+	bool bIsValid;
+};
@@ -1,100 +1,117 @@
 #include "SimulationData.h"
-#include "Landmark.h"
 
-USimulationData::USimulationData()
+FSimulationData::FSimulationData()
 {
+	gear = 0;
+	runtime = 0.f;
 	bIsReady = false;
 }
 
-USimulationData::~USimulationData()
+void FSimulationData::Initialize(FTransform tran, int g, const TArray<FTransform>& path, const TArray<FVector>& velocities, const TArray<float>& rpms, const FTrajectoryCodecSettings& settings)
 {
+	this->transform = tran;
+	this->gear = g;
+	this->trajectory.Encode(path, velocities, rpms, settings);
+	this->bIsReady = true;
+}
 
+void FSimulationData::InitializeTarget(FTransform tran, const TArray<FTransform>& path, const TArray<FVector>& velocities, const TArray<float>& rpms, float runtime, const FTrajectoryCodecSettings& settings)
+{
+	this->transform = tran;
+	this->trajectory.Encode(path, velocities, rpms, settings);
+	this->bIsReady = true;
+	this->runtime = runtime;
 }
 
-//NTODO: investigate copy constructors for TARRAY
-USimulationData* USimulationData::MAKE(FTransform transform, int g, TArray<FTransform> path, TArray<FVector> speeds, TArray<float> rpms, TMap<int32, TArray<ALandmark*>> landmarks)
+FTransform FSimulationData::GetTransform() const
 {
-	//NTODO: try a smart pointer to keep this from garbage collection
-	//alt: 
-	TWeakObjectPtr<USimulationData> newsim(NewObject<USimulationData>());
-	//USimulationData* newSim = NewObject<USimulationData>();
-	newsim->transform = transform;
-	newsim->gear = g;
-	newsim->path = path;
-	newsim->velocities = speeds;
-	newsim->rpms = rpms;
-	newsim->bIsReady = true;
-	newsim->landmarks = landmarks;
-	newsim->AddToRoot();
+	return this->transform;
+}
 
-	return newsim.Get();
+TArray<FTransform> FSimulationData::GetPath() const
+{
+	TArray<FTransform> path;
+	trajectory.DecodePath(path);
+	return path;
 }
 
-void USimulationData::Initialize(FTransform tran, int g, TArray<FTransform> path, TArray<FVector> velocities, TArray<float> rpms, TMap<int32, TArray<ALandmark*>> landmarks)
+TArray<FVector> FSimulationData::GetVelocities() const
 {
-	this->transform = transform;
-	this->gear = g;
-	this->path = path;
-	this->velocities = velocities;
-	this->rpms = rpms;
-	this->bIsReady = true;
-	this->landmarks = landmarks;
+	TArray<FVector> velocities;
+	trajectory.DecodeVelocities(velocities);
+	return velocities;
+}
 
+TArray<float> FSimulationData::GetRMPValues() const
+{
+	TArray<float> rpms;
+	trajectory.DecodeRPMs(rpms);
+	return rpms;
 }
 
-void USimulationData::InitializeTarget(FTransform tran, TArray<FTransform> path, TArray<FVector> velocities, TArray<float> rpms, float runtime)
+int32 FSimulationData::GetNumTicks() const
 {
-	this->transform = tran;
-	this->path = path;
-	this->velocities = velocities;
-	this->rpms = rpms;
-	this->bIsReady = true;
-	this->runtime = runtime;
+	return trajectory.Num();
 }
 
-FTransform USimulationData::GetTransform()
+FTransform FSimulationData::GetTransformAtTick(int32 tick) const
 {
-	return this->transform;
+	return trajectory.GetTransform(tick);
+}
+
+FVector FSimulationData::GetLocationAtTick(int32 tick) const
+{
+	return trajectory.GetLocation(tick);
+}
+
+FVector FSimulationData::GetVelocityAtTick(int32 tick) const
+{
+	return trajectory.GetVelocity(tick);
 }
 
-//NTODO: return value of array (ret: Tarray<FTransform>)
-TArray<FTransform> USimulationData::GetPath()
+float FSimulationData::GetRPMAtTick(int32 tick) const
 {
-	return this->path;
+	return trajectory.GetRPM(tick);
 }
 
-TArray<FVector> USimulationData::GetVelocities()
+const FCompressedTrajectory& FSimulationData::GetTrajectory() const
 {
-	return this->velocities;
+	return trajectory;
 }
 
-//NTODO: Return value of array
-TArray<float> USimulationData::GetRMPValues()
+SIZE_T FSimulationData::GetAllocatedSize() const
 {
-	return this->rpms;
+	return trajectory.GetAllocatedSize();
 }
 
-//NTODO: return a success bool, and pass in pre-created array by ptr to fill
-TArray<ALandmark*> USimulationData::GetLandmarksAtTick(int32 tick)
+void FSimulationData::LoadRun(FArchive& Ar)
 {
-	// TODO add fail case for key not exist?
-	return this->landmarks[tick];
+	check(Ar.IsLoading());
+	Ar << transform;
+	Ar << gear;
+	Ar << runtime;
+	Ar << trajectory;
+	bIsReady = !Ar.IsError();
 }
 
-bool USimulationData::hasLandmarksAtTick(int32 tick)
+void FSimulationData::SaveRun(FArchive& Ar) const
 {
-	TArray<int32>* keys = new TArray<int32>;
-	this->landmarks.GetKeys(*keys);
-	return keys->Contains(tick);
-	//NTODO: mem dealloc
+	check(Ar.IsSaving());
+	FTransform savedTransform = transform;
+	int savedGear = gear;
+	float savedRuntime = runtime;
+	Ar << savedTransform;
+	Ar << savedGear;
+	Ar << savedRuntime;
+	trajectory.Save(Ar);
 }
 
-float USimulationData::GetRunTime()
+float FSimulationData::GetRunTime() const
 {
 	return runtime;
 }
 
-void USimulationData::SetRunTime(float time)
+void FSimulationData::SetRunTime(float time)
 {
 	runtime = time;
 }
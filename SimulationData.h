@@ -1,12 +1,9 @@
  #pragma once
 
-#include "Landmark.h"
-#include "SimulationData.generated.h"
+#include "TrajectoryCodec.h"
 
-UCLASS(config = Game)
-class USimulationData : public UObject {
-
-	GENERATED_BODY()
+/** plain value record of a simulated/target run (lives in the owning vehicle's FRunRecordArena, not the GC) */
+class FSimulationData {
 
 	// final transform (pos & location)
 	FTransform transform;
@@ -14,17 +11,8 @@ class USimulationData : public UObject {
 	/** final gear */
 	int gear;
 
-	/** transform of simulation vehicle at every tick */
-	TArray<FTransform> path;
-
-	/** speed of simulation vehicle at every tick */
-	TArray<FVector> velocities;
-
-	/** rpm at every tick */
-	TArray<float> rpms;
-
-	/** landmarks we should be seeing at each tick (keyed by tick) */
-	TMap<int32, TArray<ALandmark*>> landmarks;
+	/** transform, speed and rpm of simulation vehicle at every tick (compressed) */
+	FCompressedTrajectory trajectory;
 
 	/** runtime start to finish */
 	float runtime;
@@ -35,43 +23,51 @@ public:
 	bool bIsReady;
 
 	/* constructor for SimulationData object */
-	USimulationData();
-
-	~USimulationData();
-
-	static USimulationData* MAKE(FTransform tran, int g, TArray<FTransform> path, TArray<FVector> velocities, TArray<float> rpms, TMap<int32, TArray<ALandmark*>> landmarks);
+	FSimulationData();
 
 	/* initialize empty object */
-	void Initialize(FTransform tran, int g, TArray<FTransform> path, TArray<FVector> velocities, TArray<float> rpms, TMap<int32, TArray<ALandmark*>> landmarks);
+	void Initialize(FTransform tran, int g, const TArray<FTransform>& path, const TArray<FVector>& velocities, const TArray<float>& rpms, const FTrajectoryCodecSettings& settings = FTrajectoryCodecSettings());
 
 
 	/** initialize specifically for target run data (doesn't care about field like gear etc.)
-	  * TODO think about if want to store landmarks for target run */
-	void InitializeTarget(FTransform tran, TArray<FTransform> path, TArray<FVector> velocities, TArray<float> rpms, float runtime);
+	  * expected landmarks come from FLandmarkSensor at any stored pose, so none are kept here */
+	void InitializeTarget(FTransform tran, const TArray<FTransform>& path, const TArray<FVector>& velocities, const TArray<float>& rpms, float runtime, const FTrajectoryCodecSettings& settings = FTrajectoryCodecSettings());
 
 
 	/** Stores final transform */
-	FTransform GetTransform();
+	FTransform GetTransform() const;
 
 	/** Stores sequence of 3D locations sampled at every tick
-	 * according to https://www.gps.gov/systems/gps/performance/accuracy/, phone gps is accurate to within a ~4,9m a radius*/
-	TArray<FTransform> GetPath();
+	 * according to https://www.gps.gov/systems/gps/performance/accuracy/, phone gps is accurate to within a ~4,9m a radius
+	 * NOTE decodes the whole run, use GetTransformAtTick for per-tick access */
+	TArray<FTransform> GetPath() const;
+
+	/** Returns speed array (decodes whole run) */
+	TArray<FVector> GetVelocities() const;
+
+	/** Returns rpm array (decodes whole run) */
+	TArray<float> GetRMPValues() const;
+
+	/** @returns number of ticks stored */
+	int32 GetNumTicks() const;
 
-	//NTODO: investigate the lack of reference return
-	/** Returns speed array */
-	TArray<FVector> GetVelocities();
+	/** O(1) access to a single tick of the stored run */
+	FTransform GetTransformAtTick(int32 tick) const;
+	FVector GetLocationAtTick(int32 tick) const;
+	FVector GetVelocityAtTick(int32 tick) const;
+	float GetRPMAtTick(int32 tick) const;
 
-	/** Returns rpm array */
-	TArray<float> GetRMPValues();
+	/** @returns compressed run */
+	const FCompressedTrajectory& GetTrajectory() const;
 
-	/** Returns landmarks array
-	 * @param tick at which landmarks were seen
-	 * @returns TArray<FName> array of landmarks seen at given tick*/
-	TArray<ALandmark*> GetLandmarksAtTick(int32 tick);
+	/** @returns bytes used by stored run */
+	SIZE_T GetAllocatedSize() const;
 
-	bool hasLandmarksAtTick(int32 tick);
+	/** read/write final transform, gear, runtime and compressed run */
+	void LoadRun(FArchive& Ar);
+	void SaveRun(FArchive& Ar) const;
 
-	float GetRunTime();
+	float GetRunTime() const;
 
 	void SetRunTime(float time);
-};
\ No newline at end of file
+};
@@ -0,0 +1,401 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+// Offline evaluator for error detection and triage over recorded runs (-RecordRun=, see RunRecordFormat.h)
+//
+// Runs the same detection/triage code as the pawn (Public/ErrorDetectionCore.h) over every recorded
+// actual-vs-expected sample, for every point of a threshold grid, spread over all cores.
+//
+//   ErrorEvaluator [options] run1.run [run2.run ...]
+//     --location a:b:step   location thresholds in cm      (default 100:1600:100)
+//     --rotation a:b:step   rotation thresholds in radians (default 0.05:0.5:0.05)
+//     --rpm a:b:step        rpm thresholds                 (default 15:300:15)
+//     --nominal-drag d      drag coefficient with no drag fault (default: first frame of each run)
+//     --threads n           worker threads (default: all cores)
+//     --out file.csv        one row per threshold set (default: stdout summary only)
+//
+// Ground truth is the fault state recorded each tick: steering drift, low friction, or drag off nominal.
+// A tick counts as a positive detection when it would start triage (ShouldTriage): location error alone
+// doesn't. Camera errors can't be re-evaluated offline (landmarks aren't recorded), the recorded flag is used.
+// Detection latency is the time from a fault's onset to the first tick that would start triage.
+// Triage is scored at that tick: a drift fault needs bTrySteer, a drag/friction fault needs bTryThrottle.
+
+#include "ErrorDetectionCore.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	enum EFault : uint8_t
+	{
+		FAULT_DRIFT = 1 << 0,
+		FAULT_FRICTION = 1 << 1,
+		FAULT_DRAG = 1 << 2,
+	};
+
+	/** one recorded run, with the thresholds-independent part of detection done once up front */
+	struct FTrace
+	{
+		std::string Name;
+		std::vector<RunFile::FRunFrame> Frames;
+		/** actual vs expected error for frames with FRAME_EXPECTED */
+		std::vector<DetectionCore::FStateError> Errors;
+		/** EFault active at each frame */
+		std::vector<uint8_t> Faults;
+		/** seconds since start of run at each frame */
+		std::vector<float> Time;
+	};
+
+	struct FGridAxis
+	{
+		float Min;
+		float Max;
+		float Step;
+
+		int Num() const
+		{
+			return Step > 0.f ? int((Max - Min) / Step + 1.5f) : 1;
+		}
+
+		float At(int i) const
+		{
+			return Min + Step * float(i);
+		}
+	};
+
+	struct FResult
+	{
+		DetectionCore::FThresholds Thresholds;
+		uint64_t TruePositive = 0;
+		uint64_t FalsePositive = 0;
+		uint64_t TrueNegative = 0;
+		uint64_t FalseNegative = 0;
+		int Onsets = 0;
+		int Detected = 0;
+		int TriageCorrect = 0;
+		float LatencyMean = 0.f;
+		float LatencyP50 = 0.f;
+		float LatencyP90 = 0.f;
+		float LatencyMax = 0.f;
+
+		double Precision() const
+		{
+			return TruePositive + FalsePositive > 0 ? double(TruePositive) / double(TruePositive + FalsePositive) : 0.0;
+		}
+
+		double Recall() const
+		{
+			return TruePositive + FalseNegative > 0 ? double(TruePositive) / double(TruePositive + FalseNegative) : 0.0;
+		}
+
+		double F1() const
+		{
+			const double p = Precision();
+			const double r = Recall();
+			return p + r > 0.0 ? 2.0 * p * r / (p + r) : 0.0;
+		}
+	};
+
+	DetectionCore::FVec3 ToVec3(const float v[3])
+	{
+		return { v[0], v[1], v[2] };
+	}
+
+	DetectionCore::FQuat4 ToQuat4(const float q[4])
+	{
+		return { q[0], q[1], q[2], q[3] };
+	}
+
+	bool LoadTrace(const std::string& path, float nominalDrag, FTrace& trace)
+	{
+		std::ifstream file(path, std::ios::binary);
+		if (!file)
+		{
+			std::fprintf(stderr, "couldn't open %s\n", path.c_str());
+			return false;
+		}
+		const std::vector<char> contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+		RunFile::FRunFileHeader header;
+		if (contents.size() < sizeof(header))
+		{
+			std::fprintf(stderr, "%s is truncated\n", path.c_str());
+			return false;
+		}
+		std::memcpy(&header, contents.data(), sizeof(header));
+		if (header.Magic != RunFile::MAGIC || header.Version != RunFile::VERSION || header.FrameSize != sizeof(RunFile::FRunFrame)
+			|| contents.size() != RunFile::GetFileSize(header))
+		{
+			std::fprintf(stderr, "%s has wrong format (version %u)\n", path.c_str(), header.Version);
+			return false;
+		}
+
+		trace.Name = path;
+		trace.Frames.resize(header.NumFrames);
+		std::memcpy(trace.Frames.data(), contents.data() + sizeof(header), trace.Frames.size() * sizeof(RunFile::FRunFrame));
+		trace.Errors.resize(trace.Frames.size());
+		trace.Faults.resize(trace.Frames.size());
+		trace.Time.resize(trace.Frames.size());
+
+		const float drag = nominalDrag > 0.f ? nominalDrag : (trace.Frames.empty() ? 0.f : trace.Frames[0].DragCoefficient);
+		float time = 0.f;
+		for (size_t i = 0; i < trace.Frames.size(); i++)
+		{
+			const RunFile::FRunFrame& frame = trace.Frames[i];
+			trace.Time[i] = time;
+			time += frame.DeltaSeconds;
+			trace.Faults[i] = uint8_t(((frame.Flags & RunFile::FRAME_DRIFT) ? FAULT_DRIFT : 0)
+				| ((frame.Flags & RunFile::FRAME_LOW_FRICTION) ? FAULT_FRICTION : 0)
+				| (std::fabs(frame.DragCoefficient - drag) > 0.01f * drag ? FAULT_DRAG : 0));
+			if (frame.Flags & RunFile::FRAME_EXPECTED)
+			{
+				trace.Errors[i] = DetectionCore::Measure(ToVec3(frame.Location), ToQuat4(frame.Rotation), frame.RPM, ToVec3(frame.ExpectedLocation), ToQuat4(frame.ExpectedRotation), frame.ExpectedRPM);
+			}
+		}
+		return true;
+	}
+
+	/** score one threshold set over every trace (latencies collected into scratch) */
+	void Evaluate(const std::vector<FTrace>& traces, FResult& result, std::vector<float>& latencies)
+	{
+		latencies.clear();
+		for (const FTrace& trace : traces)
+		{
+			int onset = -1;
+			bool bDetected = false;
+			for (size_t i = 0; i < trace.Frames.size(); i++)
+			{
+				const RunFile::FRunFrame& frame = trace.Frames[i];
+				const uint8_t faults = trace.Faults[i];
+
+				// fault episodes: onset when a fault switches on, missed if it ends undetected
+				if (faults && onset < 0)
+				{
+					onset = int(i);
+					bDetected = false;
+					result.Onsets++;
+				}
+				else if (!faults)
+				{
+					onset = -1;
+				}
+
+				if (!(frame.Flags & RunFile::FRAME_EXPECTED))
+				{
+					continue;
+				}
+				const uint8_t errors = DetectionCore::Classify(trace.Errors[i], result.Thresholds) | (frame.Errors & RunFile::ERROR_CAMERA);
+				const bool bPositive = DetectionCore::ShouldTriage(errors);
+				if (faults)
+				{
+					bPositive ? result.TruePositive++ : result.FalseNegative++;
+				}
+				else
+				{
+					bPositive ? result.FalsePositive++ : result.TrueNegative++;
+				}
+
+				if (bPositive && faults && !bDetected)
+				{
+					bDetected = true;
+					result.Detected++;
+					latencies.push_back(trace.Time[i] - trace.Time[onset]);
+
+					const DetectionCore::FTriage triage = DetectionCore::Triage(errors, nullptr, true, ToVec3(frame.PredictionStart), ToVec3(frame.PredictionEnd), ToVec3(frame.ExpectedLocation), ToVec3(frame.Location));
+					const bool bSteerOk = !(faults & FAULT_DRIFT) || triage.bTrySteer;
+					const bool bThrottleOk = !(faults & (FAULT_FRICTION | FAULT_DRAG)) || triage.bTryThrottle;
+					if (bSteerOk && bThrottleOk)
+					{
+						result.TriageCorrect++;
+					}
+				}
+			}
+		}
+
+		if (!latencies.empty())
+		{
+			double sum = 0.0;
+			for (float latency : latencies)
+			{
+				sum += latency;
+			}
+			result.LatencyMean = float(sum / double(latencies.size()));
+			std::sort(latencies.begin(), latencies.end());
+			result.LatencyP50 = latencies[latencies.size() / 2];
+			result.LatencyP90 = latencies[std::min(latencies.size() - 1, latencies.size() * 9 / 10)];
+			result.LatencyMax = latencies.back();
+		}
+	}
+
+	bool ParseAxis(const char* text, FGridAxis& axis)
+	{
+		float min = 0.f, max = 0.f, step = 0.f;
+		const int numParsed = std::sscanf(text, "%f:%f:%f", &min, &max, &step);
+		if (numParsed == 1)
+		{
+			axis = { min, min, 0.f };
+			return true;
+		}
+		if (numParsed == 3 && step > 0.f && max >= min)
+		{
+			axis = { min, max, step };
+			return true;
+		}
+		std::fprintf(stderr, "bad grid '%s' (use value or min:max:step)\n", text);
+		return false;
+	}
+
+	void PrintResult(const char* label, const FResult& result)
+	{
+		std::printf("%s: location %.1f cm, rotation %.3f rad, rpm %.1f\n", label, result.Thresholds.Location, result.Thresholds.Rotation, result.Thresholds.RPM);
+		std::printf("               fault    no fault\n");
+		std::printf("  triage  %10llu  %10llu\n", (unsigned long long)result.TruePositive, (unsigned long long)result.FalsePositive);
+		std::printf("  quiet   %10llu  %10llu\n", (unsigned long long)result.FalseNegative, (unsigned long long)result.TrueNegative);
+		std::printf("  precision %.3f recall %.3f F1 %.3f\n", result.Precision(), result.Recall(), result.F1());
+		std::printf("  faults detected %d/%d, triage correct %d, latency mean %.2f s p50 %.2f s p90 %.2f s max %.2f s\n",
+			result.Detected, result.Onsets, result.TriageCorrect, result.LatencyMean, result.LatencyP50, result.LatencyP90, result.LatencyMax);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	FGridAxis location = { 100.f, 1600.f, 100.f };
+	FGridAxis rotation = { 0.05f, 0.5f, 0.05f };
+	FGridAxis rpm = { 15.f, 300.f, 15.f };
+	float nominalDrag = 0.f;
+	unsigned numThreads = std::max(1u, std::thread::hardware_concurrency());
+	std::string outPath;
+	std::vector<std::string> paths;
+
+	for (int i = 1; i < argc; i++)
+	{
+		const std::string arg = argv[i];
+		const bool bHasValue = i + 1 < argc;
+		if (arg == "--location" && bHasValue)
+		{
+			if (!ParseAxis(argv[++i], location)) return 1;
+		}
+		else if (arg == "--rotation" && bHasValue)
+		{
+			if (!ParseAxis(argv[++i], rotation)) return 1;
+		}
+		else if (arg == "--rpm" && bHasValue)
+		{
+			if (!ParseAxis(argv[++i], rpm)) return 1;
+		}
+		else if (arg == "--nominal-drag" && bHasValue)
+		{
+			nominalDrag = float(std::atof(argv[++i]));
+		}
+		else if (arg == "--threads" && bHasValue)
+		{
+			numThreads = unsigned(std::max(1, std::atoi(argv[++i])));
+		}
+		else if (arg == "--out" && bHasValue)
+		{
+			outPath = argv[++i];
+		}
+		else if (arg.compare(0, 2, "--") == 0)
+		{
+			std::fprintf(stderr, "unknown option %s\n", arg.c_str());
+			return 1;
+		}
+		else
+		{
+			paths.push_back(arg);
+		}
+	}
+	if (paths.empty())
+	{
+		std::fprintf(stderr, "usage: ErrorEvaluator [--location a:b:step] [--rotation a:b:step] [--rpm a:b:step] [--nominal-drag d] [--threads n] [--out file.csv] run...\n");
+		return 1;
+	}
+
+	std::vector<FTrace> traces;
+	size_t numFrames = 0;
+	for (const std::string& path : paths)
+	{
+		FTrace trace;
+		if (LoadTrace(path, nominalDrag, trace))
+		{
+			numFrames += trace.Frames.size();
+			traces.push_back(std::move(trace));
+		}
+	}
+	if (traces.empty())
+	{
+		return 1;
+	}
+
+	// grid, location fastest
+	std::vector<FResult> results(size_t(location.Num()) * rotation.Num() * rpm.Num());
+	for (size_t i = 0; i < results.size(); i++)
+	{
+		const int l = int(i % location.Num());
+		const int r = int((i / location.Num()) % rotation.Num());
+		const int p = int(i / (size_t(location.Num()) * rotation.Num()));
+		results[i].Thresholds.Location = location.At(l);
+		results[i].Thresholds.Rotation = rotation.At(r);
+		results[i].Thresholds.RPM = rpm.At(p);
+	}
+
+	// threshold sets are independent: workers pull the next one until the grid is done
+	const auto startTime = std::chrono::steady_clock::now();
+	std::atomic<size_t> next(0);
+	std::vector<std::thread> workers;
+	for (unsigned t = 0; t < numThreads; t++)
+	{
+		workers.emplace_back([&]()
+		{
+			std::vector<float> latencies;
+			for (size_t i = next++; i < results.size(); i = next++)
+			{
+				Evaluate(traces, results[i], latencies);
+			}
+		});
+	}
+	for (std::thread& worker : workers)
+	{
+		worker.join();
+	}
+	const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+	std::printf("%zu threshold sets over %zu runs (%zu frames) in %.3f s on %u threads (%.0f sets/min)\n",
+		results.size(), traces.size(), numFrames, seconds, numThreads, seconds > 0.0 ? double(results.size()) * 60.0 / seconds : 0.0);
+
+	if (!outPath.empty())
+	{
+		FILE* out = std::fopen(outPath.c_str(), "w");
+		if (!out)
+		{
+			std::fprintf(stderr, "couldn't write %s\n", outPath.c_str());
+			return 1;
+		}
+		std::fprintf(out, "location,rotation,rpm,tp,fp,tn,fn,precision,recall,f1,onsets,detected,triage_correct,latency_mean,latency_p50,latency_p90,latency_max\n");
+		for (const FResult& result : results)
+		{
+			std::fprintf(out, "%g,%g,%g,%llu,%llu,%llu,%llu,%.4f,%.4f,%.4f,%d,%d,%d,%.4f,%.4f,%.4f,%.4f\n",
+				result.Thresholds.Location, result.Thresholds.Rotation, result.Thresholds.RPM,
+				(unsigned long long)result.TruePositive, (unsigned long long)result.FalsePositive, (unsigned long long)result.TrueNegative, (unsigned long long)result.FalseNegative,
+				result.Precision(), result.Recall(), result.F1(), result.Onsets, result.Detected, result.TriageCorrect,
+				result.LatencyMean, result.LatencyP50, result.LatencyP90, result.LatencyMax);
+		}
+		std::fclose(out);
+	}
+
+	// current defaults next to the best set found
+	FResult defaults;
+	std::vector<float> latencies;
+	Evaluate(traces, defaults, latencies);
+	PrintResult("pawn defaults", defaults);
+	const FResult& best = *std::max_element(results.begin(), results.end(), [](const FResult& a, const FResult& b) { return a.F1() < b.F1(); });
+	PrintResult("best F1", best);
+	return 0;
+}
@@ -0,0 +1,108 @@
+#!/usr/bin/env python3
+"""Compare benchmark results (-RunBenchmarks) against a stored baseline.
+
+    bench_compare.py Saved/Benchmarks/latest.json                 compare with Benchmarks/Baselines/<platform>.json
+    bench_compare.py latest.json --baseline other.json            compare with a specific file
+    bench_compare.py latest.json --save-baseline                  store results as the baseline (commit the file)
+
+For every case, the change in mean time gets a bootstrap confidence interval from the repeated runs.
+A case is flagged slower only when the whole interval sits above --threshold, so one noisy run doesn't
+fail the gate. A golden checksum that differs from the baseline means the results changed, not just the
+speed. The exit status is 1 if anything got slower or changed results, 0 otherwise.
+"""
+
+import argparse
+import json
+import os
+import random
+import shutil
+import sys
+
+SCHEMA = 3
+REPO_ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+
+def load(path):
+    with open(path) as f:
+        results = json.load(f)
+    if results.get("schema") != SCHEMA:
+        sys.exit("%s has schema %s, expected %d (re-record the baseline)" % (path, results.get("schema"), SCHEMA))
+    return results
+
+
+def mean(values):
+    return sum(values) / len(values)
+
+
+def bootstrap_change(baseline, current, confidence, resamples, rng):
+    """@returns relative change of mean time (current/baseline - 1) and its confidence interval"""
+    changes = []
+    for _ in range(resamples):
+        b = mean([rng.choice(baseline) for _ in baseline])
+        c = mean([rng.choice(current) for _ in current])
+        changes.append(c / b - 1.0)
+    changes.sort()
+    tail = (1.0 - confidence) / 2.0
+    low = changes[int(tail * (resamples - 1))]
+    high = changes[int((1.0 - tail) * (resamples - 1))]
+    return mean(current) / mean(baseline) - 1.0, low, high
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("results", help="results file written by -RunBenchmarks")
+    parser.add_argument("--baseline", help="baseline file (default Benchmarks/Baselines/<platform>.json)")
+    parser.add_argument("--threshold", type=float, default=0.05, help="relative slowdown that counts (default 0.05)")
+    parser.add_argument("--confidence", type=float, default=0.95, help="confidence level of intervals (default 0.95)")
+    parser.add_argument("--resamples", type=int, default=5000, help="bootstrap resamples (default 5000)")
+    parser.add_argument("--save-baseline", action="store_true", help="store results as the baseline instead of comparing")
+    args = parser.parse_args()
+
+    current = load(args.results)
+    baseline_path = args.baseline or os.path.join(REPO_ROOT, "Benchmarks", "Baselines", current["platform"] + ".json")
+
+    if args.save_baseline:
+        os.makedirs(os.path.dirname(baseline_path), exist_ok=True)
+        shutil.copyfile(args.results, baseline_path)
+        print("saved %s as baseline %s (checksum %s)" % (args.results, baseline_path, current["checksum"]))
+        return 0
+
+    if not os.path.exists(baseline_path):
+        sys.exit("no baseline at %s, record one with --save-baseline" % baseline_path)
+    baseline = load(baseline_path)
+    if baseline.get("cpu") != current.get("cpu") or baseline.get("build") != current.get("build"):
+        print("warning: baseline is from %s (%s), results from %s (%s)" % (baseline.get("cpu"), baseline.get("build"), current.get("cpu"), current.get("build")))
+
+    rng = random.Random(0)
+    failed = False
+    print("%-26s %12s %12s %9s   %-22s %s" % ("case", "baseline ms", "current ms", "change", "%d%% interval" % round(args.confidence * 100), "verdict"))
+    for name, base_case in sorted(baseline["cases"].items()):
+        case = current["cases"].get(name)
+        if case is None:
+            print("%-26s missing from results" % name)
+            failed = True
+            continue
+        change, low, high = bootstrap_change(base_case["seconds"], case["seconds"], args.confidence, args.resamples, rng)
+        if low > args.threshold:
+            verdict = "SLOWER"
+            failed = True
+        elif high < -args.threshold:
+            verdict = "faster"
+        else:
+            verdict = "same"
+        if case["checksum"] != base_case["checksum"]:
+            verdict += ", RESULTS CHANGED (checksum %s, baseline %s)" % (case["checksum"], base_case["checksum"])
+            failed = True
+        elif not case.get("deterministic", True):
+            verdict += ", nondeterministic"
+        print("%-26s %12.4f %12.4f %+8.1f%%   [%+7.1f%%, %+7.1f%%]     %s" % (
+            name, mean(base_case["seconds"]) * 1000.0, mean(case["seconds"]) * 1000.0, change * 100.0, low * 100.0, high * 100.0, verdict))
+    for name in sorted(set(current["cases"]) - set(baseline["cases"])):
+        print("%-26s new case, not in baseline" % name)
+
+    print("golden checksum %s (baseline %s)" % (current["checksum"], baseline["checksum"]))
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
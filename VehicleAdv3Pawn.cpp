@@ -22,10 +22,22 @@
 #include "CustomRamp.h"
 #include "Kismet/GameplayStatics.h"
 #include "Landmark.h"
+#include "LandmarkSensor.h"
+#include "SimulationVehiclePawn.h"
+#include "SimulationVehicleMovementComponent.h"
+#include "PredictionWorld.h"
 #include "TestRunData.h"
 #include "CopyVehicleData.h"
 #include "Goal.h"
+#include "GoalDistanceField.h"
 #include "VehicleAdv3.h"
+#include "TargetRunCache.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "Misc/App.h"
+#include "Async/Async.h"
+#include "SimulationBenchmark.h"
+#include "SimulationMetrics.h"
 
 // Needed for VR Headset
 #if HMD_MODULE_INCLUDED
@@ -39,7 +51,21 @@ const FName AVehicleAdv3Pawn::EngineAudioRPM("RPM");
 
 #define LOCTEXT_NAMESPACE "VehiclePawn"
 
-AVehicleAdv3Pawn::AVehicleAdv3Pawn()
+namespace
+{
+	DetectionCore::FVec3 ToCore(const FVector& v)
+	{
+		return { v.X, v.Y, v.Z };
+	}
+
+	DetectionCore::FQuat4 ToCore(const FQuat& q)
+	{
+		return { q.X, q.Y, q.Z, q.W };
+	}
+}
+
+AVehicleAdv3Pawn::AVehicleAdv3Pawn(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer.SetDefaultSubobjectClass<USimulationVehicleMovementComponent>(AWheeledVehicle::VehicleMovementComponentName))
 { // UObject() constructor called but it's not the object that's currently being constructed with NewObject. Maybe you trying to construct it on the stack which is not supported.
 
 	// Car mesh
@@ -125,57 +151,80 @@ AVehicleAdv3Pawn::AVehicleAdv3Pawn()
 	// Set the inertia scale. This controls how the mass of the vehicle is distributed.
 	Vehicle4W->InertiaTensorScale = FVector(1.0f, 1.333f, 1.2f);
 
+	// cameras, in-car HUD and sound are optional so simulation-only clones (ASimulationVehiclePawn) can leave them out
+
 	// Create a spring arm component for our chase camera
-	SpringArm = CreateDefaultSubobject<USpringArmComponent>(TEXT("SpringArm"));
-	SpringArm->SetRelativeLocation(FVector(0.0f, 0.0f, 34.0f));
-	SpringArm->SetWorldRotation(FRotator(-20.0f, 0.0f, 0.0f));
-	SpringArm->SetupAttachment(RootComponent);
-	SpringArm->TargetArmLength = 125.0f;
-	SpringArm->bEnableCameraLag = false;
-	SpringArm->bEnableCameraRotationLag = false;
-	SpringArm->bInheritPitch = true;
-	SpringArm->bInheritYaw = true;
-	SpringArm->bInheritRoll = true;
+	SpringArm = CreateOptionalDefaultSubobject<USpringArmComponent>(TEXT("SpringArm"));
+	if (SpringArm)
+	{
+		SpringArm->SetRelativeLocation(FVector(0.0f, 0.0f, 34.0f));
+		SpringArm->SetWorldRotation(FRotator(-20.0f, 0.0f, 0.0f));
+		SpringArm->SetupAttachment(RootComponent);
+		SpringArm->TargetArmLength = 125.0f;
+		SpringArm->bEnableCameraLag = false;
+		SpringArm->bEnableCameraRotationLag = false;
+		SpringArm->bInheritPitch = true;
+		SpringArm->bInheritYaw = true;
+		SpringArm->bInheritRoll = true;
+	}
 
 	// Create the chase camera component 
-	Camera = CreateDefaultSubobject<UCameraComponent>(TEXT("ChaseCamera"));
-	Camera->SetupAttachment(SpringArm, USpringArmComponent::SocketName);
-	Camera->SetRelativeLocation(FVector(-125.0, 0.0f, 0.0f));
-	Camera->SetRelativeRotation(FRotator(10.0f, 0.0f, 0.0f));
-	Camera->bUsePawnControlRotation = false;
-	Camera->FieldOfView = 90.f;
+	Camera = CreateOptionalDefaultSubobject<UCameraComponent>(TEXT("ChaseCamera"));
+	if (Camera)
+	{
+		Camera->SetupAttachment(SpringArm, USpringArmComponent::SocketName);
+		Camera->SetRelativeLocation(FVector(-125.0, 0.0f, 0.0f));
+		Camera->SetRelativeRotation(FRotator(10.0f, 0.0f, 0.0f));
+		Camera->bUsePawnControlRotation = false;
+		Camera->FieldOfView = 90.f;
+	}
 
 	// Create In-Car camera component 
 	InternalCameraOrigin = FVector(-34.0f, -10.0f, 50.0f);
-	InternalCameraBase = CreateDefaultSubobject<USceneComponent>(TEXT("InternalCameraBase"));
-	InternalCameraBase->SetRelativeLocation(InternalCameraOrigin);
-	InternalCameraBase->SetupAttachment(GetMesh());
+	InternalCameraBase = CreateOptionalDefaultSubobject<USceneComponent>(TEXT("InternalCameraBase"));
+	if (InternalCameraBase)
+	{
+		InternalCameraBase->SetRelativeLocation(InternalCameraOrigin);
+		InternalCameraBase->SetupAttachment(GetMesh());
+	}
 
-	InternalCamera = CreateDefaultSubobject<UCameraComponent>(TEXT("InternalCamera"));
-	InternalCamera->bUsePawnControlRotation = false;
-	InternalCamera->FieldOfView = 90.f;
-	InternalCamera->SetupAttachment(InternalCameraBase);
+	InternalCamera = CreateOptionalDefaultSubobject<UCameraComponent>(TEXT("InternalCamera"));
+	if (InternalCamera)
+	{
+		InternalCamera->bUsePawnControlRotation = false;
+		InternalCamera->FieldOfView = 90.f;
+		InternalCamera->SetupAttachment(InternalCameraBase);
+	}
 
 	// In car HUD
 	// Create text render component for in car speed display
-	InCarSpeed = CreateDefaultSubobject<UTextRenderComponent>(TEXT("IncarSpeed"));
-	InCarSpeed->SetRelativeScale3D(FVector(0.1f, 0.1f, 0.1f));
-	InCarSpeed->SetRelativeLocation(FVector(35.0f, -6.0f, 20.0f));
-	InCarSpeed->SetRelativeRotation(FRotator(0.0f, 180.0f, 0.0f));
-	InCarSpeed->SetupAttachment(GetMesh());
+	InCarSpeed = CreateOptionalDefaultSubobject<UTextRenderComponent>(TEXT("IncarSpeed"));
+	if (InCarSpeed)
+	{
+		InCarSpeed->SetRelativeScale3D(FVector(0.1f, 0.1f, 0.1f));
+		InCarSpeed->SetRelativeLocation(FVector(35.0f, -6.0f, 20.0f));
+		InCarSpeed->SetRelativeRotation(FRotator(0.0f, 180.0f, 0.0f));
+		InCarSpeed->SetupAttachment(GetMesh());
+	}
 
 	// Create text render component for in car gear display
-	InCarGear = CreateDefaultSubobject<UTextRenderComponent>(TEXT("IncarGear"));
-	InCarGear->SetRelativeScale3D(FVector(0.1f, 0.1f, 0.1f));
-	InCarGear->SetRelativeLocation(FVector(35.0f, 5.0f, 20.0f));
-	InCarGear->SetRelativeRotation(FRotator(0.0f, 180.0f, 0.0f));
-	InCarGear->SetupAttachment(GetMesh());
+	InCarGear = CreateOptionalDefaultSubobject<UTextRenderComponent>(TEXT("IncarGear"));
+	if (InCarGear)
+	{
+		InCarGear->SetRelativeScale3D(FVector(0.1f, 0.1f, 0.1f));
+		InCarGear->SetRelativeLocation(FVector(35.0f, 5.0f, 20.0f));
+		InCarGear->SetRelativeRotation(FRotator(0.0f, 180.0f, 0.0f));
+		InCarGear->SetupAttachment(GetMesh());
+	}
 	
 	// Setup the audio component and allocate it a sound cue
 	static ConstructorHelpers::FObjectFinder<USoundCue> SoundCue(TEXT("/Game/VehicleAdv/Sound/Engine_Loop_Cue.Engine_Loop_Cue"));
-	EngineSoundComponent = CreateDefaultSubobject<UAudioComponent>(TEXT("EngineSound"));
-	EngineSoundComponent->SetSound(SoundCue.Object);
-	EngineSoundComponent->SetupAttachment(GetMesh());
+	EngineSoundComponent = CreateOptionalDefaultSubobject<UAudioComponent>(TEXT("EngineSound"));
+	if (EngineSoundComponent)
+	{
+		EngineSoundComponent->SetSound(SoundCue.Object);
+		EngineSoundComponent->SetupAttachment(GetMesh());
+	}
 
 	// Colors for the in-car gear display. One for normal one for reverse
 	GearDisplayReverseColor = FColor(255, 0, 0, 255);
@@ -248,6 +297,10 @@ void AVehicleAdv3Pawn::OnToggleCamera()
 
 void AVehicleAdv3Pawn::EnableIncarView(const bool bState)
 {
+	if (!Camera || !InternalCamera)
+	{
+		return;
+	}
 	if (bState != bInCarCameraActive)
 	{
 		bInCarCameraActive = bState;
@@ -269,6 +322,15 @@ void AVehicleAdv3Pawn::EnableIncarView(const bool bState)
 	}
 }
 
+const AVehicleAdv3Pawn::FRoleTick AVehicleAdv3Pawn::RoleTicks[] =
+{
+	&AVehicleAdv3Pawn::TickRecordOnly,	// ECT_datagen
+	&AVehicleAdv3Pawn::TickRecordOnly,	// ECT_target
+	&AVehicleAdv3Pawn::TickPrediction,	// ECT_prediction
+	&AVehicleAdv3Pawn::TickActual,		// ECT_actual
+	&AVehicleAdv3Pawn::TickTest			// ECT_test
+};
+
 void AVehicleAdv3Pawn::Tick(float Delta)
 {
 	Super::Tick(Delta);
@@ -276,177 +338,238 @@ void AVehicleAdv3Pawn::Tick(float Delta)
 	/************************************************************************/
 	/*							New Code                                    */
 
-	//check if at goal
+	// recorded inputs drive the car, nothing is predicted or corrected
+	if (bReplaying)
+	{
+		TickReplay();
+		return;
+	}
 
+	// more car forward at a steady rate (for primary and simulation), or follow the target run when tracking it
+	// (diagnostic adjustments are biases on top of the tracker's inputs)
+	const FTransform currentTransform = this->GetTransform();
+	AppliedThrottle = throttleInput + throttleAdjust;
+	TrackedSteer = 0.f;
+	if (PathTracker.IsActive())
+	{
+		const FPathTrackerCommand command = PathTracker.Update(currentTransform, GetVelocity(), Delta, throttleInput);
+		AppliedThrottle = command.Throttle + throttleAdjust;
+		TrackedSteer = command.Steer;
+	}
+	GetVehicleMovementComponent()->SetThrottleInput(AppliedThrottle);
 
-	// more car forward at a steady rate (for primary and simulation)
-	//UE_LOG(VehicleRunState, Log, TEXT("Throttle input: %f"), throttleInput + throttleAdjust);
-	GetVehicleMovementComponent()->SetThrottleInput(throttleInput + throttleAdjust); 
+	(this->*RoleTicks[int32(vehicleType)])(Delta, currentTransform);
 
-	// get current location
-	FTransform currentTransform = this->GetTransform();
-	FVector currentLocation = currentTransform.GetLocation();
-	FQuat currentRotation = currentTransform.GetRotation();
+	// save path data (every role)
+	PathLocations.Add(currentTransform); 
+	VelocityAlongPath.Add(this->GetVelocity());
+	RPMAlongPath.Add(GetVehicleMovement()->GetEngineRotationSpeed());
+	/************************************************************************/
 
-	// periodic camera sweep
-	bool bCameraErrorFound = false;
-	if (AtTickLocation % 400 == 0 && vehicleType != ECarType::ECT_test && vehicleType != ECarType::ECT_target)
-	{
-		// 'camera' simulation
-		FHitResult output;
-		FVector sweepStart = currentLocation + FVector(0, 0, 10.f);
-		FVector sweepEnd = currentLocation + currentLocation.ForwardVector * 10.f;
-		FCollisionObjectQueryParams params = FCollisionObjectQueryParams(ECC_GameTraceChannel1);	
-		const FCollisionShape shape = FCollisionShape::MakeSphere(300.f); 
-		FCollisionQueryParams CollisionParams;
-		this->outputArray.Empty();
-		if (GetWorld()->SweepMultiByObjectType(this->outputArray, sweepStart, sweepEnd, currentRotation, params, shape, CollisionParams))
-		{
-			TArray<ALandmark*> allLandmarksSeen;
-			if (bModelready && expectedFuture->bIsReady)
-			{
-				bool bLandmarksAccessErrorFound = false;
-
-				//NTODO: problematic because 'new TArray' becomes lost balloon (unreferenced allocated memory) <-- RTODO go over this again
-				TArray<ALandmark*> landmarks;
-				if (expectedFuture->hasLandmarksAtTick(int(AtTickLocation / 400)))
-				{ 
-					//NTODO:ptrs?
-					landmarks = expectedFuture->GetLandmarksAtTick(int(AtTickLocation / 400)); // TODO triggers error now...???
-				}
-				else
-				{ 
-					bLandmarksAccessErrorFound = true;
-				}
-				if (!bLandmarksAccessErrorFound)
-				{
-					// didn't see expected number of landmarks for this sweep
-					if (outputArray.Num() != landmarks.Num())
-					{
-						bCameraErrorFound = true;
-					}
-					// loop over trace hits ('seen objects')
-					for (int i = 0; i < outputArray.Num(); i++) //idiom for this: for (auto hitresult : outputArray) {...}
-					{
-						//TWeakObjectPtr<AActor> hit = outputArray[i].GetActor();
-						ALandmark* lmhit = Cast<ALandmark>(outputArray[i].GetActor());
-						if (lmhit && lmhit->IsValidLowLevelFast()) 
-						{
-							//FName seenLandmarkName = hit->GetFName();
-							allLandmarksSeen.Add(lmhit);
-
-							// don't need to keep looking if camera error found; offload rest of work 
-							if (vehicleType == ECarType::ECT_actual && expectedFuture->bIsReady && !bCameraErrorFound)
-							{
-								// check if this is the landmark we're supposed to see (if this is not a copy)
-								bool hitexpected = CheckLandmarkHit(&landmarks, lmhit); 
-								if (!hitexpected)
-								{
-									bCameraErrorFound = true;
-								}
-							}
-						}
-					}
-				}
+	// Setup the flag to say we are in reverse gear
+	bInReverseGear = GetVehicleMovement()->GetCurrentGear() < 0;
+	
+	// Update physics material
+	UpdatePhysicsMaterial();
 
-				// free up memory
-				//delete landmarks; // pretty sure still need this to exist
-			}
-			// store landmarks seen at index for this tick
-			if (vehicleType == ECarType::ECT_prediction)
-			{
-				this->LandmarksAlongPath.Add(int(AtTickLocation / 400), allLandmarksSeen);
-			}
-		}
-		// add empty array at tick location
-		else if (vehicleType == ECarType::ECT_prediction)
+	// nobody watches or listens to the clones
+	if (vehicleType == ECarType::ECT_actual)
+	{
+		TickPresentation();
+	}
+}
+
+void AVehicleAdv3Pawn::TickActual(float Delta, const FTransform& currentTransform)
+{
+	const FVector currentLocation = currentTransform.GetLocation();
+	FSimulationData* expectedFuture = GetExpectedFuture();
+
+	DistanceDriven += FVector::Dist(PreviousLocation, currentLocation);
+	PreviousLocation = currentLocation;
+	AverageTickSeconds = FMath::Lerp(AverageTickSeconds, Delta, 0.05f);
+
+	// run cost follows the car from the first tick there's a target run, while the run clock is going
+	if (!RunCost.HasTarget())
+	{
+		if (const FSimulationData* targetRunData = GetTargetRunData())
 		{
-			TArray<ALandmark*>* em = new TArray<ALandmark*>();
-			this->LandmarksAlongPath.Add(int(AtTickLocation / 400), *em);
+			RunCost.Begin(targetRunData->GetPath(), targetRunData->GetRunTime());
 		}
 	}
-	bool bRpmErrorFound = false;
-	bool bRotationErrorFound = false;
-	bool bLocationErrorFound = false;
-	if (vehicleType == ECarType::ECT_actual)
+	if (RunCost.HasTarget() && GetWorldTimerManager().IsTimerActive(RunTimerHandle))
+	{
+		RunCost.AddSample(currentTransform, GetWorldTimerManager().GetTimerElapsed(RunTimerHandle));
+	}
+
+	if (bGenerateDrift)
+	{
+		AppliedSteer = 0.05f + TrackedSteer + steerAdjust; // generate slight drift right TODO change value?
+	}
+	else
 	{
-		if (bGenerateDrift)
+		AppliedSteer = TrackedSteer + steerAdjust;
+	}
+	GetVehicleMovementComponent()->SetSteeringInput(AppliedSteer);
+
+	// sample for the monitor, which compares at its own rate after physics (TickMonitor)
+	FVehicleMonitorSample sample;
+	sample.Transform = currentTransform;
+	sample.RPM = GetVehicleMovement()->GetEngineRotationSpeed();
+	sample.ForwardSpeed = GetVehicleMovement()->GetForwardSpeed();
+	sample.Tick = INDEX_NONE;
+	sample.ExpectedRPM = 0.f;
+	if (bModelready && expectedFuture && expectedFuture->bIsReady && AtTickLocation < expectedFuture->GetNumTicks())
+	{
+		sample.Tick = AtTickLocation;
+		sample.Expected = expectedFuture->GetTransformAtTick(AtTickLocation);
+		sample.ExpectedRPM = expectedFuture->GetRPMAtTick(AtTickLocation);
+		AtTickLocation++;
+	}
+	MonitorSamples.Add(sample);
+
+	// errors found by monitoring steps since the last frame (a step runs after the frame it sampled)
+	if (RunRecorder.IsRecording())
+	{
+		RecordFrame(Delta, currentTransform, MonitorComparedTick, (MonitorErrors & RunFile::ERROR_CAMERA) != 0, (MonitorErrors & RunFile::ERROR_ROTATION) != 0,
+			(MonitorErrors & RunFile::ERROR_RPM) != 0, (MonitorErrors & RunFile::ERROR_LOCATION) != 0);
+	}
+	MonitorErrors = 0;
+	MonitorComparedTick = INDEX_NONE;
+}
+
+void AVehicleAdv3Pawn::TickMonitor(float Delta)
+{
+	// fixed steps, a slow frame catches up on at most MaxCatchUpSteps of them
+	const float step = 1.f / MonitorSettings.Frequency;
+	MonitorAccumulator += Delta;
+	int32 steps = FMath::FloorToInt(MonitorAccumulator / step);
+	if (steps > MonitorSettings.MaxCatchUpSteps)
+	{
+		steps = MonitorSettings.MaxCatchUpSteps;
+		MonitorAccumulator = steps * step;
+	}
+	MonitorAccumulator -= steps * step;
+	if (steps == 0 || MonitorSamples.Num() == 0 || !MonitorSensor)
+	{
+		return;
+	}
+
+	// steps spread over the frames sampled since the last one: at high frame rates frames in between aren't compared,
+	// at low ones no frame is compared twice
+	TArray<FVehicleMonitorResult> results;
+	int32 previous = INDEX_NONE;
+	for (int32 i = 0; i < steps; i++)
+	{
+		const int32 index = (i + 1) * MonitorSamples.Num() / steps - 1;
+		if (index != previous && index >= 0)
 		{
-			GetVehicleMovementComponent()->SetSteeringInput(0.05f + steerAdjust); // generate slight drift right TODO change value?
+			results.Add(MonitorStep(MonitorSamples[index], *MonitorSensor));
+			previous = index;
 		}
-		else
+	}
+	MonitorSamples.Reset();
+
+	if (IsInGameThread())
+	{
+		for (FVehicleMonitorResult& result : results)
 		{
-			GetVehicleMovementComponent()->SetSteeringInput(steerAdjust);
+			ApplyMonitorResult(result);
 		}
-		if (bModelready && expectedFuture->bIsReady)
+		return;
+	}
+	TWeakObjectPtr<AVehicleAdv3Pawn> weakThis(this);
+	AsyncTask(ENamedThreads::GameThread, [weakThis, results]() mutable
+	{
+		if (AVehicleAdv3Pawn* pawn = weakThis.Get())
 		{
-			TArray<FTransform> expected = expectedFuture->GetPath(); 
-			TArray<float> expectedRPM = expectedFuture->GetRMPValues();
-			if (AtTickLocation < expectedRPM.Num())
+			for (FVehicleMonitorResult& result : results)
 			{
-				FTransform expectedTransform = expected[AtTickLocation];
-				FVector expectedLocation = expectedTransform.GetLocation();
-
-				// compare location & check for error (accounting for 4m margin of error on gps irl)
-				float distance = expectedLocation.Dist2D(expectedLocation, currentLocation);
-				if (distance > 800.f && !bLocationErrorFound) // units are in cm, so error is distance > 8m
-				{
-					bLocationErrorFound = true;
-					GEngine->AddOnScreenDebugMessage(-1, 10.f, FColor::FColor(255, 25, 0), FString::Printf(TEXT("Location Error Detected.")));
-				}
-				// compare rotation and check for error
-				float rotationDist = currentRotation.AngularDistance(expectedTransform.GetRotation());
-				if (rotationDist > 0.2f && !bRotationErrorFound)
-				{
-					bRotationErrorFound = true;
-					GEngine->AddOnScreenDebugMessage(-1, 10.f, FColor::Red, FString::Printf(TEXT("Rotation Error Detected.")));
-				}
-				// TODO determine if 1.0 is a good threshold -- TODO figure out why begin with very different values
-				// (NOTE: real like speedometers word by measuring each tire, so when spinning on slippery ground, speed only goes up if all tires are spinning)
-				if (!bRpmErrorFound && FGenericPlatformMath::Abs(expectedRPM[AtTickLocation] - this->GetVehicleMovement()->GetEngineRotationSpeed()) > 90.f) // error threshold set empirically 
-				{
-					GEngine->AddOnScreenDebugMessage(-1, 10.f, FColor::Red, FString::Printf(TEXT("RPM Error Detected.")));
-					bRpmErrorFound = true;
-				}
-				if (bCameraErrorFound || bRotationErrorFound || bRpmErrorFound)
-				{
-					// TODO call asynchronously so as not to hold up tick?
-					ErrorTriage(AtTickLocation, bCameraErrorFound, bRotationErrorFound, bRpmErrorFound, bLocationErrorFound);
-				}
-				AtTickLocation++;
-
-				// TODO only finds error on first iteration...is that desirable?
+				pawn->ApplyMonitorResult(result);
 			}
 		}
+	});
+}
+
+FVehicleMonitorResult AVehicleAdv3Pawn::MonitorStep(const FVehicleMonitorSample& sample, const FLandmarkSensor& sensor)
+{
+	FVehicleMonitorResult result;
+	if (sample.Tick == INDEX_NONE)
+	{
+		return result;
+	}
+	result.ComparedTick = sample.Tick;
+	result.Location = sample.Transform.GetLocation();
+	result.ForwardSpeed = sample.ForwardSpeed;
+	result.ExpectedDistance = FVector::Dist(sample.Expected.GetLocation(), sample.Transform.GetLocation());
+
+	// periodic camera check: landmarks in view of the car against those in view from the expected pose (first sample
+	// in every CameraCheckTicks, and again whenever a new expected future starts over)
+	bool bCameraError = false;
+	const int32 cameraTicks = FMath::Max(MonitorSettings.CameraCheckTicks, 1);
+	if (LastCameraCheckTick == INDEX_NONE || sample.Tick < LastCameraCheckTick || sample.Tick / cameraTicks != LastCameraCheckTick / cameraTicks)
+	{
+		LastCameraCheckTick = sample.Tick;
+		TArray<int32> expectedLandmarks;
+		sensor.Query(sample.Transform, LandmarkSensorSettings, result.Landmarks);
+		sensor.Query(sample.Expected, LandmarkSensorSettings, expectedLandmarks);
+		result.bCameraChecked = true;
+		bCameraError = result.Landmarks != expectedLandmarks;
 	}
 
-	// save path data for copies
-	//if (vehicleType != ECarType::ECT_actual)
-	if (true)
+	FScopedMetricTimer comparisonTimer(SimulationMetric::TickComparisonSeconds);
+	const DetectionCore::FStateError error = DetectionCore::Measure(ToCore(sample.Transform.GetLocation()), ToCore(sample.Transform.GetRotation()), sample.RPM,
+		ToCore(sample.Expected.GetLocation()), ToCore(sample.Expected.GetRotation()), sample.ExpectedRPM);
+	result.Errors = DetectionCore::Classify(error, DetectionThresholds) | DetectionCore::ToErrorFlags(bCameraError, false, false, false);
+	return result;
+}
+
+void AVehicleAdv3Pawn::ApplyMonitorResult(FVehicleMonitorResult& result)
+{
+	if (result.bCameraChecked)
 	{
-		PathLocations.Add(this->GetTransform()); 
-		VelocityAlongPath.Add(this->GetVelocity());
-		RPMAlongPath.Add(GetVehicleMovement()->GetEngineRotationSpeed());
+		SeenLandmarks = MoveTemp(result.Landmarks);
 	}
-	if (vehicleType == ECarType::ECT_prediction || vehicleType == ECarType::ECT_test)
+	if (result.ComparedTick == INDEX_NONE)
 	{
-		GetVehicleMovementComponent()->SetSteeringInput(steerAdjust);
-		AtTickLocation++;
+		return;
+	}
+
+	bool bLocationError = false;
+	bool bRotationError = false;
+	bool bRpmError = false;
+	AnnounceErrors(result.Errors, bLocationError, bRotationError, bRpmError);
+	PredictionScheduler.ObserveTick(result.ExpectedDistance, result.ForwardSpeed);
+	if (DetectionCore::ShouldTriage(result.Errors))
+	{
+		ErrorTriage(result.ComparedTick, result.Location, (result.Errors & RunFile::ERROR_CAMERA) != 0, bRotationError, bRpmError, bLocationError);
 	}
+	MonitorErrors |= result.Errors;
+	MonitorComparedTick = result.ComparedTick;
+}
+
+void AVehicleAdv3Pawn::TickPrediction(float Delta, const FTransform& currentTransform)
+{
+	GetVehicleMovementComponent()->SetSteeringInput(TrackedSteer + steerAdjust);
+	AtTickLocation++;
+}
+
+void AVehicleAdv3Pawn::TickTest(float Delta, const FTransform& currentTransform)
+{
+	TickPrediction(Delta, currentTransform);
 
 	// store performance information at intervals for test runs
-	if (vehicleType==ECarType::ECT_test && horizon==HORIZON && tickAtHorizon < 0) // TODO gets in here more than once because horizon increments on seconds w/timer, but ticks are much faster
+	if (tickAtHorizon < 0 && GetGameTimeSinceCreation() >= TestHorizonSeconds)
 	{
-		tickAtHorizon = AtTickLocation;		
+		tickAtHorizon = AtTickLocation;
 	}
-	/************************************************************************/
+}
 
-	// Setup the flag to say we are in reverse gear
-	bInReverseGear = GetVehicleMovement()->GetCurrentGear() < 0;
-	
-	// Update physics material
-	UpdatePhysicsMaterial();
+void AVehicleAdv3Pawn::TickRecordOnly(float Delta, const FTransform& currentTransform)
+{
+}
 
+void AVehicleAdv3Pawn::TickPresentation()
+{
 	// Update the strings used in the hud (incar and onscreen)
 	UpdateHUDStrings();
 
@@ -483,8 +606,11 @@ void AVehicleAdv3Pawn::BeginPlay()
 	bool bWantInCar = false;
 	// First disable both speed/gear displays 
 	bInCarCameraActive = false;
-	InCarSpeed->SetVisibility(bInCarCameraActive);
-	InCarGear->SetVisibility(bInCarCameraActive);
+	if (InCarSpeed && InCarGear)
+	{
+		InCarSpeed->SetVisibility(bInCarCameraActive);
+		InCarGear->SetVisibility(bInCarCameraActive);
+	}
 
 	// Enable in car view if HMD is attached
 #if HMD_MODULE_INCLUDED
@@ -492,8 +618,19 @@ void AVehicleAdv3Pawn::BeginPlay()
 #endif // HMD_MODULE_INCLUDED
 
 	EnableIncarView(bWantInCar);
-	// Start an engine sound playing
-	EngineSoundComponent->Play();
+	// Start an engine sound playing (clones are spawned as some other role and stay silent)
+	if (vehicleType == ECarType::ECT_actual && EngineSoundComponent)
+	{
+		EngineSoundComponent->Play();
+	}
+	// clones are never possessed, their own Tick sets the inputs
+	if (vehicleType != ECarType::ECT_actual)
+	{
+		if (USimulationVehicleMovementComponent* moveComp = Cast<USimulationVehicleMovementComponent>(GetVehicleMovement()))
+		{
+			moveComp->bDriveWithoutController = true;
+		}
+	}
 
 	/************************************************************************/
 	/*                       New Code                                       */
@@ -505,20 +642,145 @@ void AVehicleAdv3Pawn::BeginPlay()
 	steerAdjust = 0.f;
 	bRunDiagnosticTests = false;
 
-	// setup for input selection during test from output measures
-	InputMapping = NewObject<UInputControlMapping>();
-	InputMapping->init();
+	// input selection during test uses the shared FInputControlMapping, nothing to set up per vehicle
+	if (FParse::Param(FCommandLine::Get(), TEXT("RandomCorrections")))
+	{
+		ControlResponseSettings.bEnabled = false;
+	}
+
+	PredictionCache.SetSettings(PredictionCacheSettings);
+	if (FParse::Param(FCommandLine::Get(), TEXT("OpenLoop")))
+	{
+		PathTrackerSettings.bEnabled = false;
+	}
+	PathTracker.SetSettings(PathTrackerSettings);
+	if (FParse::Param(FCommandLine::Get(), TEXT("NoAnalyticPrediction")))
+	{
+		AnalyticModelSettings.bEnabled = false;
+	}
+	AnalyticModel.SetSettings(AnalyticModelSettings);
+	RunSimilarity.SetSettings(RunSimilaritySettings);
+	if (FParse::Param(FCommandLine::Get(), TEXT("FixedHorizon")))
+	{
+		PredictionSchedulerSettings.bAdaptive = false;
+	}
+	FParse::Value(FCommandLine::Get(), TEXT("PredictionBudgetMs="), PredictionSchedulerSettings.FrameBudgetMs);
+	PredictionScheduler.SetSettings(PredictionSchedulerSettings);
+	horizon = PredictionScheduler.GetHorizon();
+
+	// random streams for candidate sampling
+	int32 seed = RandomSeed;
+	FParse::Value(FCommandLine::Get(), TEXT("Seed="), seed);
+	SessionSeed = seed != 0 ? uint64(uint32(seed)) : FPlatformTime::Cycles64();
+	VehicleStreamId = FCrc::StrCrc32(*GetName());
+	DiagnosticCycle = 0;
+	if (vehicleType == ECarType::ECT_actual)
+	{
+		UE_LOG(ErrorCorrection, Log, TEXT("Session seed %llu (vehicle stream %08x)"), SessionSeed, VehicleStreamId);
+	}
+
+	// detection limits tuned offline (Tools/ErrorEvaluator)
+	FParse::Value(FCommandLine::Get(), TEXT("DetectLocation="), DetectionThresholds.Location);
+	FParse::Value(FCommandLine::Get(), TEXT("DetectRotation="), DetectionThresholds.Rotation);
+	FParse::Value(FCommandLine::Get(), TEXT("DetectRPM="), DetectionThresholds.RPM);
+	FParse::Value(FCommandLine::Get(), TEXT("LandmarkFOV="), LandmarkSensorSettings.HorizontalFOV);
+	FParse::Value(FCommandLine::Get(), TEXT("LandmarkRange="), LandmarkSensorSettings.Range);
+	FParse::Value(FCommandLine::Get(), TEXT("MonitorHz="), MonitorSettings.Frequency);
+	MonitorSettings.Frequency = FMath::Clamp(MonitorSettings.Frequency, 1.f, 240.f);
+	if (FParse::Param(FCommandLine::Get(), TEXT("MonitorOnWorker")))
+	{
+		MonitorSettings.bRunOnWorkerThread = true;
+	}
+	if (vehicleType == ECarType::ECT_actual)
+	{
+		// monitoring ticks after physics, every frame, and steps at its own fixed rate; the actor tick only samples
+		MonitorSensor = &FLandmarkSensor::Get(GetWorld());
+		MonitorTick.Target = this;
+		MonitorTick.bCanEverTick = true;
+		MonitorTick.bStartWithTickEnabled = true;
+		MonitorTick.TickGroup = TG_PostPhysics;
+		MonitorTick.bRunOnAnyThread = MonitorSettings.bRunOnWorkerThread;
+		MonitorTick.AddPrerequisite(this, PrimaryActorTick);
+		MonitorTick.RegisterTickFunction(GetLevel());
+	}
+	if (vehicleType == ECarType::ECT_actual)
+	{
+		// grid over the level's landmarks is built once, up front
+		UE_LOG(ErrorDetection, Log, TEXT("Landmark sensor over %d landmarks"), FLandmarkSensor::Get(GetWorld()).Num());
+		UE_LOG(ErrorCorrection, Log, TEXT("Goal distance field reaches %d cells"), FGoalDistanceField::Get(GetWorld()).GetReachableCells());
+	}
+
+	// skip the target run entirely if this level/start/vehicle setup already has one on disk
+	if (vehicleType == ECarType::ECT_actual && bUseTargetRunCache && !GetTargetRunData())
+	{
+		UWheeledVehicleMovementComponent4W* Vehicle4W = CastChecked<UWheeledVehicleMovementComponent4W>(GetVehicleMovement());
+		TargetRunCacheKey = FTargetRunCache::ComputeKey(GetWorld(), GetActorTransform(), Vehicle4W);
+		FSimulationData cachedRun;
+		if (FTargetRunCache::Load(TargetRunCacheKey, cachedRun))
+		{
+			SetTargetRunData(MoveTemp(cachedRun));
+			UE_LOG(VehicleRunState, Log, TEXT("Using cached target run (%d ticks, %f s)."), GetTargetRunData()->GetNumTicks(), GetTargetRunData()->GetRunTime());
+		}
+	}
+
+	// clones get their own physics scene, nothing in the level has to be changed for them
+	if (FParse::Param(FCommandLine::Get(), TEXT("SharedPhysicsScene")))
+	{
+		bIsolatedPrediction = false;
+	}
+	if ((vehicleType == ECarType::ECT_actual || vehicleType == ECarType::ECT_datagen) && bIsolatedPrediction && !IsA<ASimulationVehiclePawn>())
+	{
+		PredictionWorld = MakeShareable(new FPredictionWorld(GetWorld(), ShadowCollisionChannel));
+	}
+
+	// shadow clones drive through ramps (set once here, the primary keeps colliding with them)
+	if (vehicleType == ECarType::ECT_actual && bShadowPrediction && !PredictionWorld.IsValid())
+	{
+		TArray<AActor*> FoundActors;
+		UGameplayStatics::GetAllActorsOfClass(GetWorld(), ACustomRamp::StaticClass(), FoundActors);
+		for (AActor* ramp : FoundActors)
+		{
+			if (UStaticMeshComponent* mesh = Cast<UStaticMeshComponent>(ramp->GetRootComponent()))
+			{
+				mesh->SetCollisionResponseToChannel(ShadowCollisionChannel, ECR_Ignore);
+			}
+		}
+	}
+	DistanceDriven = 0.f;
+	RunStartWallSeconds = FPlatformTime::Seconds();
+	PreviousLocation = GetActorLocation();
 
 	UE_LOG(VehicleRunState, Log, TEXT("Initial throttle input: %f"), throttleInput);
 	UE_LOG(VehicleRunState, Log, TEXT("Initial steering input: %f"), steerInput);
 
+	BeginRecordOrReplay();
+
+	if (vehicleType == ECarType::ECT_actual)
+	{
+		FSimulationMetrics::Get().StartExport();
+	}
+	else if (vehicleType == ECarType::ECT_prediction || vehicleType == ECarType::ECT_test || vehicleType == ECarType::ECT_target)
+	{
+		FSimulationMetrics::Get().AddGauge(SimulationMetric::LiveClones, 1.0);
+	}
+
+	if (vehicleType == ECarType::ECT_actual && FParse::Param(FCommandLine::Get(), TEXT("RunBenchmarks")))
+	{
+		RunBenchmarks();
+	}
+
 	// timer for horizon (stops simulation after horizon reached) TODO use longer time for hypothesis cars
 	GetWorldTimerManager().SetTimer(HorizonTimerHandle, this, &AVehicleAdv3Pawn::HorizonTimer, 1.0f, true, 0.f);
 
-	// timer for model generation, generates a new model up to HORIZON every HORIZON seconds -- TODO maybe do at different intervals
+	// timer for model generation, PredictionScheduler moves the interval (and horizon) with risk and cost as the run goes
 	if (vehicleType == ECarType::ECT_actual || vehicleType == ECarType::ECT_datagen)
 	{
-		GetWorldTimerManager().SetTimer(GenerateExpectedTimerHandle, this, &AVehicleAdv3Pawn::RunTestOrExpect, float(HORIZON) * 2.f, true, 0.f);
+		if (!bReplaying)
+		{
+			GetWorldTimerManager().SetTimer(GenerateExpectedTimerHandle, this, &AVehicleAdv3Pawn::RunTestOrExpect, PredictionScheduler.GetInterval(), true, 0.f);
+		}
+		FrameSampleCounter = GFrameCounter;
+		FrameSampleSeconds = FPlatformTime::Seconds();
 
 		// set timer to use to time run
 		GetWorldTimerManager().SetTimer(RunTimerHandle, 1000.f, true, 0.f);
@@ -526,47 +788,446 @@ void AVehicleAdv3Pawn::BeginPlay()
 	/************************************************************************/
 }
 
-void AVehicleAdv3Pawn::OnResetVR()
+void AVehicleAdv3Pawn::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-#if HMD_MODULE_INCLUDED
-	if (GEngine->HMDDevice.IsValid())
+	// keep whatever was driven if the run never reached the goal
+	if (RunRecorder.IsRecording())
 	{
-		GEngine->HMDDevice->ResetOrientationAndPosition();
-		InternalCamera->SetRelativeLocation(InternalCameraOrigin);
-		GetController()->SetControlRotation(FRotator());
+		RunRecorder.End();
 	}
-#endif // HMD_MODULE_INCLUDED
+	if (vehicleType == ECarType::ECT_actual && RunCost.HasTarget() && GetWorldTimerManager().IsTimerActive(RunTimerHandle))
+	{
+		UE_LOG(VehicleRunState, Log, TEXT("Run ended before the goal, partial run cost: %f (%d of %d target samples)"), RunCost.GetCost().GetTotal(), RunCost.GetCursor() + 1, RunCost.GetTargetPath().Num());
+	}
+	if (bReplaying && ReplayFrame < RunReplay.Num())
+	{
+		FinishReplay();
+	}
+
+	if (vehicleType == ECarType::ECT_actual)
+	{
+		FSimulationMetrics::Get().StopExport();
+	}
+	else if (vehicleType == ECarType::ECT_prediction || vehicleType == ECarType::ECT_test || vehicleType == ECarType::ECT_target)
+	{
+		FSimulationMetrics::Get().AddGauge(SimulationMetric::LiveClones, -1.0);
+	}
+	if (MonitorTick.IsTickFunctionRegistered())
+	{
+		MonitorTick.UnRegisterTickFunction();
+	}
+	// clones still in there go with it
+	PredictionWorld.Reset();
+
+	Super::EndPlay(EndPlayReason);
 }
 
+void AVehicleAdv3Pawn::BeginRecordOrReplay()
+{
+	if (vehicleType != ECarType::ECT_actual)
+	{
+		return;
+	}
 
-/************************************************************************/
-/*                       New Code                                       */
+	FString filename;
+	if (FParse::Value(FCommandLine::Get(), TEXT("ReplayRun="), filename))
+	{
+		if (!RunReplay.Load(filename))
+		{
+			return;
+		}
+		const RunFile::FRunFileHeader& header = RunReplay.GetHeader();
+		FParse::Value(FCommandLine::Get(), TEXT("ReplayTolerance="), ReplayTolerance);
+
+		// same step every frame as the recording, and don't wait for real time between frames
+		const float step = header.FixedDeltaSeconds > 0.f ? header.FixedDeltaSeconds : RunReplay.GetFrame(0).DeltaSeconds;
+		FApp::SetFixedDeltaTime(step);
+		FApp::SetUseFixedTimeStep(true);
+		FApp::SetBenchmarking(true);
+
+		// start where the recording started
+		const FTransform start(FRunReplay::ToQuat(header.StartRotation), FRunReplay::ToVector(header.StartLocation));
+		if (!start.GetLocation().Equals(GetActorLocation(), ReplayTolerance))
+		{
+			UE_LOG(VehicleRunState, Warning, TEXT("Recording starts %f cm from this car's start, moving car."), FVector::Dist(start.GetLocation(), GetActorLocation()));
+		}
+		SetActorTransform(start, false, nullptr, ETeleportType::TeleportPhysics);
+		SessionSeed = header.SessionSeed;
 
-void AVehicleAdv3Pawn::GenerateTargetRun()
+		bReplaying = true;
+		ReplayFrame = 0;
+		ReplayEvent = 0;
+		ReplayStartWallSeconds = FPlatformTime::Seconds();
+		return;
+	}
+
+	if (FParse::Value(FCommandLine::Get(), TEXT("RecordRun="), filename))
+	{
+		// fixed step so a replay takes exactly the steps the recording took (-RecordFPS=, default 60)
+		if (!FApp::UseFixedTimeStep())
+		{
+			float fps = 60.f;
+			FParse::Value(FCommandLine::Get(), TEXT("RecordFPS="), fps);
+			FApp::SetFixedDeltaTime(1.0 / FMath::Max(fps, 1.f));
+			FApp::SetUseFixedTimeStep(true);
+		}
+
+		RunFile::FRunFileHeader header;
+		FMemory::Memzero(header);
+		header.SessionSeed = SessionSeed;
+		header.FixedDeltaSeconds = float(FApp::GetFixedDeltaTime());
+		header.TargetRunCacheKey = TargetRunCacheKey;
+		FRunReplay::FromVector(GetActorLocation(), header.StartLocation);
+		FRunReplay::FromQuat(GetActorQuat(), header.StartRotation);
+		RunRecorder.Begin(filename, header);
+	}
+}
+
+void AVehicleAdv3Pawn::RecordFrame(float Delta, const FTransform& currentTransform, int32 comparedTick, bool bCameraError, bool bRotationError, bool bRpmError, bool bLocationError)
 {
-	// TODO run until goal and store data
+	UWheeledVehicleMovementComponent* moveComp = GetVehicleMovement();
+
+	RunFile::FRunFrame frame;
+	FMemory::Memzero(frame);
+	frame.DeltaSeconds = Delta;
+	frame.Throttle = AppliedThrottle;
+	frame.Steer = AppliedSteer;
+	frame.DragCoefficient = moveComp->DragCoefficient;
+	frame.Flags = (bGenerateDrift ? RunFile::FRAME_DRIFT : 0)
+		| (bLowFrictionOn ? RunFile::FRAME_LOW_FRICTION : 0)
+		| (bShadowRolloutActive ? RunFile::FRAME_SHADOW_ROLLOUT : 0);
+	frame.Errors = DetectionCore::ToErrorFlags(bCameraError, bRotationError, bRpmError, bLocationError);
+
+	FRunReplay::FromVector(currentTransform.GetLocation(), frame.Location);
+	FRunReplay::FromQuat(currentTransform.GetRotation(), frame.Rotation);
+	FRunReplay::FromVector(GetVelocity(), frame.Velocity);
+	frame.RPM = moveComp->GetEngineRotationSpeed();
+
+	frame.ExpectedTick = comparedTick;
+	const FSimulationData* expectedFuture = GetExpectedFuture();
+	if (expectedFuture && comparedTick != INDEX_NONE)
+	{
+		frame.Flags |= RunFile::FRAME_EXPECTED;
+		const FTransform expected = expectedFuture->GetTransformAtTick(comparedTick);
+		FRunReplay::FromVector(expected.GetLocation(), frame.ExpectedLocation);
+		FRunReplay::FromQuat(expected.GetRotation(), frame.ExpectedRotation);
+		frame.ExpectedRPM = expectedFuture->GetRPMAtTick(comparedTick);
+		FRunReplay::FromVector(dataForSpawn.GetStartPosition().GetLocation(), frame.PredictionStart);
+		FRunReplay::FromVector(expectedFuture->GetTransform().GetLocation(), frame.PredictionEnd);
+	}
+	RunRecorder.AddFrame(frame);
 }
 
-bool AVehicleAdv3Pawn::CheckLandmarkHit(TArray<ALandmark*>* expectedLandmarks, ALandmark* seenLandmark)
+void AVehicleAdv3Pawn::TickReplay()
 {
-	if (!expectedLandmarks)
+	if (ReplayFrame >= RunReplay.Num())
 	{
-		GEngine->AddOnScreenDebugMessage(-1, 10.f, FColor::FColor(255, 0, 0), FString::Printf(TEXT("Error Checking Landmarks - Array is null")));
-		return false;
+		return;
 	}
-	if (expectedLandmarks->Contains(seenLandmark))
+	UWheeledVehicleMovementComponent* moveComp = GetVehicleMovement();
+
+	// freezes and state restores the recorded car went through since the last frame (a freeze only lasts until the
+	// resume after it, which usually comes before the next frame: nothing acts on a frozen car, so it takes no ticks here)
+	while (ReplayEvent < RunReplay.NumEvents() && int32(RunReplay.GetEvent(ReplayEvent).Frame) <= ReplayFrame)
 	{
-		GEngine->AddOnScreenDebugMessage(-1, 10.f, FColor::FColor(0, 255, 75), FString::Printf(TEXT("Landmark Seen!")));
-		return true;
+		const uint8 type = RunReplay.GetEvent(ReplayEvent).Type;
+		if (type == RunFile::EVENT_FREEZE)
+		{
+			GetMesh()->SetAllBodiesSimulatePhysics(false);
+		}
+		else if (type == RunFile::EVENT_RESUME)
+		{
+			GetMesh()->SetAllBodiesSimulatePhysics(true);
+			FVehicleStateSnapshot restored;
+			if (RunReplay.GetEventState(ReplayEvent, restored))
+			{
+				restored.Restore(this);
+			}
+		}
+		ReplayEvent++;
 	}
-	else
+
+	const RunFile::FRunFrame& frame = RunReplay.GetFrame(ReplayFrame);
+	RunReplay.CheckDivergence(ReplayFrame, GetActorTransform(), moveComp->GetEngineRotationSpeed(), ReplayTolerance);
+
+	// faults as they were when recorded
+	const bool bLowFriction = (frame.Flags & RunFile::FRAME_LOW_FRICTION) != 0;
+	if (bLowFriction != bLowFrictionOn)
 	{
-		GEngine->AddOnScreenDebugMessage(-1, 10.f, FColor::FColor(0, 255, 75), FString::Printf(TEXT("Landmark Miss!")));
-		return false;
+		GetMesh()->SetPhysMaterialOverride(bLowFriction ? CustomSlipperyMaterial : nullptr);
+		bLowFrictionOn = bLowFriction;
+	}
+	bGenerateDrift = (frame.Flags & RunFile::FRAME_DRIFT) != 0;
+	moveComp->DragCoefficient = frame.DragCoefficient;
+
+	moveComp->SetThrottleInput(frame.Throttle);
+	moveComp->SetSteeringInput(frame.Steer);
+	PathLocations.Add(GetActorTransform());
+
+	// recording ran this every tick too
+	UpdatePhysicsMaterial();
+
+	ReplayFrame++;
+	if (ReplayFrame == RunReplay.Num())
+	{
+		FinishReplay();
+	}
+}
+
+void AVehicleAdv3Pawn::FinishReplay()
+{
+	double simulatedSeconds = 0.0;
+	for (int32 i = 0; i < ReplayFrame; i++)
+	{
+		simulatedSeconds += RunReplay.GetFrame(i).DeltaSeconds;
+	}
+	const double wallSeconds = FPlatformTime::Seconds() - ReplayStartWallSeconds;
+	UE_LOG(VehicleRunState, Log, TEXT("Replayed %d/%d frames: %f simulated s in %f wall s (%fx)"), ReplayFrame, RunReplay.Num(), simulatedSeconds, wallSeconds, wallSeconds > 0.0 ? simulatedSeconds / wallSeconds : 0.0);
+	UE_LOG(VehicleRunState, Log, TEXT("Replay max error: %f cm, %f rad, %f rpm, first divergent frame %d"), RunReplay.GetMaxLocationError(), RunReplay.GetMaxRotationError(), RunReplay.GetMaxRPMError(), RunReplay.GetFirstDivergentFrame());
+
+	if (FParse::Param(FCommandLine::Get(), TEXT("ReplayExit")))
+	{
+		FPlatformMisc::RequestExit(false);
+	}
+}
+
+void AVehicleAdv3Pawn::RunBenchmarks()
+{
+	// golden inputs from a fixed seed, so every build times (and checksums) exactly the same work
+	const int32 numTicks = 600;
+	FCounterRNG rng(0x5EED, 0, 0, 0);
+	TArray<FTransform> goldenExpected;
+	TArray<FTransform> goldenActual;
+	TArray<FVector> goldenVelocities;
+	TArray<float> goldenRPM;
+	TArray<float> goldenActualRPM;
+	for (int32 i = 0; i < numTicks; i++)
+	{
+		const FVector location(i * 25.f, 400.f * FMath::Sin(i * 0.01f), 0.f);
+		const FQuat rotation(FVector::UpVector, 0.4f * FMath::Cos(i * 0.01f));
+		goldenExpected.Add(FTransform(rotation, location));
+		// actual car slowly drifts off the expected path, so comparisons find errors part of the way
+		const FVector offset(rng.FRandRange(-50.f, 50.f), i * 2.f + rng.FRandRange(-50.f, 50.f), 0.f);
+		goldenActual.Add(FTransform(rotation * FQuat(FVector::UpVector, i * 0.0005f), location + offset));
+		goldenVelocities.Add(FVector(1500.f, 0.f, 0.f));
+		goldenRPM.Add(2000.f + 500.f * FMath::Sin(i * 0.02f));
+		goldenActualRPM.Add(goldenRPM.Last() + i * 0.2f);
+	}
+	FSimulationData goldenRun;
+	goldenRun.Initialize(goldenExpected.Last(), 1, goldenExpected, goldenVelocities, goldenRPM, TrajectoryPrecision);
+	FTestRunData goldenTestRun;
+	goldenTestRun.Initialize(0.1f, 0.2f);
+
+	// landmarks either side of the expected road, so expected and drifting views start to disagree part of the way
+	FLandmarkSensor goldenSensor;
+	TArray<FVector> goldenLandmarks;
+	TArray<bool> goldenLandmarkLeft;
+	for (int32 i = 0; i < numTicks; i += 10)
+	{
+		const FVector side = goldenExpected[i].GetRotation().GetRightVector() * 600.f;
+		goldenLandmarks.Add(goldenExpected[i].GetLocation() - side);
+		goldenLandmarkLeft.Add(true);
+		goldenLandmarks.Add(goldenExpected[i].GetLocation() + side);
+		goldenLandmarkLeft.Add(false);
+	}
+	goldenSensor.Build(goldenLandmarks, goldenLandmarkLeft);
+
+	// road 10 m wide along the expected path, goal at its end, so driving distances follow the road's curves
+	FGoalDistanceField goldenField;
+	{
+		const float cellSize = 100.f;
+		const FVector2D origin(0.f, -1000.f);
+		const int32 gridX = FMath::CeilToInt(numTicks * 25.f / cellSize);
+		const int32 gridY = 20;
+		TArray<float> heights;
+		heights.SetNumUninitialized(gridX * gridY);
+		for (int32 x = 0; x < gridX; x++)
+		{
+			const float roadY = 400.f * FMath::Sin((x + 0.5f) * cellSize / 25.f * 0.01f);
+			for (int32 y = 0; y < gridY; y++)
+			{
+				heights[x * gridY + y] = FMath::Abs(origin.Y + (y + 0.5f) * cellSize - roadY) < 500.f ? 0.f : FGoalDistanceField::UNDRIVABLE;
+			}
+		}
+		goldenField.Build(origin, cellSize, gridX, gridY, heights, { goldenExpected.Last().GetLocation() });
+	}
+
+	FSimulationBenchmark benchmark;
+	benchmark.AddCase(TEXT("Hausdorff"), [&](TArray<float>& outputs)
+	{
+		outputs.Add(Hausdorff(goldenExpected, goldenActual, false));
+		outputs.Add(Hausdorff(goldenExpected, goldenActual, true));
+	});
+	benchmark.AddCase(TEXT("RunCostAccumulator"), [&](TArray<float>& outputs)
+	{
+		// per-tick cost updates over a whole run, read back once a second
+		FRunCostAccumulator accumulator;
+		accumulator.Begin(goldenExpected, numTicks / 60.f);
+		for (int32 tick = 0; tick < numTicks; tick++)
+		{
+			accumulator.AddSample(goldenActual[tick], tick / 60.f);
+			if (tick % 60 == 0)
+			{
+				outputs.Add(accumulator.GetCost().GetTotal());
+			}
+		}
+		const FRunCostTerms terms = accumulator.GetCost();
+		outputs.Add(terms.RunTime);
+		outputs.Add(terms.Location);
+		outputs.Add(terms.Rotation);
+	});
+	benchmark.AddCase(TEXT("CalculateTestCost"), [&](TArray<float>& outputs)
+	{
+		// what calculateTestCost gathers, from golden data: expected end, test car at its horizon, primary where it stopped
+		const int32 horizonTick = numTicks / 2;
+		SCostComponents expected;
+		expected.location = goldenRun.GetTransform().GetLocation();
+		expected.rotation = goldenRun.GetTransform().GetRotation();
+		expected.rpm = goldenRun.GetRPMAtTick(goldenRun.GetNumTicks() - 1);
+		SCostComponents test;
+		test.location = goldenActual[horizonTick].GetLocation();
+		test.rotation = goldenActual[horizonTick].GetRotation();
+		test.rpm = goldenActualRPM[horizonTick];
+		SCostComponents actual;
+		actual.location = goldenActual[0].GetLocation();
+		actual.rotation = goldenActual[0].GetRotation();
+		actual.rpm = goldenActualRPM[0];
+		outputs.Add(TestCost(expected, test, actual, distanceToGoal(goldenField, goldenActual.Last().GetLocation()), goldenTestRun));
+	});
+	benchmark.AddCase(TEXT("InputControlMappingInit"), [&](TArray<float>& outputs)
+	{
+		// deriving transforms and distance buckets from the tables (paid once per process, by the first Get())
+		const FInputControlMapping mapping = FInputControlMapping::Build();
+		outputs.Add(float(mapping.distanceMappings.Num()));
+		for (const TPair<float, TArray<int>>& bucket : mapping.distanceMappings)
+		{
+			outputs.Add(bucket.Key);
+		}
+	});
+	benchmark.AddCase(TEXT("ControlResponseIndex"), [&](TArray<float>& outputs)
+	{
+		// index build plus one lookup per triage outcome
+		const FInputControlMapping& mapping = FInputControlMapping::Get();
+		FControlResponseIndex index;
+		index.Build(mapping.startTransform, mapping.EndTransforms, mapping.Adjustments, mapping.GetNeutralIndex(), FControlResponseSettings());
+		TArray<int32> nearest;
+		for (int32 forward = -1; forward <= 1; forward++)
+		{
+			for (int32 lateral = -1; lateral <= 1; lateral++)
+			{
+				index.FindCorrection(float(forward), float(lateral), nearest);
+				for (int32 i : nearest)
+				{
+					outputs.Add(float(i));
+				}
+			}
+		}
+	});
+	benchmark.AddCase(TEXT("LandmarkSensor"), [&](TArray<float>& outputs)
+	{
+		// what the camera sees from every expected and actual pose, and whether the two views agree
+		const FLandmarkSensorSettings settings;
+		TArray<int32> expectedView;
+		TArray<int32> actualView;
+		for (int32 tick = 0; tick < numTicks; tick++)
+		{
+			goldenSensor.Query(goldenExpected[tick], settings, expectedView);
+			goldenSensor.Query(goldenActual[tick], settings, actualView);
+			outputs.Add(float(expectedView.Num()));
+			outputs.Add(expectedView == actualView ? 1.f : 0.f);
+		}
+	});
+	// analytic model fitted once to the golden run, each case run is one horizon
+	FBicycleModel goldenModel;
+	goldenModel.AddRun(goldenExpected, goldenVelocities, goldenRPM, 1.f / 60.f, 0.5f, 0.f);
+	benchmark.AddCase(TEXT("BicycleModelPredict"), [&](TArray<float>& outputs)
+	{
+		TArray<FTransform> path;
+		TArray<FVector> velocities;
+		TArray<float> rpms;
+		goldenModel.Predict(goldenExpected[0], goldenVelocities[0], FVector::ZeroVector, 5.f, 1.f / 60.f, 0.5f, 0.f, 0.1f, path, velocities, rpms);
+		outputs.Add(path.Last().GetLocation().X);
+		outputs.Add(path.Last().GetLocation().Y);
+		outputs.Add(rpms.Last());
+	});
+	benchmark.AddCase(TEXT("PathTracker"), [&](TArray<float>& outputs)
+	{
+		// per-tick commands following the expected run from the actual run's poses
+		FPathTracker tracker;
+		tracker.Begin(goldenExpected, goldenVelocities);
+		for (int32 tick = 0; tick < numTicks; tick++)
+		{
+			const FPathTrackerCommand command = tracker.Update(goldenActual[tick], goldenVelocities[tick], 1.f / 60.f, DEFAULT_THROTTLE);
+			outputs.Add(command.Steer);
+			outputs.Add(command.Throttle);
+		}
+	});
+	benchmark.AddCase(TEXT("GoalDistanceField"), [&](TArray<float>& outputs)
+	{
+		// lookups calculateTestCost makes, one per candidate end location
+		for (int32 tick = 0; tick < numTicks; tick++)
+		{
+			outputs.Add(goldenField.GetDistance(goldenActual[tick].GetLocation()));
+		}
+	});
+	benchmark.AddCase(TEXT("PresentationTick"), [&](TArray<float>& outputs)
+	{
+		// HUD/camera/audio work only the primary does each tick (clones skip it)
+		for (int32 tick = 0; tick < numTicks; tick++)
+		{
+			TickPresentation();
+		}
+		outputs.Add(float(SpeedDisplayString.ToString().Len()));
+		outputs.Add(float(GearDisplayString.ToString().Len()));
+	});
+	// detection only: CompareWithExpected would also time its on-screen messages
+	benchmark.AddCase(TEXT("PerTickComparison"), [&](TArray<float>& outputs)
+	{
+		for (int32 tick = 0; tick < numTicks; tick++)
+		{
+			const FTransform expected = goldenRun.GetTransformAtTick(tick);
+			const DetectionCore::FStateError error = DetectionCore::Measure(ToCore(goldenActual[tick].GetLocation()), ToCore(goldenActual[tick].GetRotation()), goldenActualRPM[tick],
+				ToCore(expected.GetLocation()), ToCore(expected.GetRotation()), goldenRun.GetRPMAtTick(tick));
+			outputs.Add(float(DetectionCore::Classify(error, DetectionThresholds)));
+		}
+	});
+
+	int32 repetitions = 30;
+	int32 warmup = 3;
+	FString label = TEXT("latest");
+	FParse::Value(FCommandLine::Get(), TEXT("BenchmarkReps="), repetitions);
+	FParse::Value(FCommandLine::Get(), TEXT("BenchmarkWarmup="), warmup);
+	FParse::Value(FCommandLine::Get(), TEXT("BenchmarkLabel="), label);
+	benchmark.Run(FMath::Max(repetitions, 2), FMath::Max(warmup, 0));
+	benchmark.LogSummary();
+	benchmark.Write(label + TEXT(".json"), label);
+
+	if (FParse::Param(FCommandLine::Get(), TEXT("BenchmarkExit")))
+	{
+		FPlatformMisc::RequestExit(false);
+	}
+}
+
+void AVehicleAdv3Pawn::OnResetVR()
+{
+#if HMD_MODULE_INCLUDED
+	if (GEngine->HMDDevice.IsValid() && InternalCamera)
+	{
+		GEngine->HMDDevice->ResetOrientationAndPosition();
+		InternalCamera->SetRelativeLocation(InternalCameraOrigin);
+		GetController()->SetControlRotation(FRotator());
 	}
+#endif // HMD_MODULE_INCLUDED
 }
 
 
+/************************************************************************/
+/*                       New Code                                       */
+
+void AVehicleAdv3Pawn::GenerateTargetRun()
+{
+	// TODO run until goal and store data
+}
 
 void AVehicleAdv3Pawn::RunTestOrExpect()
 {
@@ -574,12 +1235,17 @@ void AVehicleAdv3Pawn::RunTestOrExpect()
 	{
 		return;
 	}
+	// wait for the running shadow rollout before starting anything else
+	if (bShadowRolloutActive)
+	{
+		return;
+	}
 	if (doDataGen)
 	{
 		//GenerateDataCollectionRun();
 	}
 	// see if target run needs to be generated *first*
-	else if (!targetRunData)
+	else if (!GetTargetRunData())
 	{
 		GEngine->AddOnScreenDebugMessage(-1, 5.f, FColor::Orange, TEXT("Generating Target Run."));
 		UE_LOG(VehicleRunState, Log, TEXT("Generating Target Run."));
@@ -600,6 +1266,37 @@ void AVehicleAdv3Pawn::RunTestOrExpect()
 
 void AVehicleAdv3Pawn::GenerateExpected()
 {
+	UWheeledVehicleMovementComponent* moveComp = GetVehicleMovement();
+
+	FVector linearveloctiy = this->GetMesh()->GetPhysicsLinearVelocity();
+	FVector angularvelocity = this->GetMesh()->GetPhysicsAngularVelocity();
+	FTransform currentTransform;
+	//currentTransform = this->GetTransform();
+	currentTransform = this->GetActorTransform();
+	float currRPM = moveComp->GetEngineRotationSpeed();
+	// NOTE Modern automobile engines are typically operated around 2,0003,000 rpm (3350 Hz) when cruising, with a minimum (idle) speed around 750900 rpm (12.515 Hz), and an upper limit anywhere from 4500 to 10,000 rpm (75166 Hz) for a road car
+	// full vehicle state (wheels, gearbox, inputs) for the copy to start from and to resume from
+	dataForSpawn.Capture(this);
+	TrackerAtSpawn = PathTracker;
+	PredictionStartSeconds = FPlatformTime::Seconds();
+
+	// same dynamic state as an earlier rollout: replay it from here instead of spawning a clone
+	if (GetTargetRunData() && UseCachedPrediction(currentTransform, linearveloctiy, angularvelocity, moveComp->GetCurrentGear(), currRPM))
+	{
+		return;
+	}
+	if (GetTargetRunData() && UseAnalyticPrediction(currentTransform, linearveloctiy, angularvelocity, moveComp->GetCurrentGear()))
+	{
+		return;
+	}
+
+	// keep driving, predict with a clone alongside
+	if (bShadowPrediction && GetTargetRunData())
+	{
+		StartShadowPrediction();
+		return;
+	}
+
 	GetWorldTimerManager().PauseTimer(RunTimerHandle);
 
 	GEngine->AddOnScreenDebugMessage(-1, 5.f, FColor::Blue, TEXT("Generating Expected"));
@@ -608,49 +1305,36 @@ void AVehicleAdv3Pawn::GenerateExpected()
 	// begin horizon countdown
 	bGenExpected = true;
 	horizonCountdown = true;
+	horizon = PredictionScheduler.GetHorizon();
 
 	// remove old path data
 	PathLocations.Empty();
 	VelocityAlongPath.Empty();
 
 	this->SetActorTickEnabled(false);
-
-	//possessing new pawn: https://answers.unrealengine.com/questions/109205/c-pawn-possession.html
-	AController* controller = this->GetController(); 
-	this->StoredController = controller;
-
-	UWheeledVehicleMovementComponent* moveComp = GetVehicleMovement();
-
-	FVector linearveloctiy = this->GetMesh()->GetPhysicsLinearVelocity();
-	FVector angularvelocity = this->GetMesh()->GetPhysicsAngularVelocity();
-	FTransform currentTransform;
-	//currentTransform = this->GetTransform();
-	currentTransform = this->GetActorTransform();
-	float currRPM = moveComp->GetEngineRotationSpeed();
-	// NOTE Modern automobile engines are typically operated around 2,0003,000 rpm (3350 Hz) when cruising, with a minimum (idle) speed around 750900 rpm (12.515 Hz), and an upper limit anywhere from 4500 to 10,000 rpm (75166 Hz) for a road car
-	this->ResetRPM = currRPM;
-	this->ResetVelocityLinear = linearveloctiy;
-	this->ResetVelocityAngular = angularvelocity;
-	//NTODONE: pass linearveloctiy et al. by value, these balloons get popped at the end of this scope (})
-	//this->dataForSpawn = UCopyVehicleData::MAKE(linearveloctiy, angularvelocity, currentTransform, moveComp->GetCurrentGear(), currRPM); // TODO HELP HELP HELP why is this null?
-	this->dataForSpawn = NewObject<UCopyVehicleData>();
-	dataForSpawn->Initialize(linearveloctiy, angularvelocity, currentTransform, moveComp->GetCurrentGear(), currRPM);
+	RunRecorder.AddFreeze(GetWorld()->GetTimeSeconds());
 
 	//UWheeledVehicleMovementComponent4W* Vehicle4W = CastChecked<UWheeledVehicleMovementComponent4W>(GetVehicleMovement()); //TODO do something with this...
 
 	// copy primary vehicle to make temp vehicle
-	FActorSpawnParameters params = FActorSpawnParameters();
-	// make sure copy will be flagged as copy
-	this->vehicleType = ECarType::ECT_prediction;
-	// don't copy over altered drag
-	float curdrag = moveComp->DragCoefficient;
-	RevertDragError();
-	params.Template = this;
-	AVehicleAdv3Pawn *copy = GetWorld()->SpawnActor<AVehicleAdv3Pawn>(this->GetClass(), params);
-	if (!targetRunData)
-	{
+	AVehicleAdv3Pawn* copy = nullptr;
+	if (!GetTargetRunData())
+	{
+		// target run is watched: full vehicle, copied from the primary
+		FActorSpawnParameters params = FActorSpawnParameters();
+		// make sure copy will be flagged as copy
+		this->vehicleType = ECarType::ECT_prediction;
+		// don't copy over altered drag
+		float curdrag = moveComp->DragCoefficient;
+		RevertDragError();
+		params.Template = this;
+		copy = GetWorld()->SpawnActor<AVehicleAdv3Pawn>(this->GetClass(), params);
 		copy->vehicleType = ECarType::ECT_target;
 		copy->StoredCopy = this;
+		// reset primary state after copying
+		this->vehicleType = ECarType::ECT_actual;
+		moveComp->DragCoefficient = curdrag;
+		moveComp->SetEngineRotationSpeed(currRPM);
 		// don't want target run to time-out, only stop when goal is reached
 		GetWorldTimerManager().PauseTimer(GenerateExpectedTimerHandle);
 		GetWorldTimerManager().PauseTimer(HorizonTimerHandle);
@@ -658,20 +1342,21 @@ void AVehicleAdv3Pawn::GenerateExpected()
 	}
 	else
 	{
-		copy->vehicleType = ECarType::ECT_prediction;
-	}
-	// reset primary state after copying
-	this->vehicleType = ECarType::ECT_actual;
-	moveComp->DragCoefficient = curdrag;
-	moveComp->SetEngineRotationSpeed(currRPM);
-	if (targetRunData)
-	{
+		copy = SpawnSimulationVehicle(ECarType::ECT_prediction, currentTransform);
+		if (!copy)
+		{
+			ResumeAfterFailedSpawn(TEXT("prediction"));
+			return;
+		}
 		this->StoredCopy = copy;
 	}
 
-	// get all ramps
+	// get all ramps (a clone in the prediction world has its own copies, which already ignore it)
 	TArray<AActor*> FoundActors;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), ACustomRamp::StaticClass(), FoundActors);
+	if (copy->GetWorld() == GetWorld())
+	{
+		UGameplayStatics::GetAllActorsOfClass(GetWorld(), ACustomRamp::StaticClass(), FoundActors);
+	}
 	 //turn off collision for ramps (no collide with simulated vehicle)
 	for (AActor* ramp : FoundActors)
 	{
@@ -688,25 +1373,205 @@ void AVehicleAdv3Pawn::GenerateExpected()
 		}
 	}
 
-	this->GetMesh()->SetAllBodiesSimulatePhysics(false);
+	this->GetMesh()->SetAllBodiesSimulatePhysics(false);
+
+	// copy over state to spawned vehicle (heading already copied with transform)
+	// (clone drives itself, the player controller stays with the primary)
+	dataForSpawn.GetVehicleState().Restore(copy);
+	copy->PathTracker = TrackerAtSpawn;
+	if (copy->vehicleType == ECarType::ECT_prediction)
+	{
+		ShareInputsWith(copy);
+	}
+}
+
+void AVehicleAdv3Pawn::ShareInputsWith(AVehicleAdv3Pawn* copy) const
+{
+	// the primary's commanded inputs (not its drift fault), the ones the cache key and the analytic model predict with
+	copy->throttleInput = throttleInput;
+	copy->throttleAdjust = throttleAdjust;
+	copy->steerAdjust = steerAdjust;
+}
+
+FSimulationData* AVehicleAdv3Pawn::GetTargetRunData()
+{
+	return RunRecords.Simulations.Get(TargetRunHandle);
+}
+
+FSimulationData* AVehicleAdv3Pawn::GetExpectedFuture()
+{
+	return RunRecords.Simulations.Get(ExpectedFutureHandle);
+}
+
+FTestRunData* AVehicleAdv3Pawn::GetTestRun(const FRunRecordHandle& handle)
+{
+	return RunRecords.TestRuns.Get(handle);
+}
+
+void AVehicleAdv3Pawn::SetTargetRunData(FSimulationData&& run)
+{
+	// the target run is the first clean run the analytic model is fitted to
+	if (run.GetNumTicks() > 1)
+	{
+		AnalyticModel.AddRun(run.GetPath(), run.GetVelocities(), run.GetRMPValues(), run.GetRunTime() / run.GetNumTicks(), throttleInput + throttleAdjust, steerAdjust);
+	}
+	RunRecords.Simulations.Release(TargetRunHandle);
+	TargetRunHandle = RunRecords.Simulations.Allocate(MoveTemp(run));
+	PathTracker.Begin(GetTargetRunData()->GetPath(), GetTargetRunData()->GetVelocities());
+}
+
+void AVehicleAdv3Pawn::SetExpectedFuture(FSimulationData&& future)
+{
+	// old prediction is dropped before the new one is stored, so only one is ever live
+	RunRecords.Simulations.Release(ExpectedFutureHandle);
+	ExpectedFutureHandle = RunRecords.Simulations.Allocate(MoveTemp(future));
+}
+
+FRunRecordMemoryReport AVehicleAdv3Pawn::GetRunRecordMemoryReport() const
+{
+	FRunRecordMemoryReport report;
+	report.LiveSimulations = RunRecords.Simulations.NumLive();
+	report.SimulationCapacity = RunRecords.Simulations.GetCapacity();
+	report.SimulationBytes = RunRecords.Simulations.GetAllocatedSize();
+	report.LiveTestRuns = RunRecords.TestRuns.NumLive();
+	report.TestRunCapacity = RunRecords.TestRuns.GetCapacity();
+	report.TestRunBytes = RunRecords.TestRuns.GetAllocatedSize();
+	report.Releases = RunRecords.Simulations.GetTotalReleases() + RunRecords.TestRuns.GetTotalReleases();
+	report.RecordingBytes = PathLocations.GetAllocatedSize() + VelocityAlongPath.GetAllocatedSize() + RPMAlongPath.GetAllocatedSize();
+	report.PredictionCacheBytes = PredictionCache.GetAllocatedSize();
+	return report;
+}
+
+void AVehicleAdv3Pawn::RecordPredictionMetrics(const TCHAR* mode)
+{
+	FSimulationMetrics& metrics = FSimulationMetrics::Get();
+	metrics.Observe(SimulationMetric::PredictionSeconds, FPlatformTime::Seconds() - PredictionStartSeconds);
+	metrics.Increment(SimulationMetric::PredictionsTotal, FString::Printf(TEXT("mode=\"%s\""), mode));
+	metrics.SetGauge(SimulationMetric::TrajectoryBytes, double(GetRunRecordMemoryReport().GetTotalBytes()));
+	UpdatePredictionSchedule();
+}
+
+void AVehicleAdv3Pawn::UpdatePredictionSchedule()
+{
+	const float previousInterval = PredictionScheduler.GetInterval();
+	PredictionScheduler.Update(GetWorld()->GetTimeSeconds());
+
+	FSimulationMetrics& metrics = FSimulationMetrics::Get();
+	metrics.SetGauge(SimulationMetric::PredictionHorizon, PredictionScheduler.GetHorizon());
+	metrics.SetGauge(SimulationMetric::PredictionInterval, PredictionScheduler.GetInterval());
+	metrics.SetGauge(SimulationMetric::PredictionRisk, PredictionScheduler.GetRisk());
+	metrics.SetGauge(SimulationMetric::RolloutFrameCost, PredictionScheduler.GetRolloutFrameCost());
+
+	// restarting the timer also restarts the wait for the next prediction, so only do it for a real change
+	if (FMath::Abs(PredictionScheduler.GetInterval() - previousInterval) >= 0.5f && GetWorldTimerManager().IsTimerActive(GenerateExpectedTimerHandle))
+	{
+		GetWorldTimerManager().SetTimer(GenerateExpectedTimerHandle, this, &AVehicleAdv3Pawn::RunTestOrExpect, PredictionScheduler.GetInterval(), true);
+		UE_LOG(VehicleRunState, Log, TEXT("Predicting %d s ahead every %f s (risk %f)"), PredictionScheduler.GetHorizon(), PredictionScheduler.GetInterval(), PredictionScheduler.GetRisk());
+	}
+}
+
+void AVehicleAdv3Pawn::LogRunRecordMemory() const
+{
+	const FRunRecordMemoryReport report = GetRunRecordMemoryReport();
+	UE_LOG(VehicleRunState, Log, TEXT("Run records: %d/%d simulations (%u B), %d/%d test runs (%u B), %u released, recording %u B, prediction cache %u B, total %u B"),
+		report.LiveSimulations, report.SimulationCapacity, uint32(report.SimulationBytes),
+		report.LiveTestRuns, report.TestRunCapacity, uint32(report.TestRunBytes),
+		report.Releases, uint32(report.RecordingBytes), uint32(report.PredictionCacheBytes), uint32(report.GetTotalBytes()));
+}
+
+bool AVehicleAdv3Pawn::UseCachedPrediction(const FTransform& currentTransform, const FVector& linearVelocity, const FVector& angularVelocity, int32 gear, float rpm)
+{
+	bPredictionKeyPending = false;
+	PredictionToValidate.Empty();
+	if (!PredictionCacheSettings.bEnabled)
+	{
+		return false;
+	}
+
+	// a car following the target run also depends on where it is on it
+	int32 trackerCursor = INDEX_NONE;
+	float crossTrackError = 0.f;
+	if (PathTracker.IsActive())
+	{
+		trackerCursor = PathTracker.FindClosest(currentTransform, crossTrackError);
+	}
+	PendingPredictionKey = PredictionCache.MakeKey(currentTransform, linearVelocity, angularVelocity, gear, rpm, throttleInput + throttleAdjust, steerAdjust, trackerCursor, crossTrackError);
+	bPredictionKeyPending = true;
 
-	// copy over state to spawned vehicle**
-	// get current speed (heading already copied with transform)
-	copy->GetMesh()->SetPhysicsLinearVelocity(linearveloctiy);
-	copy->GetMesh()->SetPhysicsAngularVelocity(angularvelocity);
+	TArray<FTransform> path;
+	TArray<FVector> velocities;
+	TArray<float> rpms;
+	FTransform finalTransform;
+	int32 finalGear;
+	if (!PredictionCache.Find(PendingPredictionKey, currentTransform, path, velocities, rpms, finalTransform, finalGear))
+	{
+		return false;
+	}
+	// periodically do the rollout anyway and measure how far off the cached path was
+	if (PredictionCache.ShouldValidateHit())
+	{
+		PredictionToValidate = path;
+		return false;
+	}
 
-	UWheeledVehicleMovementComponent* copyMoveComp = copy->GetVehicleMovement(); // TODO does this change the original?
-	copyMoveComp->SetTargetGear(moveComp->GetCurrentGear(), true);
+	// NOTE landmarks depend on where the car is, so they aren't reused (camera check is skipped for this prediction)
+	FSimulationData cachedFuture;
+	cachedFuture.Initialize(finalTransform, finalGear, path, velocities, rpms, TrajectoryPrecision);
+	bPredictionKeyPending = false;
+	UE_LOG(VehicleRunState, Log, TEXT("Reusing cached prediction (hit rate %f, %d entries)"), PredictionCache.GetHitRate(), PredictionCache.Num());
+	UseInstantPrediction(MoveTemp(cachedFuture), TEXT("cache"));
+	return true;
+}
 
-	copyMoveComp->SetEngineRotationSpeed(moveComp->GetEngineRotationSpeed());
+bool AVehicleAdv3Pawn::UseAnalyticPrediction(const FTransform& currentTransform, const FVector& linearVelocity, const FVector& angularVelocity, int32 gear)
+{
+	AnalyticToValidate.Empty();
+	AnalyticRPMsToValidate.Empty();
+	if (!AnalyticModelSettings.bEnabled || !AnalyticModel.IsFitted())
+	{
+		return false;
+	}
 
-	// switch controller to temp vehicle <= controller seems like it might auto-transfer... (hard to tell)
-	if (controller)
+	// predicting is cheap: always do it, then either use it or check it against the rollout that follows
+	// (with the tracker the clone would start from, when following the target run)
+	TArray<FTransform> path;
+	TArray<FVector> velocities;
+	TArray<float> rpms;
+	AnalyticModel.Predict(currentTransform, linearVelocity, angularVelocity, PredictionScheduler.GetHorizon(), AverageTickSeconds, throttleInput, throttleAdjust, steerAdjust,
+		path, velocities, rpms, &TrackerAtSpawn);
+	if (path.Num() == 0)
+	{
+		return false;
+	}
+	if (!AnalyticModel.IsValidated() || AnalyticModel.ShouldValidate())
 	{
-		controller->UnPossess(); 
-		controller->Possess(copy);
+		AnalyticToValidate = path;
+		AnalyticRPMsToValidate = rpms;
+		return false;
 	}
-	
+
+	FSimulationData analyticFuture;
+	analyticFuture.Initialize(path.Last(), gear, path, velocities, rpms, TrajectoryPrecision);
+	bPredictionKeyPending = false;
+	UE_LOG(VehicleRunState, Log, TEXT("Using analytic prediction (error vs rollouts %f cm over %d validations)"), AnalyticModel.GetValidationError(), AnalyticModel.GetNumValidations());
+	UseInstantPrediction(MoveTemp(analyticFuture), TEXT("analytic"));
+	return true;
+}
+
+void AVehicleAdv3Pawn::UseInstantPrediction(FSimulationData&& future, const TCHAR* mode)
+{
+	SetExpectedFuture(MoveTemp(future));
+	bModelready = true;
+	RecordPredictionMetrics(mode);
+
+	// same reset as after a rollout
+	AtTickLocation = 0;
+	PathLocations.Empty();
+	VelocityAlongPath.Empty();
+	RPMAlongPath.Empty();
+	bLocationErrorFound = false;
+	bRotationErrorFound = false;
+	InduceSteeringError();
 }
 
 void AVehicleAdv3Pawn::ResumeExpectedSimulation()
@@ -739,52 +1604,46 @@ void AVehicleAdv3Pawn::ResumeExpectedSimulation()
 	{
 		// save results for model checking
 		UWheeledVehicleMovementComponent* movecomp = this->StoredCopy->GetVehicleMovement(); // TODO stored copy is null B/C this isn't the og car!! its the copy!!
-		this->expectedFuture = USimulationData::MAKE(this->StoredCopy->GetTransform(), movecomp->GetCurrentGear(), this->StoredCopy->PathLocations, this->StoredCopy->VelocityAlongPath, this->StoredCopy->RPMAlongPath, this->StoredCopy->LandmarksAlongPath);
-		//this->expectedFuture = NewObject<USimulationData>();
-		// TODO use Initailize() or MAKE()???
-		//this->expectedFuture->Initialize(this->StoredCopy->GetTransform(), movecomp->GetCurrentGear(), this->StoredCopy->PathLocations, this->StoredCopy->VelocityAlongPath, this->StoredCopy->RPMAlongPath, this->StoredCopy->LandmarksAlongPath);
-
+		FSimulationData rollout;
+		rollout.Initialize(this->StoredCopy->GetTransform(), movecomp->GetCurrentGear(), this->StoredCopy->PathLocations, this->StoredCopy->VelocityAlongPath, this->StoredCopy->RPMAlongPath, TrajectoryPrecision);
+		SetExpectedFuture(MoveTemp(rollout));
+		// remember rollout for later predictions from the same dynamic state
+		AddRolloutToPredictionCache(this->StoredCopy);
+		AddRolloutToAnalyticModel(this->StoredCopy);
 		bModelready = true;
+		RecordPredictionMetrics(TEXT("frozen"));
+		FSimulationMetrics::Get().Observe(SimulationMetric::FrozenSeconds, FPlatformTime::Seconds() - PredictionStartSeconds);
 	}
 	
 	// clear timer
 	bGenExpected = false;
 	horizonCountdown = false;
-	horizon = HORIZON;
+	horizon = PredictionScheduler.GetHorizon();
 
 	// resume primary vehicle
 	this->SetActorTickEnabled(true);
-
-	// reset player controller back to primary
-	AController* controller = this->StoredController;
-	// 	Unposses your current pawn(Controller->UnPossess())
-	if (controller)
-	{
-		controller->UnPossess();
-		// 	Re-posses main pawn
-		controller->Possess(this);
-		// restart original pawn
-	}
-	
 	this->GetMesh()->SetAllBodiesSimulatePhysics(true);
-	this->GetMesh()->SetPhysicsLinearVelocity(this->ResetVelocityLinear);
-	this->GetMesh()->SetAllPhysicsAngularVelocity(ResetVelocityAngular);
-	this->GetVehicleMovement()->SetEngineRotationSpeed(this->ResetRPM);
+	dataForSpawn.GetVehicleState().Restore(this);
+	RunRecorder.AddResume(GetWorld()->GetTimeSeconds(), dataForSpawn.GetVehicleState());
+	PathTracker = TrackerAtSpawn;
 	// destroy temp vehicle
 	this->StoredCopy->Destroy(); // TODO look into this more, do I want to destroy this?
 
 	// spawn sphere to show predicted final destination
-	DrawDebugSphere(
-		GetWorld(),
-		this->expectedFuture->GetTransform().GetLocation(), // TODO expectedFuture is null!!
-		40.f,
-		32,
-		FColor(255, 0, 0),
-		false,
-		(HORIZON * 4.f)
-	);
-
-	UE_LOG(VehicleRunState, Log, TEXT("Expected final location: %s"), *this->expectedFuture->GetTransform().GetLocation().ToString());
+	if (FSimulationData* expectedFuture = GetExpectedFuture())
+	{
+		DrawDebugSphere(
+			GetWorld(),
+			expectedFuture->GetTransform().GetLocation(),
+			40.f,
+			32,
+			FColor(255, 0, 0),
+			false,
+			(PredictionScheduler.GetInterval() * 2.f)
+		);
+
+		UE_LOG(VehicleRunState, Log, TEXT("Expected final location: %s"), *expectedFuture->GetTransform().GetLocation().ToString());
+	}
 	// induce drag error
 	/*if (this->GetVehicleMovementComponent()->DragCoefficient < 3000.f)
 	{
@@ -810,6 +1669,219 @@ void AVehicleAdv3Pawn::ResumeExpectedSimulation()
 	bRotationErrorFound = false;
 }
 
+void AVehicleAdv3Pawn::AddRolloutToPredictionCache(AVehicleAdv3Pawn* copy)
+{
+	if (!bPredictionKeyPending)
+	{
+		return;
+	}
+	PredictionCache.Add(PendingPredictionKey, dataForSpawn.GetStartPosition(), copy->PathLocations, copy->VelocityAlongPath, copy->RPMAlongPath, copy->GetTransform(), copy->GetVehicleMovement()->GetCurrentGear());
+	if (PredictionToValidate.Num() > 0)
+	{
+		float cacheError = PredictionCache.RecordValidation(PredictionToValidate, copy->PathLocations);
+		UE_LOG(VehicleRunState, Log, TEXT("Prediction cache error vs rollout: %f cm (mean %f, max %f)"), cacheError, PredictionCache.GetMeanValidationError(), PredictionCache.GetMaxValidationError());
+		PredictionToValidate.Empty();
+	}
+	bPredictionKeyPending = false;
+}
+
+void AVehicleAdv3Pawn::AddRolloutToAnalyticModel(AVehicleAdv3Pawn* copy)
+{
+	if (!AnalyticModelSettings.bEnabled)
+	{
+		return;
+	}
+	if (AnalyticToValidate.Num() > 0)
+	{
+		const float analyticError = AnalyticModel.RecordValidation(AnalyticToValidate, AnalyticRPMsToValidate, copy->PathLocations, copy->RPMAlongPath, DetectionThresholds);
+		UE_LOG(VehicleRunState, Log, TEXT("Analytic prediction error vs rollout: %f cm (running %f, heading/rpm at %f of detection thresholds, %s)"), analyticError, AnalyticModel.GetValidationError(),
+			AnalyticModel.GetValidationThresholdFraction(), AnalyticModel.IsValidated() ? TEXT("validated") : TEXT("not validated"));
+		FSimulationMetrics::Get().SetGauge(SimulationMetric::AnalyticPredictionError, AnalyticModel.GetValidationError());
+		AnalyticToValidate.Empty();
+		AnalyticRPMsToValidate.Empty();
+	}
+	// fitted to the inputs the clone actually drove with (its tracker's, when it followed the target run)
+	AnalyticModel.AddTrackedRun(copy->PathLocations, copy->VelocityAlongPath, copy->RPMAlongPath, AverageTickSeconds, TrackerAtSpawn, copy->throttleInput, copy->throttleAdjust, copy->steerAdjust);
+}
+
+AVehicleAdv3Pawn* AVehicleAdv3Pawn::SpawnSimulationVehicle(ECarType role, const FTransform& transform)
+{
+	// deferred, so the clone's BeginPlay already sees its role
+	UWorld* world = PredictionWorld.IsValid() ? PredictionWorld->GetWorld() : GetWorld();
+	ASimulationVehiclePawn* copy = world->SpawnActorDeferred<ASimulationVehiclePawn>(ASimulationVehiclePawn::StaticClass(), transform, nullptr, nullptr, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+	if (!copy)
+	{
+		return nullptr;
+	}
+	copy->vehicleType = role;
+	UGameplayStatics::FinishSpawningActor(copy, transform);
+
+	if (PredictionWorld.IsValid())
+	{
+		// predictions drive through the ramp copies (test and datagen runs hit them), wheel raycasts follow the body's channel
+		if (role == ECarType::ECT_prediction)
+		{
+			copy->GetMesh()->SetCollisionObjectType(ShadowCollisionChannel);
+			copy->GetVehicleMovement()->RecreatePhysicsState();
+		}
+	}
+	return copy;
+}
+
+void AVehicleAdv3Pawn::ResumeAfterFailedSpawn(const TCHAR* runName)
+{
+	UE_LOG(VehicleRunState, Warning, TEXT("Couldn't spawn %s vehicle, resuming."), runName);
+	bGenExpected = false;
+	horizonCountdown = false;
+	horizon = PredictionScheduler.GetHorizon();
+
+	// nothing was simulated, so the primary carries on from where it stopped (not from dataForSpawn)
+	this->SetActorTickEnabled(true);
+	this->GetMesh()->SetAllBodiesSimulatePhysics(true);
+	FVehicleStateSnapshot state;
+	state.Capture(this);
+	RunRecorder.AddResume(GetWorld()->GetTimeSeconds(), state);
+
+	GetWorldTimerManager().UnPauseTimer(RunTimerHandle);
+	GetWorldTimerManager().UnPauseTimer(GenerateExpectedTimerHandle);
+}
+
+void AVehicleAdv3Pawn::StartShadowPrediction()
+{
+	UE_LOG(VehicleRunState, Log, TEXT("Generating Expected (shadow)"));
+
+	// begin horizon countdown (primary isn't paused, prediction tick 0 is the primary's next sample)
+	bGenExpected = true;
+	horizonCountdown = true;
+	horizon = PredictionScheduler.GetHorizon();
+	bShadowRolloutActive = true;
+	ShadowSnapshotSample = PathLocations.Num();
+
+	// simulation-only copy of the primary (starts with default drag/friction, state is restored below)
+	AVehicleAdv3Pawn* copy = SpawnSimulationVehicle(ECarType::ECT_prediction, dataForSpawn.GetStartPosition());
+	if (!copy)
+	{
+		UE_LOG(VehicleRunState, Warning, TEXT("Couldn't spawn shadow prediction vehicle."));
+		bGenExpected = false;
+		horizonCountdown = false;
+		bShadowRolloutActive = false;
+		return;
+	}
+	this->StoredCopy = copy;
+
+	// in the level the clone overlaps the primary: ignore it (and other clones), ramps ignore the clone's channel
+	// (SpawnSimulationVehicle already set a prediction world clone up)
+	if (!PredictionWorld.IsValid())
+	{
+		USkeletalMeshComponent* copyMesh = copy->GetMesh();
+		copyMesh->SetCollisionObjectType(ShadowCollisionChannel);
+		copyMesh->SetCollisionResponseToChannel(ECC_Vehicle, ECR_Ignore);
+		copyMesh->SetCollisionResponseToChannel(ShadowCollisionChannel, ECR_Ignore);
+		// wheel raycast filters are built with the vehicle, rebuild them for the new channel
+		copy->GetVehicleMovement()->RecreatePhysicsState();
+	}
+
+	// copy over state to spawned vehicle (heading already copied with transform)
+	dataForSpawn.GetVehicleState().Restore(copy);
+	copy->PathTracker = TrackerAtSpawn;
+	ShareInputsWith(copy);
+}
+
+void AVehicleAdv3Pawn::FinishShadowPrediction()
+{
+	AVehicleAdv3Pawn* copy = this->StoredCopy;
+
+	// build new prediction in the back buffer while the current one is still in use
+	UWheeledVehicleMovementComponent* movecomp = copy->GetVehicleMovement();
+	FSimulationData rollout;
+	rollout.Initialize(copy->GetTransform(), movecomp->GetCurrentGear(), copy->PathLocations, copy->VelocityAlongPath, copy->RPMAlongPath, TrajectoryPrecision);
+	RunRecords.Simulations.Release(PendingFutureHandle);
+	PendingFutureHandle = RunRecords.Simulations.Allocate(MoveTemp(rollout));
+	AddRolloutToPredictionCache(copy);
+	AddRolloutToAnalyticModel(copy);
+
+	// destroy temp vehicle
+	copy->Destroy();
+
+	// swap buffers in one step, then drop the old prediction
+	Swap(ExpectedFutureHandle, PendingFutureHandle);
+	RunRecords.Simulations.Release(PendingFutureHandle);
+	bModelready = true;
+	RecordPredictionMetrics(TEXT("shadow"));
+
+	// clear timer
+	bGenExpected = false;
+	horizonCountdown = false;
+	horizon = PredictionScheduler.GetHorizon();
+	bShadowRolloutActive = false;
+
+	// reset for error detection
+	bLocationErrorFound = false;
+	bRotationErrorFound = false;
+
+	// primary kept driving: prediction tick k lines up with the primary's k-th sample since the snapshot
+	FSimulationData* expectedFuture = GetExpectedFuture();
+	const int32 ticksSinceSnapshot = FMath::Max(0, PathLocations.Num() - ShadowSnapshotSample);
+	if (expectedFuture)
+	{
+		// check ticks already driven against the new prediction
+		const int32 numToCheck = FMath::Min(ticksSinceSnapshot, expectedFuture->GetNumTicks());
+		bool bLocationError = false;
+		bool bRotationError = false;
+		bool bRpmError = false;
+		for (int32 tick = 0; tick < numToCheck; tick++)
+		{
+			const int32 sample = ShadowSnapshotSample + tick;
+			CompareWithExpected(*expectedFuture, tick, PathLocations[sample], RPMAlongPath[sample], bLocationError, bRotationError, bRpmError);
+			if (DetectionCore::ShouldTriage(DetectionCore::ToErrorFlags(false, bRotationError, bRpmError, bLocationError)))
+			{
+				ErrorTriage(tick, PathLocations[sample].GetLocation(), false, bRotationError, bRpmError, bLocationError);
+				break;
+			}
+		}
+
+		DrawDebugSphere(GetWorld(), expectedFuture->GetTransform().GetLocation(), 40.f, 32, FColor(255, 0, 0), false, PredictionScheduler.GetInterval() * 2.f);
+		UE_LOG(VehicleRunState, Log, TEXT("Expected final location: %s (%d ticks driven during rollout)"), *expectedFuture->GetTransform().GetLocation().ToString(), ticksSinceSnapshot);
+	}
+	AtTickLocation = ticksSinceSnapshot;
+
+	InduceSteeringError();
+
+	// empty information before next run
+	PathLocations.Empty();
+	VelocityAlongPath.Empty();
+	RPMAlongPath.Empty();
+}
+
+void AVehicleAdv3Pawn::CompareWithExpected(const FSimulationData& expected, int32 tick, const FTransform& actual, float actualRPM, bool& bLocationError, bool& bRotationError, bool& bRpmError) const
+{
+	const FTransform expectedTransform = expected.GetTransformAtTick(tick);
+	const DetectionCore::FStateError error = DetectionCore::Measure(ToCore(actual.GetLocation()), ToCore(actual.GetRotation()), actualRPM, ToCore(expectedTransform.GetLocation()), ToCore(expectedTransform.GetRotation()), expected.GetRPMAtTick(tick));
+	AnnounceErrors(DetectionCore::Classify(error, DetectionThresholds), bLocationError, bRotationError, bRpmError);
+}
+
+void AVehicleAdv3Pawn::AnnounceErrors(uint8 errors, bool& bLocationError, bool& bRotationError, bool& bRpmError) const
+{
+	// location (accounting for 4m margin of error on gps irl)
+	if ((errors & RunFile::ERROR_LOCATION) && !bLocationError)
+	{
+		bLocationError = true;
+		GEngine->AddOnScreenDebugMessage(-1, 10.f, FColor::FColor(255, 25, 0), FString::Printf(TEXT("Location Error Detected.")));
+	}
+	if ((errors & RunFile::ERROR_ROTATION) && !bRotationError)
+	{
+		bRotationError = true;
+		GEngine->AddOnScreenDebugMessage(-1, 10.f, FColor::Red, FString::Printf(TEXT("Rotation Error Detected.")));
+	}
+	// TODO figure out why begin with very different values
+	// (NOTE: real like speedometers word by measuring each tire, so when spinning on slippery ground, speed only goes up if all tires are spinning)
+	if ((errors & RunFile::ERROR_RPM) && !bRpmError)
+	{
+		GEngine->AddOnScreenDebugMessage(-1, 10.f, FColor::Red, FString::Printf(TEXT("RPM Error Detected.")));
+		bRpmError = true;
+	}
+}
+
 void AVehicleAdv3Pawn::ResumeTargetRun()
 {
 	GEngine->AddOnScreenDebugMessage(-1, 5.f, FColor::Orange, TEXT("RESUME FROM TARGET RUN"));
@@ -839,28 +1911,19 @@ void AVehicleAdv3Pawn::ResumeTargetRun()
 	// clear timer
 	bGenExpected = false;
 	horizonCountdown = false;
-	horizon = HORIZON;
+	horizon = PredictionScheduler.GetHorizon();
 
-	realcar->targetRunData = this->targetRunData;
+	if (realcar->bUseTargetRunCache && realcar->GetTargetRunData())
+	{
+		FTargetRunCache::Save(realcar->TargetRunCacheKey, *realcar->GetTargetRunData());
+	}
+	FSimulationMetrics::Get().Observe(SimulationMetric::FrozenSeconds, FPlatformTime::Seconds() - realcar->PredictionStartSeconds);
 
 	// resume primary vehicle
 	realcar->SetActorTickEnabled(true);
-
-	// reset player controller back to primary
-	AController* controller = this->StoredController;
-	// 	Unposses your current pawn(Controller->UnPossess())
-	if (controller)
-	{
-		controller->UnPossess();
-		// 	Re-posses main pawn
-		controller->Possess(realcar);
-		// restart original pawn
-	}	
-
 	realcar->GetMesh()->SetAllBodiesSimulatePhysics(true);
-	realcar->GetMesh()->SetPhysicsLinearVelocity(this->ResetVelocityLinear);
-	realcar->GetMesh()->SetAllPhysicsAngularVelocity(ResetVelocityAngular);
-	realcar->GetVehicleMovement()->SetEngineRotationSpeed(this->ResetRPM);
+	realcar->dataForSpawn.GetVehicleState().Restore(realcar);
+	realcar->RunRecorder.AddResume(realcar->GetWorld()->GetTimeSeconds(), realcar->dataForSpawn.GetVehicleState());
 	// destroy temp vehicle
 	this->Destroy();
 
@@ -885,7 +1948,6 @@ void AVehicleAdv3Pawn::ResumeTargetRun()
 	realcar->GetWorldTimerManager().UnPauseTimer(realcar->HorizonTimerHandle);
 	realcar->GetWorldTimerManager().UnPauseTimer(realcar->RunTimerHandle);
 
-	//realcar->GetWorldTimerManager().SetTimer(GenerateExpectedTimerHandle, this, &AVehicleAdv3Pawn::RunTestOrExpect, float(HORIZON) * 2.f, true, 0.f);
 }
 
 
@@ -899,42 +1961,65 @@ void AVehicleAdv3Pawn::GenerateDiagnosticRuns()
 
 	GetWorldTimerManager().PauseTimer(GenerateExpectedTimerHandle);
 	// keep track of when done running tests
+	if (runCount == NUM_TEST_CARS)
+	{
+		// new diagnostic cycle, drop last cycle's candidates
+		RunRecords.TestRuns.ReleaseAll();
+		bestRun.Invalidate();
+		DiagnosticCycle++;
+		DiagnosticCycleStartSeconds = FPlatformTime::Seconds();
+	}
 	runCount--; // resets to original value every time... why?
+	const uint32 candidate = uint32(NUM_TEST_CARS - 1 - runCount);
 	horizonCountdown = true;
-	horizon = 2 * HORIZON; // simulate further into the future
+	horizon = 2 * PredictionScheduler.GetHorizon(); // simulate further into the future
 	this->SetActorTickEnabled(false);
+	RunRecorder.AddFreeze(GetWorld()->GetTimeSeconds());
 
-	AController* controller = this->GetController();
-	this->StoredController = controller;
-	FActorSpawnParameters params = FActorSpawnParameters();
-	UWheeledVehicleMovementComponent* moveComp = GetVehicleMovement();
-	this->vehicleType = ECarType::ECT_test;
-	float curdrag = moveComp->DragCoefficient;
-	RevertDragError();
-	FTransform currentTransform = this->GetActorTransform();
-	params.Template = this;
-	params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-	FTransform relocateBy =  currentTransform.Inverse() * dataForSpawn->GetStartPosition();
-	AVehicleAdv3Pawn *copy = GetWorld()->SpawnActor<AVehicleAdv3Pawn>(this->GetClass(), relocateBy, params);
-
-	copy->vehicleType = ECarType::ECT_test;
-	this->vehicleType = ECarType::ECT_actual;
-	// reset primary state after copying <== TODO bother with this here or after spawning all copies? 
-	moveComp->DragCoefficient = curdrag;
+	AVehicleAdv3Pawn *copy = SpawnSimulationVehicle(ECarType::ECT_test, dataForSpawn.GetStartPosition());
+	if (!copy)
+	{
+		// this candidate wasn't run
+		runCount++;
+		ResumeAfterFailedSpawn(TEXT("diagnostic test"));
+		return;
+	}
+	copy->tickAtHorizon = -1;
+	copy->TestHorizonSeconds = float(PredictionScheduler.GetHorizon());
 	this->GetMesh()->SetAllBodiesSimulatePhysics(false);
-	copy->GetMesh()->SetPhysicsLinearVelocity(dataForSpawn->GetLinearVelocity());
-	copy->GetMesh()->SetPhysicsAngularVelocity(dataForSpawn->GetAngularVelocity());
-	UWheeledVehicleMovementComponent* copyMoveComp = copy->GetVehicleMovement();
-	copyMoveComp->SetTargetGear(moveComp->GetCurrentGear(), true);
-	copyMoveComp->SetEngineRotationSpeed(dataForSpawn->GetRpm());
+	// start test from where the prediction started
+	dataForSpawn.GetVehicleState().Restore(copy, true);
+	copy->PathTracker = TrackerAtSpawn;
 	this->StoredCopy = copy; // TODO make sure copy isn't empty/stored copy is set appropriately
 
-	// TODO_NOW use generated data to pick corrections <-- feels like there is more to this...
-	// will use InputMapping & randomly sample from it
-	TArray<float> keys;
-	InputMapping->distanceMappings.GetKeys(keys);
-	TArray<int> indices = InputMapping->distanceMappings[keys[FMath::RandRange(0, keys.Num() - 1)]];
-	int selectedIndex = indices[FMath::RandRange(0, indices.Num() - 1)];
+	// pick inputs whose recorded response moves the car the way triage says it has to (back from the drift side,
+	// faster if slow/reversed, slower if fast), one of the nearest matches per candidate
+	const float forward = errorDiagnosticResults.bTryThrottle ? float(-FMath::Sign(errorDiagnosticResults.nSpeedDiff)) : 0.f;
+	const float lateral = errorDiagnosticResults.bTrySteer ? float(-errorDiagnosticResults.nDrift) : 0.f;
+	const FInputControlMapping& mapping = FInputControlMapping::Get();
+	int selectedIndex = INDEX_NONE;
+	if (ControlResponseSettings.bEnabled && !ControlResponses.IsBuilt())
+	{
+		ControlResponses.Build(mapping.startTransform, mapping.EndTransforms, mapping.Adjustments, mapping.GetNeutralIndex(), ControlResponseSettings);
+	}
+	if (ControlResponses.IsBuilt() && (forward != 0.f || lateral != 0.f))
+	{
+		TArray<int32> nearest;
+		ControlResponses.FindCorrection(forward, lateral, nearest);
+		if (nearest.Num() > 0)
+		{
+			selectedIndex = nearest[int32(candidate) % nearest.Num()];
+		}
+	}
+	if (selectedIndex == INDEX_NONE)
+	{
+		// direction unknown: sample the mapping at random
+		FCounterRNG rng = MakeCandidateStream(candidate);
+		TArray<float> keys;
+		mapping.distanceMappings.GetKeys(keys);
+		const TArray<int>& indices = mapping.distanceMappings[keys[rng.RandRange(0, keys.Num() - 1)]];
+		selectedIndex = indices[rng.RandRange(0, indices.Num() - 1)];
+	}
 
 	// adjust throttle and steering (TODO maybe move this to sep function)
 	if (errorDiagnosticResults.bTryThrottle)
@@ -956,7 +2041,7 @@ void AVehicleAdv3Pawn::GenerateDiagnosticRuns()
 		//{
 		//	copy->throttleAdjust = FMath::RandRange(-0.02f, 0.02f);
 		//}
-		copy->throttleAdjust = InputMapping->throttle[selectedIndex];
+		copy->throttleAdjust = mapping.GetThrottle(selectedIndex);
 		GEngine->AddOnScreenDebugMessage(-1, 10.f, FColor::Black, FString::Printf(TEXT("TrhottleAdjust %f"), copy->throttleAdjust));
 
 	}
@@ -975,20 +2060,14 @@ void AVehicleAdv3Pawn::GenerateDiagnosticRuns()
 		//	// don't know which way drifting
 		//	copy->steerAdjust = FMath::RandRange(-0.1f, 0.0f); // TODO change these values back
 		//}
-		copy->steerAdjust = InputMapping->steer[selectedIndex];
+		copy->steerAdjust = mapping.GetSteer(selectedIndex);
 		GEngine->AddOnScreenDebugMessage(-1, 20.f, FColor::Black, FString::Printf(TEXT("SteerAdjust %f"), copy->steerAdjust));
 
 	}
 	// store what change we're trying and in resume, what it's corresponding result is
-	//currentRun = UTestRunData::MAKE(steerAdjust, throttleAdjust);
-	currentRun = NewObject<UTestRunData>();
-	currentRun->Initialize(copy->steerAdjust, copy->throttleAdjust);
-	// switch controller to temp vehicle
-	if (controller)
-	{
-		controller->UnPossess(); 
-		controller->Possess(copy);
-	}
+	FTestRunData testRun;
+	testRun.Initialize(copy->steerAdjust, copy->throttleAdjust);
+	currentRun = RunRecords.TestRuns.Allocate(MoveTemp(testRun));
 	if (runCount == 0)
 	{
 		bRunDiagnosticTests = false;
@@ -996,11 +2075,16 @@ void AVehicleAdv3Pawn::GenerateDiagnosticRuns()
 	}
 }
 
+FCounterRNG AVehicleAdv3Pawn::MakeCandidateStream(uint32 candidate) const
+{
+	return FCounterRNG(SessionSeed, VehicleStreamId, DiagnosticCycle, candidate);
+}
+
 void AVehicleAdv3Pawn::ResumeFromDiagnostic()
 {
 	// reset timer
 	horizonCountdown = false; // TODO maybe reset at end?
-	horizon = HORIZON;
+	horizon = PredictionScheduler.GetHorizon();
 
 	// restore steering and throttle to defaults/expected
 	throttleInput = DEFAULT_THROTTLE;
@@ -1008,22 +2092,17 @@ void AVehicleAdv3Pawn::ResumeFromDiagnostic()
 	// resume primary vehicle
 	this->SetActorTickEnabled(true);
 
-	// reset player controller back to primary
-	AController* controller = this->StoredController;
-	if (controller)
-	{
-		// 	Unposses your current pawn(Controller->UnPossess())
-		controller->UnPossess(); 
-		// 	Re-posses main pawn
-		controller->Possess(this);
-	}
 	// restart original pawn
 	this->GetMesh()->SetAllBodiesSimulatePhysics(true);
-	this->GetMesh()->SetPhysicsLinearVelocity(this->ResetVelocityLinear);
-	this->GetMesh()->SetAllPhysicsAngularVelocity(ResetVelocityAngular);
-	this->GetVehicleMovement()->SetEngineRotationSpeed(this->ResetRPM);
+	dataForSpawn.GetVehicleState().Restore(this);
+	RunRecorder.AddResume(GetWorld()->GetTimeSeconds(), dataForSpawn.GetVehicleState());
+	PathTracker = TrackerAtSpawn;
 	// destroy temp vehicle
 
+	if (FTestRunData* testRun = GetTestRun(currentRun))
+	{
+		testRun->hitgoal = this->StoredCopy->bReachedGoal;
+	}
 	float cost = calculateTestCost();
 	UE_LOG(ErrorCorrection, Log, TEXT("Cost for run %i %f"), NUM_TEST_CARS - runCount, cost);
 
@@ -1040,21 +2119,28 @@ void AVehicleAdv3Pawn::ResumeFromDiagnostic()
 	// on last run, apply input adjustments with best result
 	if (runCount == 0)
 	{
-		throttleAdjust = bestRun->GetThrottleChange();
-		steerAdjust = bestRun->GetSteeringChange();
+		if (const FTestRunData* best = GetTestRun(bestRun))
+		{
+			throttleAdjust = best->GetThrottleChange();
+			steerAdjust = best->GetSteeringChange();
+		}
 
 		GEngine->AddOnScreenDebugMessage(-1, 20.f, FColor::Green, FString::Printf(TEXT("SteerAdjust Selected %f"), steerAdjust));
 		GEngine->AddOnScreenDebugMessage(-1, 20.f, FColor::Green, FString::Printf(TEXT("ThrottleAdjust Selected %f"), throttleAdjust));
+		FSimulationMetrics::Get().Observe(SimulationMetric::DiagnosticCycleSeconds, FPlatformTime::Seconds() - DiagnosticCycleStartSeconds);
 
 		// empty information before next run
 		PathLocations.Empty();
 		VelocityAlongPath.Empty();
 		RPMAlongPath.Empty();
+
+		LogRunRecordMemory();
 	}
 	this->StoredCopy->Destroy();
 	
 
 	GetWorldTimerManager().UnPauseTimer(GenerateExpectedTimerHandle);
+	UpdatePredictionSchedule();
 }
 
 void AVehicleAdv3Pawn::GenerateDataCollectionRun()
@@ -1086,59 +2172,26 @@ void AVehicleAdv3Pawn::GenerateDataCollectionRun()
 	VelocityAlongPath.Empty();
 
 	this->SetActorTickEnabled(false);
+	RunRecorder.AddFreeze(GetWorld()->GetTimeSeconds());
 
-	//possessing new pawn: https://answers.unrealengine.com/questions/109205/c-pawn-possession.html
-	AController* controller = this->GetController();
-	this->StoredController = controller;
-
-	UWheeledVehicleMovementComponent* moveComp = GetVehicleMovement();
-
-	FVector linearveloctiy = this->GetMesh()->GetPhysicsLinearVelocity();
-	FVector angularvelocity = this->GetMesh()->GetPhysicsAngularVelocity();
-	FTransform currentTransform;
-	currentTransform = this->GetActorTransform();
-	float currRPM = moveComp->GetEngineRotationSpeed();
-	this->ResetRPM = currRPM;
-	this->ResetVelocityLinear = linearveloctiy;
-	this->ResetVelocityAngular = angularvelocity;
-	//NTODONE: pass linearveloctiy et al. by value, these balloons get popped at the end of this scope (})
-	//this->dataForSpawn = UCopyVehicleData::MAKE(linearveloctiy, angularvelocity, currentTransform, moveComp->GetCurrentGear(), currRPM); // TODO HELP HELP HELP why is this null?
-	this->dataForSpawn = NewObject<UCopyVehicleData>();
-	dataForSpawn->Initialize(linearveloctiy, angularvelocity, currentTransform, moveComp->GetCurrentGear(), currRPM);
+	// full vehicle state (wheels, gearbox, inputs) for the copy to start from and to resume from
+	dataForSpawn.Capture(this);
 
 	// copy primary vehicle to make temp vehicle
-	FActorSpawnParameters params = FActorSpawnParameters();
-	// make sure copy will be flagged as copy
-	this->vehicleType = ECarType::ECT_datagen;
 	doDataGen = false;
-	params.Template = this;
-	AVehicleAdv3Pawn *copy = GetWorld()->SpawnActor<AVehicleAdv3Pawn>(this->GetClass(), params);
-	copy->vehicleType = ECarType::ECT_datagen;
+	AVehicleAdv3Pawn *copy = SpawnSimulationVehicle(ECarType::ECT_datagen, dataForSpawn.GetStartPosition());
+	if (!copy)
+	{
+		ResumeAfterFailedSpawn(TEXT("data collection"));
+		return;
+	}
 	copy->doDataGen = false;
-
-	// reset primary state after copying
-	this->vehicleType = ECarType::ECT_actual;
-	moveComp->DragCoefficient = moveComp->DragCoefficient;
-	moveComp->SetEngineRotationSpeed(currRPM);
 	this->StoredCopy = copy;
 
 	this->GetMesh()->SetAllBodiesSimulatePhysics(false);
 
-	// copy over state to spawned vehicle**
-	// get current speed (heading already copied with transform)
-	copy->GetMesh()->SetPhysicsLinearVelocity(linearveloctiy);
-	copy->GetMesh()->SetPhysicsAngularVelocity(angularvelocity);
-
-	UWheeledVehicleMovementComponent* copyMoveComp = copy->GetVehicleMovement(); // TODO does this change the original?
-	copyMoveComp->SetTargetGear(moveComp->GetCurrentGear(), true);
-	copyMoveComp->SetEngineRotationSpeed(moveComp->GetEngineRotationSpeed());
-
-	// switch controller to temp vehicle <= controller seems like it might auto-transfer... (hard to tell)
-	if (controller)
-	{
-		controller->UnPossess();
-		controller->Possess(copy);
-	}
+	// copy over state to spawned vehicle (heading already copied with transform)
+	dataForSpawn.GetVehicleState().Restore(copy);
 
 	// set to next inputs to try
 	copy->throttleInput = throttleInputs[controlInputIndex];
@@ -1160,26 +2213,14 @@ void AVehicleAdv3Pawn::ResumeFromDataGen()
 	// clear timer
 	bGenExpected = false;
 	horizonCountdown = false;
-	horizon = HORIZON;
+	horizon = PredictionScheduler.GetHorizon();
 
 	// resume primary vehicle
 	this->SetActorTickEnabled(true);
 
-	// reset player controller back to primary
-	AController* controller = this->StoredController;
-	// 	Unposses your current pawn(Controller->UnPossess())
-	if (controller)
-	{
-		controller->UnPossess();
-		// 	Re-posses main pawn
-		controller->Possess(this);
-		// restart original pawn
-	}
-
 	this->GetMesh()->SetAllBodiesSimulatePhysics(true);
-	this->GetMesh()->SetPhysicsLinearVelocity(this->ResetVelocityLinear);
-	this->GetMesh()->SetAllPhysicsAngularVelocity(ResetVelocityAngular);
-	this->GetVehicleMovement()->SetEngineRotationSpeed(this->ResetRPM);
+	dataForSpawn.GetVehicleState().Restore(this);
+	RunRecorder.AddResume(GetWorld()->GetTimeSeconds(), dataForSpawn.GetVehicleState());
 								 
 	GetWorldTimerManager().UnPauseTimer(RunTimerHandle);
 
@@ -1192,32 +2233,41 @@ void AVehicleAdv3Pawn::ResumeFromDataGen()
 
 float AVehicleAdv3Pawn::calculateTestCost()
 {
-	// Weight performance at various intervals (horizon & 2xhorizon(end) for now)
-	float endWeight = 0.5f;
-	float horizonWeight = 1.f;
-
 	// TODO get performance at horizon TODO do we even have all the info we need?
 	SCostComponents test;
 	SCostComponents expected;
 	SCostComponents actual;
-	expected.location = this->expectedFuture->GetTransform().GetLocation(); // (note: horizon will still be last in sequence for non-test cars)
+	const FSimulationData* expectedFuture = GetExpectedFuture();
+	const FTestRunData* testRun = GetTestRun(currentRun);
+	if (!expectedFuture || !testRun)
+	{
+		return MAX_flt;
+	}
+	expected.location = expectedFuture->GetTransform().GetLocation(); // (note: horizon will still be last in sequence for non-test cars)
 	test.location = StoredCopy->PathLocations[StoredCopy->tickAtHorizon].GetLocation();
 	actual.location = this->GetActorTransform().GetLocation();
 	expected.rotation = expectedFuture->GetTransform().GetRotation();
 	test.rotation = StoredCopy->PathLocations[StoredCopy->tickAtHorizon].GetRotation();
 	actual.rotation = this->GetTransform().GetRotation();
-	expected.rpm = expectedFuture->GetRMPValues().Last();
+	expected.rpm = expectedFuture->GetRPMAtTick(expectedFuture->GetNumTicks() - 1);
 	test.rpm = StoredCopy->RPMAlongPath[StoredCopy->tickAtHorizon];
 	actual.rpm = this->GetVehicleMovementComponent()->GetEngineRotationSpeed();
-	float lossHorizon = QuadraticLoss(expected, test, actual);
 
 	// performance at 2x horizon: look at proximity to goal
 	FVector endLocationTest = StoredCopy->GetTransform().GetLocation();
-	float lossEnd = distanceToGoal(endLocationTest);
+	return TestCost(expected, test, actual, distanceToGoal(endLocationTest), *testRun);
+}
+
+float AVehicleAdv3Pawn::TestCost(const SCostComponents& expected, const SCostComponents& test, const SCostComponents& actual, float lossEnd, const FTestRunData& testRun)
+{
+	// Weight performance at various intervals (horizon & 2xhorizon(end) for now)
+	float endWeight = 0.5f;
+	float horizonWeight = 1.f;
 
-	float reg = Regularize(currentRun->GetThrottleChange(), currentRun->GetSteeringChange());
+	float lossHorizon = QuadraticLoss(expected, test, actual);
+	float reg = Regularize(testRun.GetThrottleChange(), testRun.GetSteeringChange());
 	float goalBonus = 0.f;
-	if (currentRun->hitgoal)
+	if (testRun.hitgoal)
 	{
 		goalBonus = 10.f;
 	}
@@ -1226,19 +2276,18 @@ float AVehicleAdv3Pawn::calculateTestCost()
 
 TArray<float>* AVehicleAdv3Pawn::RotationErrorInfo(int index)
 {
-	TArray<float>* results = new TArray<float>;
-
+	const FSimulationData* expectedFuture = GetExpectedFuture();
 	if (!expectedFuture)
 	{ 
 		return nullptr;
 	}
-	TArray<FTransform> expected = expectedFuture->GetPath();
+	TArray<float>* results = new TArray<float>;
 	FTransform currentTransform = this->GetTransform();
 	FQuat currentRotation = currentTransform.GetRotation();
 	FTransform expectedTransform;
-	if (AtTickLocation < expected.Num())
+	if (AtTickLocation < expectedFuture->GetNumTicks())
 	{
-		expectedTransform = expected[AtTickLocation];
+		expectedTransform = expectedFuture->GetTransformAtTick(AtTickLocation);
 	}
 	else
 	{
@@ -1269,38 +2318,40 @@ TArray<int>* AVehicleAdv3Pawn::CameraErrorInfo(int index)
 	int missingLeft = 0;
 	int extraRight = 0;
 	int extraLeft = 0;
-	//NTODONE: investigate returning this by value
-	TArray<ALandmark*> landmarks = expectedFuture->GetLandmarksAtTick(index);
-	for (int i = 0; i < outputArray.Num(); i++)
+	const FSimulationData* expectedFuture = GetExpectedFuture();
+	if (expectedFuture && expectedFuture->bIsReady && index < expectedFuture->GetNumTicks())
 	{
-		ALandmark* lmhit = Cast<ALandmark>(outputArray[i].GetActor());
-		if (lmhit->IsValidLowLevelFast())
+		const FLandmarkSensor& sensor = FLandmarkSensor::Get(GetWorld());
+		TArray<int32> expectedLandmarks;
+		sensor.Query(expectedFuture->GetTransformAtTick(index), LandmarkSensorSettings, expectedLandmarks);
+
+		// both views are sorted ids: walk them together
+		int32 seen = 0;
+		int32 expected = 0;
+		while (seen < SeenLandmarks.Num() || expected < expectedLandmarks.Num())
 		{
-			if (expectedFuture->bIsReady)
+			const int32 seenId = seen < SeenLandmarks.Num() ? SeenLandmarks[seen] : MAX_int32;
+			const int32 expectedId = expected < expectedLandmarks.Num() ? expectedLandmarks[expected] : MAX_int32;
+			if (seenId == expectedId)
+			{
+				seen++;
+				expected++;
+			}
+			else if (seenId < expectedId)
 			{
 				// seeing things we shouldn't
-				if (!landmarks.Contains(lmhit))
-				{
-					UE_LOG(ErrorDetection, Log, TEXT("Landmark hit unexpected: %s"), *lmhit->GetHumanReadableName());
-					(lmhit->IsOnLeft()) ? extraLeft++ : extraRight++;
-				}
-				else
-				{
-					// remove seen landmark so we can check what's missing at end
-					UE_LOG(ErrorDetection, Log, TEXT("Landmark hit expected: %s"), *lmhit->GetHumanReadableName());
-					landmarks.Remove(lmhit);
-				}
+				UE_LOG(ErrorDetection, Log, TEXT("Landmark hit unexpected: %d"), seenId);
+				(sensor.IsOnLeft(seenId)) ? extraLeft++ : extraRight++;
+				seen++;
+			}
+			else
+			{
+				UE_LOG(ErrorDetection, Log, TEXT("Landmark miss: %d"), expectedId);
+				(sensor.IsOnLeft(expectedId)) ? missingLeft++ : missingRight++;
+				expected++;
 			}
 		}
 	}
-	for (int i = 0; i < landmarks.Num(); i++)
-	{
-		ALandmark* lm = landmarks[i];
-		UE_LOG(ErrorDetection, Log, TEXT("Landmark miss: %s"), *lm->GetHumanReadableName());
-		(lm->IsOnLeft()) ? missingLeft++ : missingRight++;
-	}
-	// free up memory RTODO: cannot delete since no longer pointer; also how does this now affect ballon problem
-	//delete landmarks; 
 
 	TArray<int>* results = new TArray<int>;
 	results->Add(missingRight);
@@ -1312,41 +2363,15 @@ TArray<int>* AVehicleAdv3Pawn::CameraErrorInfo(int index)
 
 int AVehicleAdv3Pawn::GetSideOfLine(FVector a, FVector b, FVector m)
 {
-	return FMath::Sign((b.X - a.X) * (m.Y - a.Y) - (b.Y - a.Y) * (m.X - a.X));
+	return DetectionCore::SideOfLine(ToCore(a), ToCore(b), ToCore(m));
 }
 
 int AVehicleAdv3Pawn::GetFastOrSlow(FVector start, FVector goal, FVector expected, FVector m)
 {
-	float dstartM = FVector::DistSquaredXY(start, m);
-	float dstartE = FVector::DistSquaredXY(start, expected);
-	float dgoalM = FVector::DistSquaredXY(goal, m);
-	float dgoalE = FVector::DistSquaredXY(goal, expected);
-	float dstartGoal = FVector::DistSquaredXY(start, goal);
-
-	// if start is closer to goal than m then could be reversed
-	if (dstartGoal < FVector::DistSquaredXY(m, goal))
-	{
-		return -2;
-	}
-	// if goal is closer to start than m probably too fast
-	if (dstartGoal < FVector::DistSquaredXY(m, start))
-	{
-		return 1;
-	}
-	// if m is closer to start than expected then too slow
-	if (dstartM < dstartE)
-	{
-		return -1;
-	}
-	// if m is closer to goal than expected then too fast
-	if (dgoalM < dgoalE)
-	{
-		return 1;
-	}
-	return 0;
+	return DetectionCore::FastOrSlow(ToCore(start), ToCore(goal), ToCore(expected), ToCore(m));
 }
 
-void AVehicleAdv3Pawn::ErrorTriage(int index, bool cameraError, bool headingError, bool rpmError, bool locationError)
+void AVehicleAdv3Pawn::ErrorTriage(int index, const FVector& actualLocation, bool cameraError, bool headingError, bool rpmError, bool locationError)
 {
 	/* decide if likely throttle fixable or steering fixable
 	 * TODO maybe make a guess if self or environment?
@@ -1361,58 +2386,52 @@ void AVehicleAdv3Pawn::ErrorTriage(int index, bool cameraError, bool headingErro
 	}
 	bRunDiagnosticTests = true;
 	runCount = NUM_TEST_CARS;
+	PredictionScheduler.NotifyFault(GetWorld()->GetTimeSeconds());
 
 	// clear errorDiagnosticResults to make sure it doesn't carry over information
 	errorDiagnosticResults.Reset();
 
+	// landmark misses/extras by side tell which way the car drifted
+	DetectionCore::FCameraMisses cameraMisses = { 0, 0, 0, 0 };
 	if (cameraError)
 	{
-		// check seen object differences
 		TArray<int>* camerainfo = CameraErrorInfo(index);
-
-		if (camerainfo->operator[](0) < camerainfo->operator[](1) || camerainfo->operator[](2) < camerainfo->operator[](3))
-		{
-			errorDiagnosticResults.nDrift = RIGHT;
-		}
-		if (camerainfo->operator[](0) > camerainfo->operator[](1) || camerainfo->operator[](2) > camerainfo->operator[](3))
-		{
-			errorDiagnosticResults.nDrift = LEFT;
-		}
-		errorDiagnosticResults.bTryThrottle = true;
-		errorDiagnosticResults.bTrySteer = true;
+		cameraMisses = { (*camerainfo)[0], (*camerainfo)[1], (*camerainfo)[2], (*camerainfo)[3] };
 
 		// make sure memory is freed
 		delete camerainfo;
 	}
-	if (headingError)
-	{
-		// TODO do more with angle difference etc.
-		errorDiagnosticResults.bTrySteer = true;
-
-		// check how heading differs
-		/*TArray<float>* rotationInfo = RotationErrorInfo(index);
-		float angDist = rotationInfo->operator[](0);
-		float veering = rotationInfo->operator[](1);
-		float dotprod = rotationInfo->operator[](2);
-		// free up memory
-		delete rotationInfo;*/
-	}
-	if (locationError)
-	{
-		errorDiagnosticResults.bTryThrottle = true;
-		errorDiagnosticResults.bTrySteer = true;
-		// check if left/right drift
-		// TODO what to do if drift already defined and disagree...
-		errorDiagnosticResults.nDrift = GetSideOfLine(dataForSpawn->GetStartPosition().GetLocation(), expectedFuture->GetPath()[AtTickLocation].GetLocation(), this->GetActorLocation());
-		// check too fast/slow
-		errorDiagnosticResults.nSpeedDiff = GetFastOrSlow(dataForSpawn->GetStartPosition().GetLocation(), expectedFuture->GetTransform().GetLocation(), expectedFuture->GetPath()[AtTickLocation].GetLocation(), this->GetActorLocation());
+	// TODO do more with heading angle difference etc. (RotationErrorInfo)
+
+	// location/rpm: which side of the expected line the car is on and whether it's ahead or behind
+	const FSimulationData* expectedFuture = GetExpectedFuture();
+	FVector start = FVector::ZeroVector;
+	FVector goal = FVector::ZeroVector;
+	FVector expected = FVector::ZeroVector;
+	const bool bHasExpected = expectedFuture && index >= 0 && index < expectedFuture->GetNumTicks();
+	if (bHasExpected)
+	{
+		start = dataForSpawn.GetStartPosition().GetLocation();
+		goal = expectedFuture->GetTransform().GetLocation();
+		expected = expectedFuture->GetLocationAtTick(index);
 	}
-	if (rpmError)
+
+	const uint8 errors = DetectionCore::ToErrorFlags(cameraError, headingError, rpmError, locationError);
+	const TCHAR* errorLabels[] = { TEXT("error=\"camera\""), TEXT("error=\"rotation\""), TEXT("error=\"rpm\""), TEXT("error=\"location\"") };
+	const uint8 errorFlags[] = { RunFile::ERROR_CAMERA, RunFile::ERROR_ROTATION, RunFile::ERROR_RPM, RunFile::ERROR_LOCATION };
+	for (int32 i = 0; i < ARRAY_COUNT(errorFlags); i++)
 	{
-		errorDiagnosticResults.bTryThrottle = true;
-		errorDiagnosticResults.nSpeedDiff = GetFastOrSlow(dataForSpawn->GetStartPosition().GetLocation(), expectedFuture->GetTransform().GetLocation(), expectedFuture->GetPath()[AtTickLocation].GetLocation(), this->GetActorLocation());
-		errorDiagnosticResults.nDrift = GetSideOfLine(dataForSpawn->GetStartPosition().GetLocation(), expectedFuture->GetPath()[AtTickLocation].GetLocation(), this->GetActorLocation());
+		if (errors & errorFlags[i])
+		{
+			FSimulationMetrics::Get().Increment(SimulationMetric::TriageTotal, errorLabels[i]);
+		}
 	}
+
+	const DetectionCore::FTriage triage = DetectionCore::Triage(errors, cameraError ? &cameraMisses : nullptr, bHasExpected, ToCore(start), ToCore(goal), ToCore(expected), ToCore(actualLocation));
+	errorDiagnosticResults.bTryThrottle = triage.bTryThrottle;
+	errorDiagnosticResults.bTrySteer = triage.bTrySteer;
+	errorDiagnosticResults.nDrift = triage.Drift;
+	errorDiagnosticResults.nSpeedDiff = triage.SpeedDiff;
 }
 
 
@@ -1469,6 +2488,12 @@ void AVehicleAdv3Pawn::CalculateTotalRunCost()
 {
 	// TODO calculate total run cost
 	float total = 0;
+	const FSimulationData* targetRunData = GetTargetRunData();
+	if (!targetRunData)
+	{
+		UE_LOG(VehicleRunState, Warning, TEXT("No target run to compare against."));
+		return;
+	}
 
 	// get run time difference
 	float runtime = GetWorldTimerManager().GetTimerElapsed(RunTimerHandle);
@@ -1478,18 +2503,46 @@ void AVehicleAdv3Pawn::CalculateTotalRunCost()
 	UE_LOG(VehicleRunState, Log, TEXT("Run Time; %f"), runtime);
 	UE_LOG(VehicleRunState, Log, TEXT("Run Time Expected; %f"), targetRunData->GetRunTime());
 
-	total += FMath::Pow(targetRunData->GetRunTime() - runtime, 2.f);
+	// run time, location and rotation terms were accumulated tick by tick
+	const FRunCostTerms terms = RunCost.GetCost();
+	UE_LOG(VehicleRunState, Log, TEXT("Run cost terms: run time %f, location %f, rotation %f"), terms.RunTime, terms.Location, terms.Rotation);
+	total += terms.GetTotal();
+
+	// compare paths in order (Hausdorff can't tell a late line or a loop from the target line)
+	// both whole runs are walked, so off the game thread; the total is reported when they're done
+	TSharedRef<TArray<FTransform>, ESPMode::ThreadSafe> targetPath = MakeShareable(new TArray<FTransform>(RunCost.GetTargetPath()));
+	TSharedRef<TArray<FTransform>, ESPMode::ThreadSafe> runPath = MakeShareable(new TArray<FTransform>(RunCost.GetRunPath()));
+	const FTrajectorySimilarity similarityMetrics = RunSimilarity;
+	AsyncTask(ENamedThreads::AnyThread, [similarityMetrics, targetPath, runPath, total, runtime]()
+	{
+		TArray<FTrajectoryMetricResult> similarity;
+		similarityMetrics.Evaluate(*targetPath, *runPath, similarity);
+		AsyncTask(ENamedThreads::GameThread, [similarity, total, runtime]()
+		{
+			float runCost = total;
+			for (const FTrajectoryMetricResult& result : similarity)
+			{
+				UE_LOG(VehicleRunState, Log, TEXT("%s distance to target run: %f"), result.Name, result.Value);
+				runCost += result.Weight * FMath::Pow(result.Value, 2);
+			}
 
-	// compare paths
-	float hdist = Hausdorff(targetRunData->GetPath(), PathLocations, false); // TODO make sure path locations are what we want
-	total += FMath::Pow(hdist, 2);
+			// log cost
+			UE_LOG(VehicleRunState, Log, TEXT("Total run cost: %f"), runCost);
+			FSimulationMetrics& metrics = FSimulationMetrics::Get();
+			metrics.SetGauge(SimulationMetric::RunCost, runCost);
+			metrics.SetGauge(SimulationMetric::RunSeconds, runtime);
+			metrics.Increment(SimulationMetric::RunsTotal);
+		});
+	});
 
-	// compare path rotations TODO does this even make sense to do? kind of, since if the car never points backwards in target but does in 'real' then that's probably not good <-- maybe weigth this less?
-	float hdistrot = Hausdorff(targetRunData->GetPath(), PathLocations, true); // TODO make sure path locations are what we want
-	total += FMath::Pow(hdistrot, 2);
+	// how much driving the prediction cost (matches an unmonitored car when predictions don't pause the primary)
+	const double wallSeconds = FPlatformTime::Seconds() - RunStartWallSeconds;
+	UE_LOG(VehicleRunState, Log, TEXT("Throughput: %f cm per wall second (%s predictions)"), wallSeconds > 0.0 ? DistanceDriven / wallSeconds : 0.0, bShadowPrediction ? TEXT("shadow") : TEXT("pausing"));
 
-	// log cost
-	UE_LOG(VehicleRunState, Log, TEXT("Total run cost: %f"), total);
+	if (RunRecorder.IsRecording())
+	{
+		RunRecorder.Save();
+	}
 	// stop car
 	throttleInput = 0.f;
 }
@@ -1503,16 +2556,14 @@ float AVehicleAdv3Pawn::Regularize(float deltaThrottle, float deltaSteer)
 
 float AVehicleAdv3Pawn::distanceToGoal(FVector objLocation)
 {
-	// get goal(s) from scene
-	TArray<AActor*> FoundActors;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), AGoal::StaticClass(), FoundActors);
-	//turn off collision for ramps (no collide with simulated vehicle)
-	for (AActor* goal : FoundActors)
-	{
-		return objLocation.DistSquaredXY(objLocation, goal->GetTransform().GetLocation());
-	}
-	// can't find goal
-	return TNumericLimits< float >::Max();
+	return distanceToGoal(FGoalDistanceField::Get(GetWorld()), objLocation);
+}
+
+float AVehicleAdv3Pawn::distanceToGoal(const FGoalDistanceField& field, FVector objLocation)
+{
+	// squared, as the straight-line version was, so lossEnd keeps its weight in calculateTestCost
+	const float distance = field.GetDistance(objLocation);
+	return distance == MAX_flt ? distance : distance * distance;
 }
 
 void AVehicleAdv3Pawn::InduceDragError()
@@ -1555,8 +2606,10 @@ void AVehicleAdv3Pawn::BeginOverlap(class AActor* ThisActor, class AActor* Other
 		if (vehicleType == ECarType::ECT_target)
 		{
 			// store info from target run
-			targetRunData = NewObject<USimulationData>();
-			targetRunData->InitializeTarget(this->GetTransform(), PathLocations, VelocityAlongPath, RPMAlongPath, this->GetGameTimeSinceCreation());
+			// hand it straight to the primary car, this clone is destroyed in ResumeTargetRun
+			FSimulationData targetRun;
+			targetRun.InitializeTarget(this->GetTransform(), PathLocations, VelocityAlongPath, RPMAlongPath, this->GetGameTimeSinceCreation(), TrajectoryPrecision);
+			this->StoredCopy->SetTargetRunData(MoveTemp(targetRun));
 			UE_LOG(VehicleRunState, Log, TEXT("Target Run Completed")); // TODO add log class for target etc.
 
 			// TODO stop and start real run (transfer controller, etc.) <-- can use ResumeExpected, just don't store expected future
@@ -1572,7 +2625,7 @@ void AVehicleAdv3Pawn::BeginOverlap(class AActor* ThisActor, class AActor* Other
 		}
 		if (vehicleType == ECarType::ECT_test)
 		{
-			currentRun->hitgoal = true;
+			bReachedGoal = true;
 			// TODO figure out if can set timer to 0 and end this test run
 			horizon = 0;
 		}
@@ -1581,6 +2634,25 @@ void AVehicleAdv3Pawn::BeginOverlap(class AActor* ThisActor, class AActor* Other
 
 void AVehicleAdv3Pawn::HorizonTimer()
 {
+	// average frame time over the last second, with or without a rollout running, tells the scheduler what rollouts cost
+	if (vehicleType == ECarType::ECT_actual)
+	{
+		const double now = FPlatformTime::Seconds();
+		const uint64 frames = GFrameCounter - FrameSampleCounter;
+		if (frames > 0)
+		{
+			PredictionScheduler.ObserveFrameTime((now - FrameSampleSeconds) / double(frames), bRolloutInFrameSample || horizonCountdown);
+		}
+		FrameSampleCounter = GFrameCounter;
+		FrameSampleSeconds = now;
+		bRolloutInFrameSample = horizonCountdown;
+
+		if (RunCost.HasTarget())
+		{
+			FSimulationMetrics::Get().SetGauge(SimulationMetric::PartialRunCost, RunCost.GetCost().GetTotal());
+		}
+	}
+
 	if (horizonCountdown)
 	{
 		--horizon;
@@ -1590,6 +2662,10 @@ void AVehicleAdv3Pawn::HorizonTimer()
 			{
 				ResumeFromDataGen();
 			}
+			else if (bGenExpected && bShadowRolloutActive)
+			{
+				FinishShadowPrediction();
+			}
 			else if (bGenExpected)
 			{
 				ResumeExpectedSimulation();
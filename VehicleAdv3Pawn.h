@@ -5,15 +5,30 @@
 #include "CoreMinimal.h"
 #include "WheeledVehicle.h"
 #include "SimulationData.h"
+#include "TrajectoryCodec.h"
+#include "PredictionCache.h"
+#include "BicycleModel.h"
+#include "TrajectorySimilarity.h"
+#include "RunCostAccumulator.h"
 #include "Landmark.h"
+#include "LandmarkSensor.h"
 #include "TestRunData.h"
 #include "CopyVehicleData.h"
+#include "RunRecordArena.h"
+#include "CounterRNG.h"
+#include "RunRecorder.h"
+#include "ErrorDetectionCore.h"
+#include "PredictionScheduler.h"
 #include "InputControlMapping.h"
+#include "ControlResponseIndex.h"
+#include "VehicleMonitor.h"
+#include "PathTracker.h"
 #include "VehicleAdv3Pawn.generated.h"
 
+class FPredictionWorld;
+
 /************************************************************************/
 /*							 New Code                                   */
-#define HORIZON 5
 #define NUM_TEST_CARS 4
 #define DEFAULT_THROTTLE 0.5F
 #define DEFAULT_STEER 0.F
@@ -62,6 +77,7 @@ class USpringArmComponent;
 class UTextRenderComponent;
 class UInputComponent;
 class UAudioComponent;
+class FGoalDistanceField;
 
 UCLASS(config=Game)
 class AVehicleAdv3Pawn : public AWheeledVehicle
@@ -100,21 +116,200 @@ class AVehicleAdv3Pawn : public AWheeledVehicle
 	/*                         New Code                                     */
 	UPROPERTY(EditAnywhere)
 	AVehicleAdv3Pawn* StoredCopy;
-	UPROPERTY(EditAnywhere)
-	AController* StoredController;
-	FVector ResetVelocityLinear;
-	FVector ResetVelocityAngular;
-	float ResetRPM;
 
 	/** flag to signal for clean run to gather target data */
 	bool bStartup = true;
 
+	/** simulation and test run records owned by this car (released explicitly, not garbage collected) */
+	FRunRecordArena RunRecords;
+
 	/** store data from target run to calculate cost for this 'experiment' */
-	USimulationData* targetRunData;
+	FRunRecordHandle TargetRunHandle;
+
+	/** reuse target run stored on disk for this level/start/vehicle setup instead of driving it again */
+	UPROPERTY(EditAnywhere, Category = Prediction)
+	bool bUseTargetRunCache = true;
+
+	/** key of this car's target run in the on-disk cache (set in BeginPlay) */
+	uint32 TargetRunCacheKey = 0;
 
 	/** information about expected path up to some horizon */
-	UPROPERTY(EditAnywhere)
-	USimulationData* expectedFuture;
+	FRunRecordHandle ExpectedFutureHandle;
+
+	/** back buffer: a finished shadow rollout is built here, then swapped with ExpectedFutureHandle */
+	FRunRecordHandle PendingFutureHandle;
+
+	/** predict with a clone driving alongside the primary car instead of freezing the primary while it runs
+	  * (the target run and diagnostic runs still pause the primary) */
+	UPROPERTY(EditAnywhere, Category = Prediction)
+	bool bShadowPrediction = true;
+
+	/** object channel of shadow clones; ramps ignore it so clones still drive through them, as frozen-mode clones do
+	  * a game channel of their own, so nothing else loses its ramp collisions; everything else keeps the default Block
+	  * response to it (GameTraceChannel1 is the landmark channel; named in the project's DefaultEngine.ini [/Script/Engine.CollisionProfile]:
+	  * +DefaultChannelResponses=(Channel=ECC_GameTraceChannel2,Name="ShadowVehicle",DefaultResponse=ECR_Block,bTraceType=False,bStaticObject=False)) */
+	static const ECollisionChannel ShadowCollisionChannel = ECC_GameTraceChannel2;
+
+	/** prediction, test and datagen clones drive in their own world and physics scene with a static copy of the level
+	  * (-SharedPhysicsScene spawns them in the level, as the target run always is) */
+	UPROPERTY(EditAnywhere, Category = Prediction)
+	bool bIsolatedPrediction = true;
+
+	/** world clones are spawned in when bIsolatedPrediction (primary/datagen car only) */
+	TSharedPtr<FPredictionWorld> PredictionWorld;
+
+	/** a shadow rollout is running */
+	bool bShadowRolloutActive = false;
+
+	/** index in PathLocations of the primary's first sample after the shadow snapshot (prediction tick 0) */
+	int32 ShadowSnapshotSample = 0;
+
+	/** distance driven by the primary and wall time since BeginPlay (throughput with/without freezing) */
+	float DistanceDriven = 0.f;
+	double RunStartWallSeconds = 0.0;
+	FVector PreviousLocation;
+
+	/** wall time the running prediction / diagnostic cycle started (metrics) */
+	double PredictionStartSeconds = 0.0;
+	double DiagnosticCycleStartSeconds = 0.0;
+
+	/** report a finished prediction (mode: frozen, shadow or cache) and current trajectory memory */
+	void RecordPredictionMetrics(const TCHAR* mode);
+
+	/** -RecordRun=<file>: primary car's inputs, faults and state every tick, and its freezes and state restores,
+	  * written at the goal and on EndPlay */
+	FRunRecorder RunRecorder;
+
+	/** -ReplayRun=<file>: primary car re-driven from a recording instead of predicting/correcting
+	  * (run with -nullrhi for a headless, as-fast-as-possible replay; -ReplayExit quits when it's done) */
+	FRunReplay RunReplay;
+	bool bReplaying = false;
+	int32 ReplayFrame = 0;
+	int32 ReplayEvent = 0;
+	double ReplayStartWallSeconds = 0.0;
+
+	/** cm a replayed tick may be off the recording before the replay counts as diverged (-ReplayTolerance=) */
+	float ReplayTolerance = 1.f;
+
+	/** steering applied by the primary this tick (recorded) */
+	float AppliedSteer = 0.f;
+
+	/** throttle applied this tick (recorded) */
+	float AppliedThrottle = 0.f;
+
+	/** start recording or replaying if asked for on the command line (primary car only) */
+	void BeginRecordOrReplay();
+
+	/** add this tick to the recording
+	  * @param comparedTick index in expected future compared this tick, INDEX_NONE if none */
+	void RecordFrame(float Delta, const FTransform& currentTransform, int32 comparedTick, bool bCameraError, bool bRotationError, bool bRpmError, bool bLocationError);
+
+	/** apply recorded freezes/restores up to the next frame, then its inputs and faults, measure how far the replay is from the recording */
+	void TickReplay();
+
+	/** per-role tick work, Tick dispatches through RoleTicks (indexed by ECarType) instead of branching on the role */
+	typedef void (AVehicleAdv3Pawn::*FRoleTick)(float Delta, const FTransform& currentTransform);
+	static const FRoleTick RoleTicks[];
+
+	/** primary: steering (with generated drift), sampling for the monitor, recording */
+	void TickActual(float Delta, const FTransform& currentTransform);
+
+	friend struct FVehicleMonitorTickFunction;
+
+	/** primary's monitoring (camera check, comparison with the expected future, triage), MonitorSettings.Frequency steps per second */
+	void TickMonitor(float Delta);
+
+	/** compare one sample with what was expected (touches nothing but the camera check tick, and only reads the
+	  * already built sensor, so it may run on a worker) */
+	FVehicleMonitorResult MonitorStep(const FVehicleMonitorSample& sample, const FLandmarkSensor& sensor);
+
+	/** announce errors, feed the scheduler and triage (game thread) */
+	void ApplyMonitorResult(FVehicleMonitorResult& result);
+
+	/** prediction clone: steering adjustment and tick count */
+	void TickPrediction(float Delta, const FTransform& currentTransform);
+
+	/** test clone: as prediction, also marks the tick at the horizon */
+	void TickTest(float Delta, const FTransform& currentTransform);
+
+	/** target/datagen clone: throttle and path recording only (done in Tick for every role) */
+	void TickRecordOnly(float Delta, const FTransform& currentTransform);
+
+	/** HUD strings, in-car camera and engine sound (primary only) */
+	void TickPresentation();
+
+	/** log replay summary (speed, divergence) */
+	void FinishReplay();
+
+	/** -RunBenchmarks: time prediction/scoring/sensing stages on fixed golden data and write Saved/Benchmarks/<-BenchmarkLabel=>.json
+	  * (compare against the stored baseline with Tools/bench_compare.py) */
+	void RunBenchmarks();
+
+	/** precision used when compressing target and expected runs */
+	UPROPERTY(EditAnywhere, Category = Prediction)
+	FTrajectoryCodecSettings TrajectoryPrecision;
+
+	/** reuse expected trajectories when the car is in the same dynamic state as an earlier prediction */
+	UPROPERTY(EditAnywhere, Category = Prediction)
+	FPredictionCacheSettings PredictionCacheSettings;
+
+	FPredictionCache PredictionCache;
+
+	/** analytic model standing in for rollouts once it matches them (-NoAnalyticPrediction turns it off) */
+	UPROPERTY(EditAnywhere, Category = Prediction)
+	FBicycleModelSettings AnalyticModelSettings;
+
+	FBicycleModel AnalyticModel;
+
+	/** analytic prediction from the start of the running rollout, checked against the rollout when it finishes */
+	TArray<FTransform> AnalyticToValidate;
+	TArray<float> AnalyticRPMsToValidate;
+
+	/** smoothed frame time of the primary (s), the tick rollouts and the analytic model sample at */
+	float AverageTickSeconds = 1.f / 60.f;
+
+	/** order-aware metrics comparing the finished run to the target run */
+	UPROPERTY(EditAnywhere, Category = RunCost)
+	FTrajectorySimilaritySettings RunSimilaritySettings;
+
+	FTrajectorySimilarity RunSimilarity;
+
+	/** run time/location/rotation cost against the target run, updated every tick of the primary's run */
+	FRunCostAccumulator RunCost;
+
+	/** feedback control along the target run, for the primary and the clones predicting/testing it; diagnostic
+	  * adjustments become biases on its output (-OpenLoop turns it off) */
+	UPROPERTY(EditAnywhere, Category = PathTracking)
+	FPathTrackerSettings PathTrackerSettings;
+
+	FPathTracker PathTracker;
+
+	/** PathTracker when dataForSpawn was captured: clones start from it, the primary goes back to it with the snapshot */
+	FPathTracker TrackerAtSpawn;
+
+	/** path tracker steering this tick (0 when not tracking) */
+	float TrackedSteer = 0.f;
+
+	/** how far ahead and how often to predict (-FixedHorizon turns adapting off, -PredictionBudgetMs= sets the frame budget) */
+	UPROPERTY(EditAnywhere, Category = Prediction)
+	FPredictionSchedulerSettings PredictionSchedulerSettings;
+
+	FPredictionScheduler PredictionScheduler;
+
+	/** frame counter/wall time at the start of the current frame cost sample, and whether a rollout ran during it */
+	uint64 FrameSampleCounter = 0;
+	double FrameSampleSeconds = 0.0;
+	bool bRolloutInFrameSample = false;
+
+	/** let the scheduler pick the next horizon/interval, restart the prediction timer if the interval changed */
+	void UpdatePredictionSchedule();
+
+	/** key of the state the running rollout started from (added to the cache when it finishes) */
+	FPredictionCacheKey PendingPredictionKey;
+	bool bPredictionKeyPending = false;
+
+	/** cached path being checked against the running rollout */
+	TArray<FTransform> PredictionToValidate;
 
 	/** effectively horizon for simulations triggered by "P" key-press */
 	int pauseTimer = 10; // TODO eventually remove and just use 'horizon'
@@ -124,8 +319,8 @@ class AVehicleAdv3Pawn : public AWheeledVehicle
 	/** Handler for horizon */
 	FTimerHandle HorizonTimerHandle;
 
-	/** effectively horizon for simulations triggered by "P" key-press */
-	int horizon = HORIZON;
+	/** seconds left of the running rollout (set from PredictionScheduler when one starts) */
+	int horizon = 0;
 
 	bool horizonCountdown;
 	
@@ -143,7 +338,7 @@ class AVehicleAdv3Pawn : public AWheeledVehicle
 	/************************************************************************/
 
 public:
-	AVehicleAdv3Pawn();
+	AVehicleAdv3Pawn(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
 	/** The current speed as a string eg 10 km/h */
 	UPROPERTY(Category = Display, VisibleDefaultsOnly, BlueprintReadOnly)
@@ -180,6 +375,7 @@ public:
 	virtual void Tick(float Delta) override;
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
 	// End Actor interface
@@ -227,36 +423,81 @@ public:
 	TArray<FTransform> PathLocations;
 	TArray<FVector> VelocityAlongPath;
 	TArray<float> RPMAlongPath;
-	TMap<int32, TArray<ALandmark*>> LandmarksAlongPath;
-	int tickAtHorizon; // which tick (i.e. index in above arrays) occurs at time=HORIZON
+	int tickAtHorizon; // which tick (i.e. index in above arrays) occurs at time=TestHorizonSeconds
+
+	/** test runs: seconds in that line up with the end of the prediction they're scored against */
+	float TestHorizonSeconds = 0.f;
 
 	/* data for spawning vehicles */
 	bool bRunDiagnosticTests;
 	
-	/* obj to hold input mappings for sampling during test */
-	UPROPERTY(EditAnywhere)
-	UInputControlMapping* InputMapping;
+	/** how diagnostic inputs are looked up from the correction triage asks for (-RandomCorrections samples them at random) */
+	UPROPERTY(EditAnywhere, Category = Diagnostics)
+	FControlResponseSettings ControlResponseSettings;
 
-	UPROPERTY(EditAnywhere)
-	UCopyVehicleData* dataForSpawn;
+	/** FInputControlMapping's recorded responses, searchable by the correction they make (built at the first diagnostic cycle) */
+	FControlResponseIndex ControlResponses;
+
+	FCopyVehicleData dataForSpawn;
 	SDiagnostics errorDiagnosticResults;
 
 	/* keep track of error testing results */
-	UPROPERTY(EditAnywhere)
-	UTestRunData* currentRun;
+	FRunRecordHandle currentRun;
 	float lowestCost;
-	UPROPERTY(EditAnywhere)
-	UTestRunData* bestRun;
+	FRunRecordHandle bestRun;
 	int runCount;
 
+	/** seed for sampling diagnostic candidates (0 = new seed each session; -Seed= on the command line overrides)
+	  * the session seed is logged at start so any run can be repeated exactly */
+	UPROPERTY(EditAnywhere, Category = Diagnostics)
+	int32 RandomSeed = 0;
+	uint64 SessionSeed = 0;
+
+	/** identifies this car's random streams (hash of actor name, stable across sessions) */
+	uint32 VehicleStreamId = 0;
+
+	/** diagnostic cycles started so far (one cycle = NUM_TEST_CARS candidates) */
+	uint32 DiagnosticCycle = 0;
+
+	/** set on a test clone that reached the goal, copied into its run by the primary */
+	bool bReachedGoal = false;
+
 	const float GPS_ACCURACY = 4.9f; // https://www.gps.gov/systems/gps/performance/accuracy/
 
+	/** error detection limits (defaults 800 cm, 0.2 rad, 90 rpm; -DetectLocation=, -DetectRotation=, -DetectRPM= override) */
+	DetectionCore::FThresholds DetectionThresholds;
+
 	/* Flags for error detection and identification */
 	bool bRotationErrorFound = false;
 	bool bLocationErrorFound = false;
 
-	/** Array of objects seen by camera sweep for use in error identification */
-	TArray<FHitResult > outputArray;
+	/** landmark ids (FLandmarkSensor) in view at the last camera check, for use in error identification */
+	TArray<int32> SeenLandmarks;
+
+	/** fixed rate monitoring of the primary, decoupled from the frame rate */
+	UPROPERTY(EditAnywhere, Category = Monitoring)
+	FVehicleMonitorSettings MonitorSettings;
+
+	FVehicleMonitorTickFunction MonitorTick;
+
+	/** sampled by the actor tick since the last monitoring step */
+	TArray<FVehicleMonitorSample> MonitorSamples;
+
+	/** time owed to monitoring steps (s) */
+	float MonitorAccumulator = 0.f;
+
+	/** expected tick of the last camera check */
+	int32 LastCameraCheckTick = INDEX_NONE;
+
+	/** landmark sensor of this world, looked up on the game thread when monitoring starts (FLandmarkSensor::Get isn't thread-safe) */
+	const FLandmarkSensor* MonitorSensor = nullptr;
+
+	/** monitoring results since the last recorded frame */
+	uint8 MonitorErrors = 0;
+	int32 MonitorComparedTick = INDEX_NONE;
+
+	/** landmark camera view (-LandmarkFOV=, -LandmarkRange= override) */
+	FLandmarkSensorSettings LandmarkSensorSettings;
 
 	/** for error triage */
 	const int CAMERA = 0;
@@ -279,11 +520,6 @@ public:
 	void GenerateTargetRun();
 
 	//NTODO:spooky ptrs?
-	/** checks if seenLandmark is in expectedLandmarks
-	@param expectedLandmark array of names of landmarks expected to see in this iteration
-	@param seenLandmark name of a landmark seen this iteration
-	@returns true if seenLandmark is in expectedLandmarks, false otherwise*/
-	bool CheckLandmarkHit(TArray<ALandmark*>* expectedLandmarks, ALandmark* seenLandmark);
 
 	/** determine whether to generate new expected trajectory or do diagnostic testing */
 	void RunTestOrExpect();
@@ -291,15 +527,80 @@ public:
 	/** begin simulation for expected path <-- will be triggered by a timer? */
 	void GenerateExpected();
 
+	/** replace rollout with a cached prediction from the same dynamic state (re-transformed to current pose)
+	 * @return true if expectedFuture was set from the cache */
+	bool UseCachedPrediction(const FTransform& currentTransform, const FVector& linearVelocity, const FVector& angularVelocity, int32 gear, float rpm);
+
+	/** replace rollout with the analytic model's prediction if it has been validated against enough rollouts
+	 * @return true if expectedFuture was set from the model */
+	bool UseAnalyticPrediction(const FTransform& currentTransform, const FVector& linearVelocity, const FVector& angularVelocity, int32 gear);
+
+	/** make future (not from a rollout) the expected future and start comparing against it from the next tick */
+	void UseInstantPrediction(FSimulationData&& future, const TCHAR* mode);
+
+	/** @returns target run, nullptr if there isn't one yet */
+	FSimulationData* GetTargetRunData();
+
+	/** @returns current expected future, nullptr if none has been generated */
+	FSimulationData* GetExpectedFuture();
+
+	/** @returns test run for handle, nullptr if it was released */
+	FTestRunData* GetTestRun(const FRunRecordHandle& handle);
+
+	/** replace target run (releases the old record) */
+	void SetTargetRunData(FSimulationData&& run);
+
+	/** replace expected future (releases the old record) */
+	void SetExpectedFuture(FSimulationData&& future);
+
+	/** @returns live records and bytes held by this car's run records */
+	FRunRecordMemoryReport GetRunRecordMemoryReport() const;
+
+	/** write GetRunRecordMemoryReport to the log */
+	void LogRunRecordMemory() const;
+
+	/** @returns prediction cache (hit rate, error vs fresh rollouts) */
+	const FPredictionCache& GetPredictionCache() const { return PredictionCache; }
+
 	/** Resumes primary vehicles, saves information about expected path and destroys temp vehicle */
 	void ResumeExpectedSimulation();
 
+	/** spawn prediction clone from dataForSpawn while the primary keeps driving */
+	void StartShadowPrediction();
+
+	/** spawn a hidden, physics-only clone (ASimulationVehiclePawn) at transform with its role set before BeginPlay */
+	AVehicleAdv3Pawn* SpawnSimulationVehicle(ECarType role, const FTransform& transform);
+
+	/** undo a freeze whose clone couldn't be spawned: the primary drives on from where it is, timers run again */
+	void ResumeAfterFailedSpawn(const TCHAR* runName);
+
+	/** store shadow clone's rollout, swap it in as expectedFuture and line it up with the ticks driven since the snapshot */
+	void FinishShadowPrediction();
+
+	/** add a finished rollout to the prediction cache (and record the error of a cached path being validated) */
+	void AddRolloutToPredictionCache(AVehicleAdv3Pawn* copy);
+
+	/** fit the analytic model to a finished rollout (and record the error of an analytic path being validated) */
+	void AddRolloutToAnalyticModel(AVehicleAdv3Pawn* copy);
+
+	/** give a prediction clone this car's throttle and steering adjustments */
+	void ShareInputsWith(AVehicleAdv3Pawn* copy) const;
+
+	/** compare actual state to expected state at tick, setting (and announcing) any error flags not already set */
+	void CompareWithExpected(const FSimulationData& expected, int32 tick, const FTransform& actual, float actualRPM, bool& bLocationError, bool& bRotationError, bool& bRpmError) const;
+
+	/** set (and announce) error flags in errors not already set */
+	void AnnounceErrors(uint8 errors, bool& bLocationError, bool& bRotationError, bool& bRpmError) const;
+
 	/** Resumes from target run, restarts primary car, saves target run data and destroys target vehicle */
 	void ResumeTargetRun();
 
 	/** pause primary vehicle, create clone, change copy car input */
 	void GenerateDiagnosticRuns();
 
+	/** @returns random stream for a candidate of the current diagnostic cycle (independent of every other stream) */
+	FCounterRNG MakeCandidateStream(uint32 candidate) const;
+
 	/** Resumes from test run, restarts primary car, checks performance (cost) of test run 
 	and saves if best so far and destroys test vehicle. After last test run  */
 	void ResumeFromDiagnostic();
@@ -313,12 +614,17 @@ public:
 	/** calculate cost of test run */
 	float calculateTestCost();
 
+	/** cost of a test run from the states calculateTestCost gathers
+	  * @param lossEnd distanceToGoal of where the test car ended up */
+	float TestCost(const SCostComponents& expected, const SCostComponents& test, const SCostComponents& actual, float lossEnd, const FTestRunData& testRun);
+
 	/** get info about severity of rotation error
 	 * @param index in simulated data where error found
 	 * @return TArray of floats representing (respectively) angular distance (in radians), veering (LEFT/RIGHT), dot product or nullptr if expectedfuture is null */
 	TArray<float>* RotationErrorInfo(int index); // <== currently doesn't get called; either delete or call in ErrorTriage
 
-	/**TODO*/
+	/** landmarks missed/unexpectedly seen at the last camera check, against the view from the expected pose at index
+	 * @return TArray of missing right, missing left, extra right, extra left */
 	TArray<int>* CameraErrorInfo(int index);
 
 	/** determines which side of a line (def by two points) another point lies
@@ -335,8 +641,9 @@ public:
 
 	/** TODO: Called when a variable in the current state does not match what is expected in simulation
 	 * @param index - tick where error was found 
+	 * @param actualLocation - where the car was at that tick (not necessarily where it is now)
 	 TODO make sure this is called async?? */
-	void ErrorTriage(int index, bool cameraError, bool headingError, bool rpmError, bool locationError);
+	void ErrorTriage(int index, const FVector& actualLocation, bool cameraError, bool headingError, bool rpmError, bool locationError);
 
 	/** @return cost of x for target t: l = (t - x)^2 */
 	float QuadraticLoss(SCostComponents expected, SCostComponents test, SCostComponents actual);
@@ -348,6 +655,7 @@ public:
 	float Hausdorff(TArray<FTransform> set1, TArray<FTransform> set2, bool rotation);
 
 	/** Use info from entire run and target run to calculate cost
+	  * (run time, location and rotation terms accumulated in RunCost, then weighted RunSimilarity metrics off the game thread)
 	  * TODO may store along way and then use changes made (e.g. additional regularization for minimal input change)*/
 	void CalculateTotalRunCost();
 
@@ -355,8 +663,9 @@ public:
 	  * @return regularization term for cost calculation  */
 	float Regularize(float deltaThrottle, float deltaSteer);
 
-	/** @returns distance to goal. Assumes only 1 goal in scene */
+	/** @returns squared driving distance to the nearest goal (precomputed field, see FGoalDistanceField) */
 	float distanceToGoal(FVector objLocation);
+	float distanceToGoal(const FGoalDistanceField& field, FVector objLocation);
 	
 	/** Induce error (callback for 'I' keypress) by increasing drag 10x */
 	void InduceDragError();